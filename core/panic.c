@@ -32,6 +32,10 @@
 #include "periph/pm.h"
 #include "log.h"
 
+#ifdef MODULE_STDIO_UART_ASYNC
+#include "stdio_uart.h"
+#endif
+
 #if defined(DEVELHELP) && defined(MODULE_PS)
 #include "ps.h"
 #endif
@@ -67,6 +71,10 @@ NORETURN void core_panic(core_panic_t crash_code, const char *message)
     if (crashed == 0) {
         /* print panic message to console (if possible) */
         crashed = 1;
+#ifdef MODULE_STDIO_UART_ASYNC
+        /* send the buffered output, the TX thread won't run again */
+        stdio_uart_flush();
+#endif
 #ifndef NDEBUG
         if (crash_code == PANIC_ASSERT_FAIL) {
             cpu_print_last_instruction();
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_disp_dev_native
+ * @{
+ *
+ * @file
+ * @brief       Display device on native, backed by a file
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "disp_dev_native.h"
+#include "native_internal.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+int disp_dev_native_init(disp_dev_native_t *dev,
+                         const disp_dev_native_params_t *params)
+{
+    size_t size = (size_t)params->width * params->height * sizeof(uint16_t);
+
+    dev->dev.driver = &disp_dev_native_driver;
+    dev->params = params;
+    dev->maps = 0;
+    dev->pixels = 0;
+
+    int fd = real_open(params->fname, O_RDWR | O_CREAT, 0644);
+
+    if (fd < 0) {
+        DEBUG("disp_dev_native: can't open %s\n", params->fname);
+        return -EIO;
+    }
+    if (ftruncate(fd, size) < 0) {
+        real_close(fd);
+        return -EIO;
+    }
+    dev->fb = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    /* the mapping stays valid */
+    real_close(fd);
+
+    return (dev->fb == MAP_FAILED) ? -EIO : 0;
+}
+
+static void _map(const disp_dev_t *disp_dev, uint16_t x1, uint16_t x2,
+                 uint16_t y1, uint16_t y2, const uint16_t *color)
+{
+    disp_dev_native_t *dev = (disp_dev_native_t *)disp_dev;
+    const disp_dev_native_params_t *params = dev->params;
+    unsigned width = x2 - x1 + 1;
+    uint32_t pixels = width * (y2 - y1 + 1);
+
+    assert((x2 < params->width) && (y2 < params->height));
+
+    for (unsigned y = y1; y <= y2; y++) {
+        memcpy(&dev->fb[y * params->width + x1], color,
+               width * sizeof(uint16_t));
+        color += width;
+    }
+    dev->maps++;
+    dev->pixels += pixels;
+
+    if (params->pixel_ns) {
+        ztimer_sleep(ZTIMER_USEC,
+                     (uint64_t)pixels * params->pixel_ns / NS_PER_US);
+    }
+}
+
+static uint16_t _height(const disp_dev_t *disp_dev)
+{
+    return ((const disp_dev_native_t *)disp_dev)->params->height;
+}
+
+static uint16_t _width(const disp_dev_t *disp_dev)
+{
+    return ((const disp_dev_native_t *)disp_dev)->params->width;
+}
+
+static uint8_t _color_depth(const disp_dev_t *disp_dev)
+{
+    (void)disp_dev;
+    return 16;
+}
+
+static void _set_invert(const disp_dev_t *disp_dev, bool invert)
+{
+    (void)disp_dev;
+    (void)invert;
+}
+
+const disp_dev_driver_t disp_dev_native_driver = {
+    .map            = _map,
+    .height         = _height,
+    .width          = _width,
+    .color_depth    = _color_depth,
+    .set_invert     = _set_invert,
+};
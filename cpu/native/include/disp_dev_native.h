@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_disp_dev
+ * @defgroup    drivers_disp_dev_native Native display emulation
+ * @{
+ * @brief       Display device on native, backed by a file
+ *
+ * The pixels are written to a file mapped into memory, as 16 bit RGB565
+ * values in host byte order, line by line. Other processes can map the same
+ * file to watch the display, or convert it, e.g. with
+ * ```
+ * ffmpeg -f rawvideo -pixel_format rgb565le -video_size 320x240 \
+ *        -i display.raw display.png
+ * ```
+ *
+ * To compare flushing strategies, the driver counts the mapped areas and
+ * pixels, and can emulate the time a transfer to a real display takes by
+ * sleeping @ref DISP_DEV_NATIVE_PIXEL_NS per pixel.
+ *
+ * @file
+ */
+
+#ifndef DISP_DEV_NATIVE_H
+#define DISP_DEV_NATIVE_H
+
+#include <stdint.h>
+
+#include "disp_dev.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef DISP_DEV_NATIVE_FILENAME
+/**
+ * @brief   File of the display set up by auto_init
+ */
+#define DISP_DEV_NATIVE_FILENAME    "display.raw"
+#endif
+
+#ifndef DISP_DEV_NATIVE_WIDTH
+/**
+ * @brief   Width of the display set up by auto_init
+ */
+#define DISP_DEV_NATIVE_WIDTH       (320U)
+#endif
+
+#ifndef DISP_DEV_NATIVE_HEIGHT
+/**
+ * @brief   Height of the display set up by auto_init
+ */
+#define DISP_DEV_NATIVE_HEIGHT      (240U)
+#endif
+
+#ifndef DISP_DEV_NATIVE_PIXEL_NS
+/**
+ * @brief   Emulated transfer time per pixel of the display set up by
+ *          auto_init in ns
+ *
+ * 0 for none, 400 is a 16 bit pixel on SPI at 40 MHz.
+ */
+#define DISP_DEV_NATIVE_PIXEL_NS    (0U)
+#endif
+
+#ifndef DISP_DEV_NATIVE_SCREEN_ID
+/**
+ * @brief   Screen of the display set up by auto_init
+ */
+#define DISP_DEV_NATIVE_SCREEN_ID   (0U)
+#endif
+
+/**
+ * @brief   Native display parameters
+ */
+typedef struct {
+    const char *fname;          /**< file holding the pixels */
+    uint16_t width;             /**< width in pixels */
+    uint16_t height;            /**< height in pixels */
+    uint32_t pixel_ns;          /**< emulated transfer time per pixel in ns */
+} disp_dev_native_params_t;
+
+/**
+ * @brief   Native display device descriptor
+ */
+typedef struct {
+    disp_dev_t dev;                             /**< generic display device */
+    const disp_dev_native_params_t *params;     /**< parameters */
+    uint16_t *fb;                               /**< the mapped file */
+    uint32_t maps;                              /**< areas mapped */
+    uint32_t pixels;                            /**< pixels mapped */
+} disp_dev_native_t;
+
+/**
+ * @brief   Native display driver
+ */
+extern const disp_dev_driver_t disp_dev_native_driver;
+
+/**
+ * @brief   Initialize a native display
+ *
+ * Creates the file if needed and maps it.
+ *
+ * @param[out] dev      device descriptor
+ * @param[in]  params   parameters
+ *
+ * @return  0 on success
+ * @return  -EIO if the file can't be created or mapped
+ */
+int disp_dev_native_init(disp_dev_native_t *dev,
+                         const disp_dev_native_params_t *params);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISP_DEV_NATIVE_H */
+/** @} */
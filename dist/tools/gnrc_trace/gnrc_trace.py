@@ -0,0 +1,120 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Script to parse the output of the `gnrc_trace` shell command (provided by the
+`gnrc_trace` module) and the `gnrc_trace_dump()` function and to compute the
+latency between the trace points a packet passes.
+"""
+
+import argparse
+import collections
+import re
+import sys
+
+TRACE_RE = re.compile(
+    r"trace (?P<seq>\d+) (?P<time>\d+) (?P<layer>\S+) (?P<event>\S+) "
+    r"(?P<pkt>0x[0-9a-fA-F]+) (?P<len>\d+)"
+)
+# trace points after which a packet is not seen again under its pointer
+TERMINAL = {
+    ("netif", "out"),
+    ("netif", "fwd"),
+    ("ipv6", "fwd"),
+    ("tcp", "demux"),
+    ("sock", "deliver"),
+}
+TIME_MOD = 1 << 32
+
+Entry = collections.namedtuple("Entry", "seq time layer event pkt len")
+
+
+def parse(lines):
+    entries = []
+    for line in lines:
+        match = TRACE_RE.search(line)
+        if match is None:
+            continue
+        entries.append(Entry(
+            seq=int(match["seq"]),
+            time=int(match["time"]),
+            layer=match["layer"],
+            event=match["event"],
+            pkt=int(match["pkt"], 16),
+            len=int(match["len"]),
+        ))
+    entries.sort(key=lambda e: e.seq)
+    return entries
+
+
+def chains(entries, max_gap):
+    """Groups the entries into the paths of the single packets"""
+    open_chains = {}
+    for entry in entries:
+        chain = open_chains.get(entry.pkt)
+        if chain is not None and \
+           (entry.time - chain[-1].time) % TIME_MOD > max_gap:
+            # pointer was reused by a later packet
+            yield open_chains.pop(entry.pkt)
+            chain = None
+        if chain is None:
+            chain = open_chains[entry.pkt] = []
+        chain.append(entry)
+        if (entry.layer, entry.event) in TERMINAL:
+            yield open_chains.pop(entry.pkt)
+    yield from open_chains.values()
+
+
+def point(entry):
+    return "{} {}".format(entry.layer, entry.event)
+
+
+def latencies(entries, max_gap):
+    stats = collections.OrderedDict()
+    paths = collections.Counter()
+    for chain in chains(entries, max_gap):
+        paths[" > ".join(point(e) for e in chain)] += 1
+        for prev, cur in zip(chain, chain[1:]):
+            key = (point(prev), point(cur))
+            stats.setdefault(key, []).append(
+                (cur.time - prev.time) % TIME_MOD
+            )
+    return stats, paths
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("dump", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin,
+                        help="output of `gnrc_trace dump` (default: stdin)")
+    parser.add_argument("-g", "--max-gap", type=int, default=1000000,
+                        help="maximum time in us between two trace points "
+                             "of the same packet (default: 1000000)")
+    parser.add_argument("-p", "--paths", action="store_true",
+                        help="also print the paths taken by the packets")
+    args = parser.parse_args()
+
+    entries = parse(args.dump)
+    if not entries:
+        print("no trace entries found", file=sys.stderr)
+        sys.exit(1)
+    stats, paths = latencies(entries, args.max_gap)
+    print("{:<16} {:<16} {:>7} {:>9} {:>9} {:>9}".format(
+        "from", "to", "count", "min[us]", "avg[us]", "max[us]"))
+    for (src, dst), values in stats.items():
+        print("{:<16} {:<16} {:>7} {:>9} {:>9.1f} {:>9}".format(
+            src, dst, len(values), min(values),
+            sum(values) / len(values), max(values)))
+    if args.paths:
+        print()
+        for path, count in paths.most_common():
+            print("{:>7} {}".format(count, path))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""Decode the records of module log_binary
+
+Reads the output of an application, e.g. from `make term`, and replaces the
+lines of module log_binary by the log messages, formatted with the format
+strings from the ELF file of the application. Other lines are passed on.
+"""
+
+import argparse
+import base64
+import binascii
+import re
+import struct
+import sys
+
+PREFIX = b'~L'
+SECTION = '.log_binary'
+ID_LOST = 0xffffff
+LEVELS = ['', 'ERROR', 'WARNING', 'INFO', 'DEBUG', 'ALL']
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+CONVERSION = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?'
+                        r'(hh|h|ll|l|j|z|t|L)?([diouxXcsfFeEgGp%])')
+
+
+class Elf:
+    """Sections of an ELF file, just what is needed to look up strings"""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            data = f.read()
+        if data[:4] != b'\x7fELF':
+            raise ValueError("{}: not an ELF file".format(path))
+        is64 = data[4] == 2
+        self.endian = '<' if data[5] == 1 else '>'
+        if is64:
+            shoff, = struct.unpack_from(self.endian + 'Q', data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from(
+                self.endian + 'HHH', data, 0x3a)
+            fmt = 'IIQQQQIIQQ'
+        else:
+            shoff, = struct.unpack_from(self.endian + 'I', data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from(
+                self.endian + 'HHH', data, 0x2e)
+            fmt = 'IIIIIIIIII'
+        headers = [struct.unpack_from(self.endian + fmt, data,
+                                      shoff + i * shentsize)
+                   for i in range(shnum)]
+        names = headers[shstrndx]
+        names = data[names[4]:names[4] + names[5]]
+        self.formats = None
+        # (address, contents) of the sections loaded to the device
+        self.loaded = []
+        for (name, stype, flags, addr, offset, size, *_) in headers:
+            name = names[name:names.index(b'\0', name)].decode()
+            contents = data[offset:offset + size]
+            if name == SECTION:
+                self.formats = contents
+            elif flags & SHF_ALLOC and stype != SHT_NOBITS:
+                self.loaded.append((addr, contents))
+        if self.formats is None:
+            raise ValueError("{}: no section {}, not built with log_binary"
+                             .format(path, SECTION))
+
+    @staticmethod
+    def _string(data, offset):
+        end = data.find(b'\0', offset)
+        return data[offset:end if end >= 0 else len(data)].decode(
+            errors='replace')
+
+    def format_string(self, fmt_id):
+        if fmt_id >= len(self.formats):
+            return None
+        return self._string(self.formats, fmt_id)
+
+    def string(self, addr):
+        for (start, contents) in self.loaded:
+            if start <= addr < start + len(contents):
+                return self._string(contents, addr - start)
+        return None
+
+
+def _signed(val, bits):
+    val &= (1 << bits) - 1
+    return val - (1 << bits) if val >> (bits - 1) else val
+
+
+def format_message(elf, fmt, args):
+    """printf() on the host, with the arguments as 32 bit words"""
+    args = list(args)
+
+    def arg():
+        return args.pop(0) if args else 0
+
+    def convert(match):
+        flags, width, prec, length, conv = match.groups()
+        if conv == '%':
+            return '%'
+        if width == '*':
+            width = str(_signed(arg(), 32))
+        if prec == '*':
+            prec = str(_signed(arg(), 32))
+        spec = '%' + flags + (width or '') + \
+            ('.' + prec if prec is not None else '')
+        val = arg()
+        bits = {'hh': 8, 'h': 16}.get(length, 32)
+        if conv in 'di':
+            return (spec + 'd') % _signed(val, bits)
+        if conv in 'ouxX':
+            return (spec + conv.replace('u', 'd')) % (val & ((1 << bits) - 1))
+        if conv == 'c':
+            return (spec + 'c') % chr(val & 0xff)
+        if conv == 'p':
+            return (spec + 's') % '0x{:x}'.format(val)
+        if conv == 's':
+            string = elf.string(val)
+            if string is None:
+                string = '<0x{:x}>'.format(val)
+            return (spec + 's') % string
+        # floating point, stored as float
+        return (spec + conv) % struct.unpack('<f', struct.pack('<I', val))[0]
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def decode_record(elf, data):
+    """Decode a record to text, without the line break"""
+    words = struct.unpack(elf.endian + '{}I'.format(len(data) // 4), data)
+    if len(words) < 2:
+        raise ValueError("record too short")
+    hdr, timestamp, args = words[0], words[1], words[2:]
+    fmt_id, level = hdr >> 8, (hdr >> 4) & 0xf
+    if fmt_id == ID_LOST:
+        text = "{} log records lost".format(args[0] if args else '?')
+    else:
+        fmt = elf.format_string(fmt_id)
+        if fmt is None:
+            text = "unknown format string {:#x}, wrong ELF file?".format(
+                fmt_id)
+        else:
+            text = format_message(elf, fmt, args).rstrip('\n')
+    level = LEVELS[level] if level < len(LEVELS) else str(level)
+    return "{:d}.{:06d} {}: {}".format(timestamp // 1000000,
+                                       timestamp % 1000000, level, text)
+
+
+def decode_line(elf, line):
+    """Decode a record in a line of output, or pass the line on"""
+    pos = line.find(PREFIX)
+    if pos < 0:
+        return line
+    rest = line[pos + len(PREFIX):]
+    encoded = re.match(rb'[A-Za-z0-9+/=]*', rest).group(0)
+    try:
+        record = base64.b64decode(encoded, validate=True)
+        text = decode_record(elf, record)
+    except (binascii.Error, ValueError, struct.error):
+        return line
+    return line[:pos] + text.encode() + rest[len(encoded):]
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+        description=__doc__.splitlines()[0])
+    parser.add_argument('elf', help='ELF file of the application')
+    parser.add_argument('input', nargs='?',
+                        help='output of the application, default: stdin')
+    return parser.parse_args()
+
+
+def main(args):
+    elf = Elf(args.elf)
+    infile = open(args.input, 'rb') if args.input else sys.stdin.buffer
+    out = sys.stdout.buffer
+    for line in infile:
+        out.write(decode_line(elf, line))
+        out.flush()
+
+
+if __name__ == "__main__":
+    try:
+        main(parse_arguments())
+    except (OSError, ValueError) as e:
+        sys.exit("error: {}".format(e))
+    except KeyboardInterrupt:
+        pass
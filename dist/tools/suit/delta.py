@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+
+"""Create delta payloads for module suit_delta
+
+Writes a patch that turns the source image (the running slot) into the new
+image: a header "RDIF" | source size | image size, followed by records of
+diff length | extra length | seek, the diff bytes that are added to the
+source and the extra bytes that are copied. All numbers are 32 bit little
+endian, seek is signed and moves the position in the source after a record.
+
+The diff bytes are mostly zero, the patch is meant to be compressed with
+heatshrink.py as well.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = b'RDIF'
+# an exact match of this length starts a diff
+MIN_MATCH = 8
+# candidates kept per indexed block, the oldest ones are dropped
+MAX_CANDIDATES = 16
+# a diff ends after this many bytes without an improvement
+MAX_MISMATCH = 32
+
+
+def _index(old):
+    index = {}
+    for i in range(len(old) - MIN_MATCH + 1):
+        candidates = index.setdefault(old[i:i + MIN_MATCH], [])
+        if len(candidates) == MAX_CANDIDATES:
+            candidates.pop(0)
+        candidates.append(i)
+    return index
+
+
+def _exact(old, new, o, n):
+    length = 0
+    while (o + length < len(old) and n + length < len(new) and
+           old[o + length] == new[n + length]):
+        length += 1
+    return length
+
+
+def _approximate(old, new, o, n):
+    """Length of the diff at o and n with the most matching bytes"""
+    best_score, best_len, matches = 0, 0, 0
+    i = 0
+    while o + i < len(old) and n + i < len(new):
+        if old[o + i] == new[n + i]:
+            matches += 1
+        i += 1
+        score = 2 * matches - i
+        if score > best_score:
+            best_score, best_len = score, i
+        elif i - best_len > MAX_MISMATCH:
+            break
+    return best_len
+
+
+def _find(old, new, index, start, expected):
+    """Next position in new with a match in old, preferring expected"""
+    for n in range(start, len(new) - MIN_MATCH + 1):
+        candidates = list(index.get(new[n:n + MIN_MATCH], ()))
+        guess = expected + n - start
+        if 0 <= guess < len(old):
+            candidates.append(guess)
+        best = None
+        for o in candidates:
+            length = _exact(old, new, o, n)
+            if length < MIN_MATCH:
+                continue
+            key = (length, -abs(o - guess))
+            if best is None or key > best[0]:
+                best = (key, o)
+        if best is not None:
+            return n, best[1]
+    return len(new), None
+
+
+def create(old, new):
+    index = _index(old)
+    patch = bytearray(MAGIC + struct.pack('<II', len(old), len(new)))
+    # the current record diffs new[start:start + length] with old[src:]
+    src, start, length = 0, 0, 0
+    while True:
+        n, o = _find(old, new, index, start + length, src + length)
+        diff = bytes((new[start + i] - old[src + i]) & 0xff
+                     for i in range(length))
+        extra = new[start + length:n]
+        seek = 0 if o is None else o - (src + length)
+        patch += struct.pack('<IIi', length, len(extra), seek)
+        patch += diff + extra
+        if o is None:
+            return bytes(patch)
+        src, start = o, n
+        length = _approximate(old, new, o, n)
+
+
+def apply(old, patch):
+    if patch[:4] != MAGIC:
+        raise ValueError("not a patch")
+    src_len, img_len = struct.unpack_from('<II', patch, 4)
+    if src_len > len(old):
+        raise ValueError("source of {} bytes needed".format(src_len))
+    out = bytearray()
+    pos, src = 12, 0
+    while pos < len(patch):
+        diff, extra, seek = struct.unpack_from('<IIi', patch, pos)
+        pos += 12
+        out += bytes((old[src + i] + patch[pos + i]) & 0xff
+                     for i in range(diff))
+        pos += diff
+        out += patch[pos:pos + extra]
+        pos += extra
+        src += diff + seek
+    if len(out) != img_len:
+        raise ValueError("patch incomplete")
+    return bytes(out)
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+        description=__doc__.splitlines()[0])
+    parser.add_argument('source', help='image running on the device')
+    parser.add_argument('input', help='new image')
+    parser.add_argument('--output', '-o',
+                        help='patch, default: <input>.delta')
+    parser.add_argument('--block-size', '-b', type=int, default=64,
+                        help='CoAP block size for the statistics')
+    parser.add_argument('--stats', '-s', action='store_true',
+                        help='print the patch size, raw and compressed')
+    return parser.parse_args()
+
+
+def blocks(size, block_size):
+    return (size + block_size - 1) // block_size
+
+
+def main(args):
+    with open(args.source, 'rb') as f:
+        old = f.read()
+    with open(args.input, 'rb') as f:
+        new = f.read()
+    patch = create(old, new)
+    if apply(old, patch) != new:
+        sys.exit("error: patch does not reproduce the image")
+    with open(args.output or args.input + '.delta', 'wb') as f:
+        f.write(patch)
+    if args.stats:
+        sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+        import heatshrink
+        compressed = len(heatshrink.compress(patch))
+        print("{}: {} bytes, patch {} bytes, {} compressed, "
+              "{} -> {} blocks of {} bytes"
+              .format(args.input, len(new), len(patch), compressed,
+                      blocks(len(new), args.block_size),
+                      blocks(compressed, args.block_size), args.block_size))
+
+
+if __name__ == "__main__":
+    main(parse_arguments())
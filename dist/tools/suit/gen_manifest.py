@@ -35,6 +35,11 @@ def parse_arguments():
                         help='Manifest vendor uuid')
     parser.add_argument('--uuid-class', '-C', default="native",
                         help='Manifest class uuid')
+    parser.add_argument('--compress', '-c', choices=['heatshrink'],
+                        help='Fetch the payloads compressed, from <file>.hs')
+    parser.add_argument('--delta', '-d', action='store_true',
+                        help='Fetch patches against the running slot, from '
+                             '<file>.delta')
     parser.add_argument('slotfiles', nargs="+",
                         help='The list of slot file paths')
     return parser.parse_args()
@@ -81,6 +86,19 @@ def main(args):
         if offset:
             component.update({"offset": offset})
 
+        if args.delta:
+            uri += ".delta"
+            component.update({
+                "uri": uri,
+                "unpack-info": "delta",
+            })
+
+        if args.compress:
+            component.update({
+                "uri": uri + ".hs",
+                "compression-info": args.compress,
+            })
+
         template["components"].append(component)
 
     with open(args.output, 'w') as f:
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+
+"""Compress SUIT payloads for module suit_decompress
+
+Writes the heatshrink format decoded by pkg/heatshrink: a stream of bits,
+most significant bit first, where a 1 bit is followed by a literal byte
+and a 0 bit by a back-reference of WINDOW bits (distance - 1) and
+LOOKAHEAD bits (length - 1).
+
+The window and lookahead must match HEATSHRINK_STATIC_WINDOW_BITS and
+HEATSHRINK_STATIC_LOOKAHEAD_BITS of the device, 8 and 4 by default.
+"""
+
+import argparse
+import sys
+
+# a back-reference of 2 bytes already takes fewer bits than 2 literals
+MIN_MATCH = 2
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.byte = 0
+        self.bits = 0
+
+    def put(self, value, count):
+        for i in reversed(range(count)):
+            self.byte = (self.byte << 1) | ((value >> i) & 1)
+            self.bits += 1
+            if self.bits == 8:
+                self.out.append(self.byte)
+                self.byte = 0
+                self.bits = 0
+
+    def finish(self):
+        # the decoder ignores the zero padding of the last byte
+        if self.bits:
+            self.out.append(self.byte << (8 - self.bits))
+        return bytes(self.out)
+
+
+class BitReader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def get(self, count):
+        if self.pos + count > len(self.data) * 8:
+            return None
+        value = 0
+        for _ in range(count):
+            byte = self.data[self.pos >> 3]
+            value = (value << 1) | ((byte >> (7 - (self.pos & 7))) & 1)
+            self.pos += 1
+        return value
+
+
+def compress(data, window=8, lookahead=4):
+    max_dist = 1 << window
+    max_len = 1 << lookahead
+    writer = BitWriter()
+    # positions of each pair of bytes, newest last
+    chains = {}
+    pos = 0
+
+    def index(start, end):
+        for i in range(start, min(end, len(data) - 1)):
+            chains.setdefault(data[i:i + 2], []).append(i)
+
+    while pos < len(data):
+        best_len, best_dist = 0, 0
+        for cand in reversed(chains.get(data[pos:pos + 2], [])):
+            dist = pos - cand
+            if dist > max_dist:
+                break
+            length = 0
+            while (length < max_len and pos + length < len(data) and
+                   data[cand + length] == data[pos + length]):
+                length += 1
+            if length > best_len:
+                best_len, best_dist = length, dist
+                if length == max_len:
+                    break
+        if best_len >= MIN_MATCH:
+            writer.put(0, 1)
+            writer.put(best_dist - 1, window)
+            writer.put(best_len - 1, lookahead)
+            index(pos, pos + best_len)
+            pos += best_len
+        else:
+            writer.put(1, 1)
+            writer.put(data[pos], 8)
+            index(pos, pos + 1)
+            pos += 1
+    return writer.finish()
+
+
+def decompress(data, window=8, lookahead=4):
+    reader = BitReader(data)
+    out = bytearray()
+    while True:
+        tag = reader.get(1)
+        if tag is None:
+            break
+        if tag:
+            byte = reader.get(8)
+            if byte is None:
+                break
+            out.append(byte)
+            continue
+        dist = reader.get(window)
+        length = reader.get(lookahead)
+        if dist is None or length is None:
+            break
+        for _ in range(length + 1):
+            # the device starts with a window of zeros
+            src = len(out) - (dist + 1)
+            out.append(out[src] if src >= 0 else 0)
+    return bytes(out)
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+        description=__doc__.splitlines()[0])
+    parser.add_argument('input', help='payload to compress')
+    parser.add_argument('--output', '-o',
+                        help='compressed payload, default: <input>.hs')
+    parser.add_argument('--window', '-w', type=int, default=8,
+                        help='window size as exponent of 2')
+    parser.add_argument('--lookahead', '-l', type=int, default=4,
+                        help='lookahead size as exponent of 2')
+    parser.add_argument('--decompress', '-d', action='store_true',
+                        help='decompress input instead')
+    parser.add_argument('--block-size', '-b', type=int, default=64,
+                        help='CoAP block size for the statistics')
+    parser.add_argument('--stats', '-s', action='store_true',
+                        help='print the bytes and blocks saved')
+    return parser.parse_args()
+
+
+def blocks(size, block_size):
+    return (size + block_size - 1) // block_size
+
+
+def main(args):
+    with open(args.input, 'rb') as f:
+        data = f.read()
+    if args.decompress:
+        res = decompress(data, args.window, args.lookahead)
+    else:
+        res = compress(data, args.window, args.lookahead)
+        if decompress(res, args.window, args.lookahead) != data:
+            sys.exit("error: compressed payload does not decompress")
+    with open(args.output or args.input + '.hs', 'wb') as f:
+        f.write(res)
+    if args.stats and not args.decompress:
+        saved = len(data) - len(res)
+        print("{}: {} -> {} bytes, {:.1f}% saved, {} -> {} blocks of {} bytes"
+              .format(args.input, len(data), len(res),
+                      100 * saved / len(data) if data else 0,
+                      blocks(len(data), args.block_size),
+                      blocks(len(res), args.block_size), args.block_size))
+
+
+if __name__ == "__main__":
+    main(parse_arguments())
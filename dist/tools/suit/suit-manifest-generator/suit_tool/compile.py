@@ -271,7 +271,9 @@ def compile_manifest(options, m):
                 'offset' : lambda cid, data: ('offset', data['offset']),
             }
             if any(['compression-info' in c and not c.get('decompress-on-load', False) for c in choices]):
-                InstParams['compression-info'] = lambda cid, data: data.get('compression-info')
+                InstParams['compression-info'] = lambda cid, data: ('compression-info', data['compression-info'])
+            if any(['unpack-info' in c for c in choices]):
+                InstParams['unpack-info'] = lambda cid, data: ('unpack-info', data['unpack-info'])
             InstCmds = {
                 'offset': lambda cid, data: mkCommand(
                     cid, 'condition-component-offset', None)
@@ -290,7 +292,9 @@ def compile_manifest(options, m):
                 'offset' : lambda cid, data: ('offset', data['offset']),
             }
             if any(['compression-info' in c and not c.get('decompress-on-load', False) for c in choices]):
-                FetchParams['compression-info'] = lambda cid, data: data.get('compression-info')
+                FetchParams['compression-info'] = lambda cid, data: ('compression-info', data['compression-info'])
+            if any(['unpack-info' in c for c in choices]):
+                FetchParams['unpack-info'] = lambda cid, data: ('unpack-info', data['unpack-info'])
 
             FetchCmds = {
                 'offset': lambda cid, data: mkCommand(
@@ -24,9 +24,77 @@
 #include <errno.h>
 
 #include "disp_dev.h"
+#include "mutex.h"
 
 disp_dev_reg_t *disp_dev_reg = NULL;
 
+#if MODULE_DISP_DEV_ASYNC
+static struct {
+    const disp_dev_t *dev;
+    uint16_t x1;
+    uint16_t x2;
+    uint16_t y1;
+    uint16_t y2;
+    const uint16_t *color;
+    disp_dev_map_cb_t cb;
+    void *arg;
+} _req;
+
+/* locked while an area is mapped */
+static mutex_t _busy = MUTEX_INIT;
+/* unlocked when _req holds an area */
+static mutex_t _start = MUTEX_INIT_LOCKED;
+static char _stack[DISP_DEV_ASYNC_STACKSIZE];
+
+static void *_map_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        mutex_lock(&_start);
+        _req.dev->driver->map(_req.dev, _req.x1, _req.x2, _req.y1, _req.y2,
+                              _req.color);
+        if (_req.cb) {
+            _req.cb(_req.arg);
+        }
+        mutex_unlock(&_busy);
+    }
+
+    return NULL;
+}
+
+void disp_dev_async_init(void)
+{
+    thread_create(_stack, sizeof(_stack), DISP_DEV_ASYNC_PRIO,
+                  THREAD_CREATE_STACKTEST, _map_thread, NULL, "disp_dev");
+}
+
+void disp_dev_map_async(const disp_dev_t *dev,
+                        uint16_t x1, uint16_t x2, uint16_t y1, uint16_t y2,
+                        const uint16_t *color, disp_dev_map_cb_t cb,
+                        void *arg)
+{
+    assert(dev);
+
+    mutex_lock(&_busy);
+    _req.dev = dev;
+    _req.x1 = x1;
+    _req.x2 = x2;
+    _req.y1 = y1;
+    _req.y2 = y2;
+    _req.color = color;
+    _req.cb = cb;
+    _req.arg = arg;
+    mutex_unlock(&_start);
+}
+
+void disp_dev_map_wait(void)
+{
+    mutex_lock(&_busy);
+    mutex_unlock(&_busy);
+}
+#endif
+
 int disp_dev_reg_add(disp_dev_reg_t *dev)
 {
     disp_dev_reg_t *tmp = disp_dev_reg;
@@ -67,7 +135,14 @@ void disp_dev_map(const disp_dev_t *dev,
 {
     assert(dev);
 
+#if MODULE_DISP_DEV_ASYNC
+    /* keep the order of the areas and the bus to one caller */
+    mutex_lock(&_busy);
+    dev->driver->map(dev, x1, x2, y1, y2, color);
+    mutex_unlock(&_busy);
+#else
     dev->driver->map(dev, x1, x2, y1, y2, color);
+#endif
 }
 
 uint16_t disp_dev_height(const disp_dev_t *dev)
@@ -12,6 +12,13 @@
  * @brief       Define the generic API of a display device
  * @experimental This API is experimental and in an early state - expect
  *               changes!
+ *
+ * With module `disp_dev_async`, disp_dev_map_async() hands the area to a
+ * thread of higher priority and returns. Drivers that sleep while their
+ * transfer runs, e.g. on SPI with DMA, leave the CPU to the caller, which can
+ * fill a second buffer meanwhile. The thread calls a callback when the
+ * transfer is done.
+ *
  * @{
  *
  * @author      Alexandre Abadie <alexandre.abadie@inria.fr>
@@ -28,6 +35,7 @@ extern "C" {
 #include <stdint.h>
 
 #include "board.h"
+#include "thread.h"
 
 #ifndef BACKLIGHT_ON
 #define BACKLIGHT_ON
@@ -37,6 +45,20 @@ extern "C" {
 #define BACKLIGHT_OFF
 #endif
 
+#ifndef DISP_DEV_ASYNC_PRIO
+/**
+ * @brief   Priority of the thread running disp_dev_map_async()
+ */
+#define DISP_DEV_ASYNC_PRIO         (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+#ifndef DISP_DEV_ASYNC_STACKSIZE
+/**
+ * @brief   Stack size of the thread running disp_dev_map_async()
+ */
+#define DISP_DEV_ASYNC_STACKSIZE    (THREAD_STACKSIZE_DEFAULT)
+#endif
+
 /**
  * @brief   Forward declaration for display device struct
  */
@@ -149,6 +171,42 @@ void disp_dev_map(const disp_dev_t *dev,
                   uint16_t x1, uint16_t x2, uint16_t y1, uint16_t y2,
                   const uint16_t *color);
 
+#if MODULE_DISP_DEV_ASYNC || DOXYGEN
+/**
+ * @brief   Signature of the callback of disp_dev_map_async()
+ *
+ * @param[in] arg   Argument given to disp_dev_map_async()
+ */
+typedef void (*disp_dev_map_cb_t)(void *arg);
+
+/**
+ * @brief   Map an area to display on the device without waiting
+ *
+ * Only one area is mapped at a time. If the previous one isn't done, this
+ * function waits for it. disp_dev_map() waits for the area as well.
+ *
+ * @param[in] dev   Pointer to the display device
+ * @param[in] x1    Left coordinate
+ * @param[in] x2    Right coordinate
+ * @param[in] y1    Top coordinate
+ * @param[in] y2    Bottom coordinate
+ * @param[in] color Array of color to map to the display, must stay valid
+ *                  until @p cb is called
+ * @param[in] cb    Called from the mapping thread when the area is mapped,
+ *                  may be NULL
+ * @param[in] arg   Argument of @p cb
+ */
+void disp_dev_map_async(const disp_dev_t *dev,
+                        uint16_t x1, uint16_t x2, uint16_t y1, uint16_t y2,
+                        const uint16_t *color, disp_dev_map_cb_t cb,
+                        void *arg);
+
+/**
+ * @brief   Wait until the area given to disp_dev_map_async() is mapped
+ */
+void disp_dev_map_wait(void);
+#endif
+
 /**
  * @brief   Get the height of the display device
  *
@@ -40,6 +40,13 @@ ifneq (,$(filter stdio_uart_rx,$(USEMODULE)))
   USEMODULE += stdio_uart
 endif
 
+ifneq (,$(filter stdio_uart_async,$(USEMODULE)))
+  USEMODULE += stdio_uart
+  USEMODULE += tsrb
+  # send from the TX interrupt where the driver can
+  FEATURES_OPTIONAL += periph_uart_nonblocking
+endif
+
 ifneq (,$(filter stdio_uart,$(USEMODULE)))
   FEATURES_REQUIRED_ANY += periph_uart|periph_lpuart
 endif
@@ -25,13 +25,45 @@ SUIT_VENDOR ?= "riot-os.org"
 SUIT_SEQNR ?= $(APP_VER)
 SUIT_CLASS ?= $(BOARD)
 
+# Publish patches against the slots of version SUIT_DELTA_VER instead of the
+# images, the device needs module suit_delta. A slot is written while the
+# other one runs, so slot 0 is diffed with the old slot 1 and vice versa.
+SUIT_DELTA_VER ?=
+SUIT_PAYLOADS = $(SLOT0_RIOT_BIN) $(SLOT1_RIOT_BIN)
+ifneq (,$(SUIT_DELTA_VER))
+  SUIT_PAYLOADS_UNCOMPRESSED = $(SUIT_PAYLOADS:%=%.delta)
+  SUIT_DELTA_FLAGS = --delta
+$(SLOT0_RIOT_BIN).delta: $(BINDIR_APP)-slot1.$(SUIT_DELTA_VER).riot.bin
+$(SLOT1_RIOT_BIN).delta: $(BINDIR_APP)-slot0.$(SUIT_DELTA_VER).riot.bin
+else
+  SUIT_PAYLOADS_UNCOMPRESSED = $(SUIT_PAYLOADS)
+endif
+
+# Publish the payloads compressed, the device needs module suit_decompress.
+# Only heatshrink is supported.
+SUIT_COMPRESS ?=
+ifeq (heatshrink,$(SUIT_COMPRESS))
+  SUIT_PAYLOADS_PUBLISHED = $(SUIT_PAYLOADS_UNCOMPRESSED:%=%.hs)
+  SUIT_COMPRESS_FLAGS = --compress $(SUIT_COMPRESS)
+else
+  SUIT_PAYLOADS_PUBLISHED = $(SUIT_PAYLOADS_UNCOMPRESSED)
+endif
+
+$(SUIT_PAYLOADS:%=%.delta): %.delta: %
+	$(Q)$(RIOTBASE)/dist/tools/suit/delta.py --stats -o $@ $(filter-out $<,$^) $<
+
+$(SUIT_PAYLOADS_UNCOMPRESSED:%=%.hs): %.hs: %
+	$(Q)$(RIOTBASE)/dist/tools/suit/heatshrink.py --stats -o $@ $<
+
 #
-$(SUIT_MANIFEST): $(SLOT0_RIOT_BIN) $(SLOT1_RIOT_BIN)
+$(SUIT_MANIFEST): $(SUIT_PAYLOADS)
 	$(Q)$(RIOTBASE)/dist/tools/suit/gen_manifest.py \
 	  --urlroot $(SUIT_COAP_ROOT) \
 	  --seqnr $(SUIT_SEQNR) \
 	  --uuid-vendor $(SUIT_VENDOR) \
 	  --uuid-class $(SUIT_CLASS) \
+	  $(SUIT_DELTA_FLAGS) \
+	  $(SUIT_COMPRESS_FLAGS) \
 	  -o $@.tmp \
 	  $(SLOT0_RIOT_BIN):$(SLOT0_OFFSET) \
 	  $(SLOT1_RIOT_BIN):$(SLOT1_OFFSET)
@@ -57,7 +89,7 @@ SUIT_MANIFESTS := $(SUIT_MANIFEST) \
 
 suit/manifest: $(SUIT_MANIFESTS)
 
-suit/publish: $(SUIT_MANIFESTS) $(SLOT0_RIOT_BIN) $(SLOT1_RIOT_BIN)
+suit/publish: $(SUIT_MANIFESTS) $(SUIT_PAYLOADS_PUBLISHED)
 	$(Q)mkdir -p $(SUIT_COAP_FSROOT)/$(SUIT_COAP_BASEPATH)
 	$(Q)cp $^ $(SUIT_COAP_FSROOT)/$(SUIT_COAP_BASEPATH)
 	$(Q)for file in $^; do \
@@ -43,6 +43,10 @@
 #define CONFIG_LVGL_TASK_HANDLER_DELAY_MS  (5)                 /* 5ms */
 #endif
 
+#ifndef CONFIG_LVGL_MERGE_OVERHEAD_PX
+#define CONFIG_LVGL_MERGE_OVERHEAD_PX      (64)                /* pixels */
+#endif
+
 #ifndef LVGL_THREAD_FLAG
 #define LVGL_THREAD_FLAG            (1 << 7)
 #endif
@@ -51,23 +55,152 @@ static kernel_pid_t _task_thread_pid;
 
 static lv_disp_buf_t disp_buf;
 static lv_color_t buf[LVGL_COLOR_BUF_SIZE];
+#if IS_USED(MODULE_DISP_DEV_ASYNC)
+/* lvgl renders into one buffer while the other one is sent */
+static lv_color_t buf2[LVGL_COLOR_BUF_SIZE];
+#endif
 
 static screen_dev_t *_screen_dev = NULL;
 
+#if IS_USED(MODULE_DISP_DEV_ASYNC)
+static void _disp_map_done(void *arg)
+{
+    lv_disp_flush_ready(arg);
+}
+
+/* called by lvgl while it waits for a buffer */
+static void _disp_wait(lv_disp_drv_t *drv)
+{
+    (void)drv;
+    disp_dev_map_wait();
+}
+#endif
+
 static void _disp_map(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
 {
     if (!_screen_dev->display) {
         return;
     }
 
+    LOG_DEBUG("[lvgl] flush display\n");
+
+#if IS_USED(MODULE_DISP_DEV_ASYNC)
+    disp_dev_map_async(_screen_dev->display,
+                       area->x1, area->x2, area->y1, area->y2,
+                       (const uint16_t *)color_p, _disp_map_done, drv);
+#else
     disp_dev_map(_screen_dev->display, area->x1, area->x2, area->y1, area->y2,
                  (const uint16_t *)color_p);
 
-    LOG_DEBUG("[lvgl] flush display\n");
-
     lv_disp_flush_ready(drv);
+#endif
+}
+
+#if !IS_ACTIVE(CONFIG_LVGL_NO_MERGE_AREAS)
+static uint32_t _area_size(const lv_area_t *area)
+{
+    return (uint32_t)(area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+}
+
+static bool _area_empty(const lv_area_t *area)
+{
+    return (area->x1 > area->x2) || (area->y1 > area->y2);
+}
+
+/* rest of area without its part ov, if that is a rectangle */
+static bool _area_cut(lv_area_t *rest, const lv_area_t *area,
+                      const lv_area_t *ov)
+{
+    *rest = *area;
+    if ((ov->x1 == area->x1) && (ov->x2 == area->x2)) {
+        if (ov->y1 == area->y1) {
+            rest->y1 = ov->y2 + 1;
+            return true;
+        }
+        if (ov->y2 == area->y2) {
+            rest->y2 = ov->y1 - 1;
+            return true;
+        }
+    }
+    if ((ov->y1 == area->y1) && (ov->y2 == area->y2)) {
+        if (ov->x1 == area->x1) {
+            rest->x1 = ov->x2 + 1;
+            return true;
+        }
+        if (ov->x2 == area->x2) {
+            rest->x2 = ov->x1 - 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* lvgl only joins areas if the joined one is smaller than both, so an
+ * overlap is rendered and sent twice, and so is every transfer's set up */
+static void _merge_areas(lv_disp_t *disp)
+{
+    lv_area_t *areas = disp->inv_areas;
+    uint8_t *joined = disp->inv_area_joined;
+
+    for (unsigned i = 0; i < disp->inv_p; i++) {
+        unsigned j = 0;
+
+        while (!joined[i] && (j < disp->inv_p)) {
+            if ((i == j) || joined[j]) {
+                j++;
+                continue;
+            }
+
+            lv_area_t *a = &areas[i];
+            lv_area_t *b = &areas[j];
+            lv_area_t join = {
+                .x1 = LV_MATH_MIN(a->x1, b->x1),
+                .y1 = LV_MATH_MIN(a->y1, b->y1),
+                .x2 = LV_MATH_MAX(a->x2, b->x2),
+                .y2 = LV_MATH_MAX(a->y2, b->y2),
+            };
+            lv_area_t ov = {
+                .x1 = LV_MATH_MAX(a->x1, b->x1),
+                .y1 = LV_MATH_MAX(a->y1, b->y1),
+                .x2 = LV_MATH_MIN(a->x2, b->x2),
+                .y2 = LV_MATH_MIN(a->y2, b->y2),
+            };
+            lv_area_t rest_a, rest_b;
+            bool cut_b = !_area_empty(&ov) && _area_cut(&rest_b, b, &ov);
+            bool cut_a = !_area_empty(&ov) && _area_cut(&rest_a, a, &ov);
+            /* cost of two transfers over one */
+            uint32_t apart = _area_size(a) + _area_size(b) +
+                             CONFIG_LVGL_MERGE_OVERHEAD_PX;
+
+            if (cut_a || cut_b) {
+                apart -= _area_size(&ov);
+            }
+            if (_area_size(&join) <= apart) {
+                *a = join;
+                joined[j] = 1;
+                /* compare the grown area with all others again */
+                j = 0;
+                continue;
+            }
+            if (cut_b) {
+                /* cut_a is done when i and j are swapped */
+                *b = rest_b;
+                if (_area_empty(b)) {
+                    joined[j] = 1;
+                }
+            }
+            j++;
+        }
+    }
 }
 
+static void _refr_task(lv_task_t *task)
+{
+    _merge_areas(task->user_data);
+    _lv_disp_refr_task(task);
+}
+#endif
+
 #if IS_USED(MODULE_TOUCH_DEV)
 /* adapted from https://github.com/lvgl/lvgl/tree/v6.1.2#add-littlevgl-to-your-project */
 static bool _touch_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
@@ -113,8 +246,21 @@ void lvgl_init(screen_dev_t *screen_dev)
 
     disp_drv.flush_cb = _disp_map;
     disp_drv.buffer = &disp_buf;
-    lv_disp_drv_register(&disp_drv);
+#if IS_USED(MODULE_DISP_DEV_ASYNC)
+    disp_drv.wait_cb = _disp_wait;
+#endif
+
+    lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+#if IS_USED(MODULE_DISP_DEV_ASYNC)
+    lv_disp_buf_init(&disp_buf, buf, buf2, LVGL_COLOR_BUF_SIZE);
+#else
     lv_disp_buf_init(&disp_buf, buf, NULL, LVGL_COLOR_BUF_SIZE);
+#endif
+#if !IS_ACTIVE(CONFIG_LVGL_NO_MERGE_AREAS)
+    disp->refr_task->task_cb = _refr_task;
+#else
+    (void)disp;
+#endif
 
 #if IS_USED(MODULE_TOUCH_DEV)
     if (screen_dev->touch) {
@@ -177,6 +177,55 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
                           (struct _sock_tl_ep *)remote, NETCONN_UDP);
 }
 
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_rx_msg_t *msgs,
+                       unsigned numof, uint32_t timeout)
+{
+    unsigned received = 0;
+
+    assert((sock != NULL) && (msgs != NULL) && (numof > 0));
+    while (received < numof) {
+        sock_udp_rx_msg_t *msg = &msgs[received];
+        ssize_t res = sock_udp_recv_aux(sock, msg->data, msg->max_len,
+                                        timeout, &msg->remote, msg->aux);
+
+        if (res < 0) {
+            if (received == 0) {
+                return res;
+            }
+            if (res == -ENOBUFS) {
+                /* datagram was dropped, try the next one */
+                continue;
+            }
+            break;
+        }
+        msg->len = res;
+        received++;
+        /* only take what is already in the receive mailbox of the netconn */
+        timeout = 0;
+    }
+    return received;
+}
+
+int sock_udp_send_many(sock_udp_t *sock, const sock_udp_tx_msg_t *msgs,
+                       unsigned numof)
+{
+    unsigned sent;
+
+    assert((msgs != NULL) && (numof > 0));
+    for (sent = 0; sent < numof; sent++) {
+        ssize_t res = sock_udp_send_aux(sock, msgs[sent].data, msgs[sent].len,
+                                        msgs[sent].remote, msgs[sent].aux);
+
+        if (res < 0) {
+            if (sent == 0) {
+                return res;
+            }
+            break;
+        }
+    }
+    return sent;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
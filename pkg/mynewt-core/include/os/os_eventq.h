@@ -226,6 +226,11 @@ static inline void os_eventq_run(struct os_eventq *evq)
  */
 static inline bool os_eventq_is_empty(struct os_eventq *evq)
 {
+#if IS_USED(MODULE_EVENT_MPSC)
+    if (evq->q.pending) {
+        return false;
+    }
+#endif
     return clist_count(&(evq->q.event_list)) == 0;
 }
 
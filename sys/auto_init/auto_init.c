@@ -58,6 +58,16 @@ void auto_init(void)
         extern void auto_init_event_thread(void);
         auto_init_event_thread();
     }
+    if (IS_USED(MODULE_LOG_BINARY)) {
+        LOG_DEBUG("Auto init log_binary.\n");
+        extern void log_binary_init(void);
+        log_binary_init();
+    }
+    if (IS_USED(MODULE_STDIO_UART_ASYNC)) {
+        LOG_DEBUG("Auto init stdio_uart_async.\n");
+        extern void stdio_uart_async_init(void);
+        stdio_uart_async_init();
+    }
     if (IS_USED(MODULE_SYS_BUS)) {
         LOG_DEBUG("Auto init system buses.\n");
         extern void auto_init_sys_bus(void);
@@ -292,6 +302,12 @@ void auto_init(void)
         }
     }
 
+    if (IS_USED(MODULE_DISP_DEV_ASYNC)) {
+        LOG_DEBUG("Auto init disp_dev_async.\n");
+        extern void disp_dev_async_init(void);
+        disp_dev_async_init();
+    }
+
     if (IS_USED(MODULE_AUTO_INIT_SCREEN)) {
         LOG_DEBUG("Auto init screen devices\n");
         extern void auto_init_screen(void);
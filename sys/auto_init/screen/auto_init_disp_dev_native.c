@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_auto_init
+ * @{
+ * @file
+ * @brief       initializes the native display device
+ *
+ * @}
+ */
+
+#include "log.h"
+
+#include "disp_dev.h"
+#include "disp_dev_native.h"
+
+static const disp_dev_native_params_t disp_dev_native_params = {
+    .fname = DISP_DEV_NATIVE_FILENAME,
+    .width = DISP_DEV_NATIVE_WIDTH,
+    .height = DISP_DEV_NATIVE_HEIGHT,
+    .pixel_ns = DISP_DEV_NATIVE_PIXEL_NS,
+};
+
+static disp_dev_native_t disp_dev_native_dev;
+static disp_dev_reg_t disp_dev_entry;
+
+void auto_init_disp_dev_native(void)
+{
+    LOG_DEBUG("[auto_init_screen] initializing disp_dev_native\n");
+    if (disp_dev_native_init(&disp_dev_native_dev,
+                             &disp_dev_native_params) < 0) {
+        LOG_ERROR("[auto_init_screen] error initializing disp_dev_native\n");
+        return;
+    }
+
+    disp_dev_entry.dev = &disp_dev_native_dev.dev;
+    disp_dev_entry.screen_id = DISP_DEV_NATIVE_SCREEN_ID;
+
+    /* add to disp_dev registry */
+    disp_dev_reg_add(&disp_dev_entry);
+}
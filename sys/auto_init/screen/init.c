@@ -29,6 +29,10 @@ void auto_init_screen(void)
             extern void auto_init_ili9341(void);
             auto_init_ili9341();
         }
+        if (IS_USED(MODULE_DISP_DEV_NATIVE)) {
+            extern void auto_init_disp_dev_native(void);
+            auto_init_disp_dev_native();
+        }
     }
 
     if (IS_USED(MODULE_TOUCH_DEV)) {
@@ -14,6 +14,12 @@
  * @file
  * @brief   Functions to encode and decode base64
  *
+ * Both directions are table driven: encoding looks up each 6 bit code in a
+ * 64 byte alphabet, decoding maps each input character through a 256 byte
+ * table. The decoder handles four characters at a time and only falls back
+ * to the character-by-character path (which skips whitespace, padding and
+ * other non-base64 symbols) when one of them is not a base64 code.
+ *
  * @author  Martin Landsmann <Martin.Landsmann@HAW-Hamburg.de>
  * @author  Marian Buschsieweke <marian.buschsieweke@ovgu.de>
  * @}
@@ -26,73 +32,109 @@
 #include "base64.h"
 #include "kernel_defines.h"
 
-#define BASE64_CAPITAL_UPPER_BOUND     (25)     /**< base64 'Z'           */
-#define BASE64_SMALL_UPPER_BOUND       (51)     /**< base64 'z'           */
-#define BASE64_NUMBER_UPPER_BOUND      (61)     /**< base64 '9'           */
-#define BASE64_PLUS                    (62)     /**< base64 '+'           */
-#define BASE64_MINUS                   (62)     /**< base64 '-'           */
-#define BASE64_SLASH                   (63)     /**< base64 '/'           */
-#define BASE64_UNDERLINE               (63)     /**< base64 '_'           */
 #define BASE64_EQUALS                  (0xFE)   /**< no base64 symbol '=' */
 #define BASE64_NOT_DEFINED             (0xFF)   /**< no base64 symbol     */
 
+/**
+ * @brief   Mask that is non-zero for any decode table entry that is not a
+ *          base64 code
+ */
+#define BASE64_INVALID_MASK            (0xC0)
+
+static const char _alphabet[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#if IS_ACTIVE(MODULE_BASE64URL)
+static const char _alphabet_url[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+#endif
+
 /*
- * returns the corresponding ascii symbol value for the given base64 code
+ * maps ascii symbols to base64 codes, both the standard and the URL safe
+ * alphabet are accepted
  */
-static char getsymbol(uint8_t code, bool urlsafe)
+static const uint8_t _codes[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3f,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+    0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const char *_get_alphabet(bool urlsafe)
 {
-    if (!IS_ACTIVE(MODULE_BASE64URL)) {
-        urlsafe = false;
+#if IS_ACTIVE(MODULE_BASE64URL)
+    if (urlsafe) {
+        return _alphabet_url;
     }
+#else
+    (void)urlsafe;
+#endif
+    return _alphabet;
+}
 
-    if (urlsafe && code == BASE64_UNDERLINE) {
-        return '_';
-    }
+static void encode_three_bytes(uint8_t *dest, const uint8_t *src,
+                               const char *alphabet)
+{
+    uint32_t word = ((uint32_t)src[0] << 16) | ((uint32_t)src[1] << 8) | src[2];
 
-    if (urlsafe && code == BASE64_MINUS) {
-        return '-';
-    }
+    dest[0] = alphabet[word >> 18];
+    dest[1] = alphabet[(word >> 12) & 0x3f];
+    dest[2] = alphabet[(word >> 6) & 0x3f];
+    dest[3] = alphabet[word & 0x3f];
+}
 
-    if (!urlsafe && code == BASE64_SLASH) {
-        return '/';
+static uint8_t *encode_blocks(uint8_t *out, const uint8_t *in, size_t blocks,
+                              const char *alphabet)
+{
+    while (blocks--) {
+        encode_three_bytes(out, in, alphabet);
+        out += 4;
+        in += 3;
     }
 
-    if (!urlsafe && code == BASE64_PLUS) {
-        return '+';
-    }
+    return out;
+}
 
-    if (code <= BASE64_CAPITAL_UPPER_BOUND) {
-        return (code + 'A');
-    }
+/* encodes the final one or two bytes, returns the number of chars written */
+static size_t encode_tail(uint8_t *out, const uint8_t *in, size_t len,
+                          bool urlsafe)
+{
+    uint8_t tmp[3] = { in[0], (len > 1) ? in[1] : 0, 0 };
 
-    if (code <= BASE64_SMALL_UPPER_BOUND) {
-        return (code + ('z' - BASE64_SMALL_UPPER_BOUND));
-    }
+    encode_three_bytes(out, tmp, _get_alphabet(urlsafe));
 
-    if (code <= BASE64_NUMBER_UPPER_BOUND) {
-        return (code + ('9' - BASE64_NUMBER_UPPER_BOUND));
+    /* padding is not required for urlsafe application */
+    if (urlsafe) {
+        return len + 1;
     }
 
-    return (char)BASE64_NOT_DEFINED;
-}
+    /* Replace the output chars with "=" to signal that the corresponding
+     * input bytes didn't exist */
+    out[3] = '=';
+    if (len == 1) {
+        out[2] = '=';
+    }
 
-static void encode_three_bytes(uint8_t *dest,
-                               uint8_t b1, uint8_t b2, uint8_t b3,
-                               bool urlsafe)
-{
-    dest[0] = getsymbol(b1 >> 2, urlsafe);
-    dest[1] = getsymbol(((b1 & 0x03) << 4) | (b2 >> 4), urlsafe);
-    dest[2] = getsymbol(((b2 & 0x0f) << 2) | (b3 >> 6), urlsafe);
-    dest[3] = getsymbol(b3 & 0x3f, urlsafe);
+    return 4;
 }
 
 static int base64_encode_base(const void *data_in, size_t data_in_size,
                               void *base64_out, size_t *base64_out_size,
                               bool urlsafe)
 {
-    const uint8_t padding = urlsafe ? 0 : '=';
     const uint8_t *in = data_in;
-    const uint8_t *end = in + data_in_size;
     uint8_t *out = base64_out;
     size_t required_size = base64_estimate_encode_size(data_in_size);
 
@@ -114,43 +156,15 @@ static int base64_encode_base(const void *data_in, size_t data_in_size,
         return BASE64_ERROR_BUFFER_OUT;
     }
 
-    *base64_out_size = required_size;
-
-    while (in < end - 2) {
-        encode_three_bytes(out, in[0], in[1], in[2], urlsafe);
-        out += 4;
-        in += 3;
-    }
-
-    if (in == end) {
-        /* data_in_size is multiple of 3, we're done */
-        return BASE64_SUCCESS;
-    }
-
-    if (in + 1 == end) {
-        /* One byte still left to decode, set other two input bytes to zero */
-        encode_three_bytes(out, in[0], 0, 0, urlsafe);
-        /* Replace last two bytes with "=" to signal corresponding input bytes
-         * didn't exist */
-        out[2] = out[3] = padding;
+    size_t blocks = data_in_size / 3;
+    size_t rest = data_in_size - blocks * 3;
 
-        /* padding is not required for urlsafe application */
-        if (urlsafe) {
-            *base64_out_size -= 2;
-        }
-        return BASE64_SUCCESS;
-    }
-
-    /* Final case: 2 bytes remain for encoding, use zero as third input */
-    encode_three_bytes(out, in[0], in[1], 0, urlsafe);
-    /* Replace last output with "=" to signal corresponding input byte didn't exit */
-    out[3] = padding;
-
-    /* padding is not required for urlsafe application */
-    if (urlsafe) {
-        *base64_out_size -= 1;
+    out = encode_blocks(out, in, blocks, _get_alphabet(urlsafe));
+    if (rest) {
+        out += encode_tail(out, in + blocks * 3, rest, urlsafe);
     }
 
+    *base64_out_size = (uintptr_t)out - (uintptr_t)base64_out;
     return BASE64_SUCCESS;
 }
 
@@ -168,51 +182,77 @@ int base64url_encode(const void *data_in, size_t data_in_size,
 }
 #endif
 
-/*
- *  returns the corresponding base64 code for the given ascii symbol
- */
-static uint8_t getcode(char symbol)
+void base64_encoder_init(base64_encoder_t *enc, bool urlsafe)
 {
-    if (symbol == '/') {
-        return BASE64_SLASH;
-    }
+    enc->len = 0;
+    enc->urlsafe = IS_ACTIVE(MODULE_BASE64URL) && urlsafe;
+}
 
-    if (symbol == '_') {
-        return BASE64_UNDERLINE;
-    }
+int base64_encoder_update(base64_encoder_t *enc, const void *data_in,
+                          size_t data_in_size, void *base64_out,
+                          size_t *base64_out_size)
+{
+    const uint8_t *in = data_in;
+    uint8_t *out = base64_out;
+    const char *alphabet = _get_alphabet(enc->urlsafe);
+    size_t required_size = 4 * ((enc->len + data_in_size) / 3);
 
-    if (symbol == '+') {
-        return BASE64_PLUS;
+    if ((in == NULL) && data_in_size) {
+        return BASE64_ERROR_DATA_IN;
     }
 
-    if (symbol == '-') {
-        return BASE64_MINUS;
+    if (*base64_out_size < required_size) {
+        *base64_out_size = required_size;
+        return BASE64_ERROR_BUFFER_OUT_SIZE;
     }
 
-    if (symbol == '=') {
-        /* indicates a padded base64 end */
-        return BASE64_EQUALS;
+    if ((out == NULL) && required_size) {
+        return BASE64_ERROR_BUFFER_OUT;
     }
 
-    if (symbol < '0') {
-        /* indicates that the given symbol is not base64 and should be ignored */
-        return BASE64_NOT_DEFINED;
+    /* complete a block left over from the previous call first */
+    if (enc->len && (enc->len + data_in_size >= 3)) {
+        while (enc->len < 3) {
+            enc->buf[enc->len++] = *in++;
+            data_in_size--;
+        }
+        encode_three_bytes(out, enc->buf, alphabet);
+        out += 4;
+        enc->len = 0;
     }
 
-    if (symbol <= '9' && symbol >= '0') {
-        return (symbol + (BASE64_NUMBER_UPPER_BOUND - '9'));
+    size_t blocks = data_in_size / 3;
+    out = encode_blocks(out, in, blocks, alphabet);
+    in += blocks * 3;
+    data_in_size -= blocks * 3;
+
+    while (data_in_size--) {
+        enc->buf[enc->len++] = *in++;
     }
 
-    if (symbol <= 'Z' && symbol >= 'A') {
-        return (symbol - 'A');
+    *base64_out_size = required_size;
+    return BASE64_SUCCESS;
+}
+
+int base64_encoder_finish(base64_encoder_t *enc, void *base64_out,
+                          size_t *base64_out_size)
+{
+    size_t required_size = enc->len ? 4 : 0;
+
+    if (*base64_out_size < required_size) {
+        *base64_out_size = required_size;
+        return BASE64_ERROR_BUFFER_OUT_SIZE;
     }
 
-    if (symbol <= 'z' && symbol >= 'a') {
-        return (symbol + (BASE64_SMALL_UPPER_BOUND - 'z'));
+    if ((base64_out == NULL) && required_size) {
+        return BASE64_ERROR_BUFFER_OUT;
     }
 
-    /* indicates that the given symbol is not base64 and should be ignored */
-    return BASE64_NOT_DEFINED;
+    *base64_out_size = enc->len ? encode_tail(base64_out, enc->buf, enc->len,
+                                              enc->urlsafe)
+                                : 0;
+    enc->len = 0;
+    return BASE64_SUCCESS;
 }
 
 static void decode_four_codes(uint8_t *out, const uint8_t *src)
@@ -222,6 +262,78 @@ static void decode_four_codes(uint8_t *out, const uint8_t *src)
     out[2] = (src[2] << 6) | src[3];
 }
 
+/*
+ * Decodes as many complete groups of four codes as possible from @p in, using
+ * and updating the partial group in @p codes / @p fill. Invalid symbols (such
+ * as inserted newlines commonly used to improve readability) and padding are
+ * skipped. Returns the end of the written output.
+ */
+static uint8_t *decode_blocks(uint8_t *out, const uint8_t *in, size_t len,
+                              uint8_t *codes, uint8_t *fill)
+{
+    const uint8_t *end = in + len;
+    unsigned n = *fill;
+
+    while (in < end) {
+        /* fast path: four valid codes in a row at a group boundary */
+        if ((n == 0) && (end - in >= 4)) {
+            uint8_t c0 = _codes[in[0]];
+            uint8_t c1 = _codes[in[1]];
+            uint8_t c2 = _codes[in[2]];
+            uint8_t c3 = _codes[in[3]];
+            if (((c0 | c1 | c2 | c3) & BASE64_INVALID_MASK) == 0) {
+                out[0] = (c0 << 2) | (c1 >> 4);
+                out[1] = (c1 << 4) | (c2 >> 2);
+                out[2] = (c2 << 6) | c3;
+                out += 3;
+                in += 4;
+                continue;
+            }
+        }
+
+        uint8_t code = _codes[*in++];
+        if (code & BASE64_INVALID_MASK) {
+            continue;
+        }
+        codes[n++] = code;
+        if (n == 4) {
+            decode_four_codes(out, codes);
+            out += 3;
+            n = 0;
+        }
+    }
+
+    *fill = n;
+    return out;
+}
+
+/* decodes a final partial group, returns the number of bytes written */
+static int decode_tail(uint8_t *out, uint8_t *codes, unsigned fill)
+{
+    switch (fill) {
+        case 0:
+            /* no data in decode buffer -->nothing to do */
+            return 0;
+        case 1:
+            /* an input size of 4 * n + 1 cannot happen, (even when dropping
+             * the "=" chars) */
+            return BASE64_ERROR_DATA_IN_SIZE;
+        default:
+            /* Got two (three) base64 chars, or one (two) bytes of output
+             * data. Just fill with zero codes and ignore the additionally
+             * decoded bytes */
+            for (unsigned i = fill; i < 4; i++) {
+                codes[i] = 0;
+            }
+            uint8_t tmp[3];
+            decode_four_codes(tmp, codes);
+            for (unsigned i = 0; i < fill - 1; i++) {
+                out[i] = tmp[i];
+            }
+            return fill - 1;
+    }
+}
+
 int base64_decode(const void *base64_in, size_t base64_in_size,
                   void *data_out, size_t *data_out_size)
 {
@@ -242,55 +354,71 @@ int base64_decode(const void *base64_in, size_t base64_in_size,
         return BASE64_ERROR_BUFFER_OUT;
     }
 
-    const uint8_t *end = in + base64_in_size;
-    uint8_t decode_buf[4];
-
-    while (1) {
-        size_t decode_buf_fill = 0;
-        /* Try to load 4 codes into the decode buffer, skipping invalid symbols
-         * (such as inserted newlines commonly used to improve readability) */
-        do {
-            /* Reached end of input before 4 codes were loaded, handle each
-             * possible decode buffer fill level individually: */
-            if (in == end) {
-                switch (decode_buf_fill) {
-                    case 0:
-                        /* no data in decode buffer -->nothing to do */
-                        break;
-                    case 1:
-                        /* an input size of 4 * n + 1 cannot happen, (even when
-                         * dropping the "=" chars) */
-                        return BASE64_ERROR_DATA_IN_SIZE;
-                    case 2:
-                        /* Got two base64 chars, or one byte of output data.
-                         * The just fill with zero codes and ignore the two
-                         * additionally decoded bytes */
-                        decode_buf[2] = decode_buf[3] = 0;
-                        decode_four_codes(out, decode_buf);
-                        out += 1;
-                        break;
-                    case 3:
-                        /* Got three base64 chars or 2 bytes of output data.
-                         * Again, just fill with zero bytes and ignore the
-                         * additionally decoded byte */
-                        decode_buf[3] = 0;
-                        decode_four_codes(out, decode_buf);
-                        out += 2;
-                        break;
-                }
-                *data_out_size = (uintptr_t)out - (uintptr_t)data_out;
-                return BASE64_SUCCESS;
-            }
-            switch (decode_buf[decode_buf_fill] = getcode(*in++)) {
-                case BASE64_NOT_DEFINED:
-                case BASE64_EQUALS:
-                    continue;
-            }
-            decode_buf_fill++;
-        }
-        while (decode_buf_fill < 4);
+    uint8_t codes[4];
+    uint8_t fill = 0;
 
-        decode_four_codes(out, decode_buf);
-        out += 3;
+    out = decode_blocks(out, in, base64_in_size, codes, &fill);
+
+    int res = decode_tail(out, codes, fill);
+    if (res < 0) {
+        return res;
     }
+
+    *data_out_size = (uintptr_t)(out + res) - (uintptr_t)data_out;
+    return BASE64_SUCCESS;
+}
+
+void base64_decoder_init(base64_decoder_t *dec)
+{
+    dec->len = 0;
+}
+
+int base64_decoder_update(base64_decoder_t *dec, const void *base64_in,
+                          size_t base64_in_size, void *data_out,
+                          size_t *data_out_size)
+{
+    size_t required_size = ((dec->len + base64_in_size) / 4) * 3;
+
+    if ((base64_in == NULL) && base64_in_size) {
+        return BASE64_ERROR_DATA_IN;
+    }
+
+    if (*data_out_size < required_size) {
+        *data_out_size = required_size;
+        return BASE64_ERROR_BUFFER_OUT_SIZE;
+    }
+
+    if ((data_out == NULL) && required_size) {
+        return BASE64_ERROR_BUFFER_OUT;
+    }
+
+    uint8_t *out = decode_blocks(data_out, base64_in, base64_in_size,
+                                 dec->buf, &dec->len);
+
+    *data_out_size = (uintptr_t)out - (uintptr_t)data_out;
+    return BASE64_SUCCESS;
+}
+
+int base64_decoder_finish(base64_decoder_t *dec, void *data_out,
+                          size_t *data_out_size)
+{
+    size_t required_size = dec->len ? dec->len - 1 : 0;
+
+    if (*data_out_size < required_size) {
+        *data_out_size = required_size;
+        return BASE64_ERROR_BUFFER_OUT_SIZE;
+    }
+
+    if ((data_out == NULL) && required_size) {
+        return BASE64_ERROR_BUFFER_OUT;
+    }
+
+    int res = decode_tail(data_out, dec->buf, dec->len);
+    dec->len = 0;
+    if (res < 0) {
+        return res;
+    }
+
+    *data_out_size = res;
+    return BASE64_SUCCESS;
 }
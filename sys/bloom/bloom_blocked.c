@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_bloom_blocked
+ * @{
+ *
+ * @file
+ * @brief       Blocked and counting Bloom filter implementation
+ *
+ * The hash of an element is mixed first, as hash functions like djb2 or sdbm
+ * have weak high bits. The mixed value selects the block via multiply-shift
+ * range reduction. Mixing it once more provides the start position `a` and
+ * the odd stride `b` of the double hashing sequence `a + i * b` inside the
+ * block, independent of the block. As the number of positions per block is a
+ * power of two and `b` is odd, the k positions of an element are distinct.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "bloom_blocked.h"
+
+#define BLOCK_BITS      (CONFIG_BLOOM_BLOCK_SIZE * 8)
+#define BLOCK_COUNTERS  (CONFIG_BLOOM_BLOCK_SIZE * 2)
+#define COUNTER_MAX     (0xfU)
+
+typedef struct {
+    uint32_t *block;
+    uint32_t a;
+    uint32_t b;
+} _probe_t;
+
+static inline uint32_t _mix(uint32_t x)
+{
+    /* murmur3 finalizer */
+    x ^= x >> 16;
+    x *= 0x85ebca6b;
+    x ^= x >> 13;
+    x *= 0xc2b2ae35;
+    x ^= x >> 16;
+    return x;
+}
+
+static inline void _probe(const bloom_blocked_t *bloom, uint32_t hash,
+                          _probe_t *probe)
+{
+    uint32_t x = _mix(hash);
+    size_t idx = ((uint64_t)x * bloom->numof) >> 32;
+
+    x = _mix(x ^ 0x9e3779b9);
+
+    probe->block = &bloom->blocks[idx * BLOOM_BLOCK_WORDS];
+    probe->a = x;
+    probe->b = (x >> 16) | 1;
+}
+
+static inline uint32_t _hash(const bloom_blocked_t *bloom,
+                             const uint8_t *buf, size_t len)
+{
+    return bloom->hash(buf, len);
+}
+
+static void _init(bloom_blocked_t *bloom, uint32_t *blocks, size_t numof,
+                  unsigned k, hashfp_t hash)
+{
+    assert(numof > 0);
+    assert((CONFIG_BLOOM_BLOCK_SIZE == 32) || (CONFIG_BLOOM_BLOCK_SIZE == 64));
+
+    bloom->blocks = blocks;
+    bloom->numof = numof;
+    bloom->hash = hash;
+    bloom->k = k;
+    bloom_blocked_clear(bloom);
+}
+
+void bloom_blocked_init(bloom_blocked_t *bloom, uint32_t *blocks, size_t numof,
+                        unsigned k, hashfp_t hash)
+{
+    _init(bloom, blocks, numof, k, hash);
+}
+
+void bloom_blocked_clear(bloom_blocked_t *bloom)
+{
+    memset(bloom->blocks, 0, bloom->numof * CONFIG_BLOOM_BLOCK_SIZE);
+}
+
+void bloom_blocked_add(bloom_blocked_t *bloom, const uint8_t *buf, size_t len)
+{
+    _probe_t p;
+
+    _probe(bloom, _hash(bloom, buf, len), &p);
+    for (unsigned i = 0; i < bloom->k; i++, p.a += p.b) {
+        unsigned bit = p.a & (BLOCK_BITS - 1);
+        p.block[bit >> 5] |= 1UL << (bit & 0x1f);
+    }
+}
+
+static bool _check_bits(const _probe_t *probe, unsigned k)
+{
+    uint32_t a = probe->a;
+
+    for (unsigned i = 0; i < k; i++, a += probe->b) {
+        unsigned bit = a & (BLOCK_BITS - 1);
+        if (!(probe->block[bit >> 5] & (1UL << (bit & 0x1f)))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool bloom_blocked_check(const bloom_blocked_t *bloom,
+                         const uint8_t *buf, size_t len)
+{
+    _probe_t p;
+
+    _probe(bloom, _hash(bloom, buf, len), &p);
+    return _check_bits(&p, bloom->k);
+}
+
+size_t bloom_blocked_check_many(const bloom_blocked_t *bloom,
+                                const uint8_t *const bufs[],
+                                const size_t lens[], size_t numof, bool *res)
+{
+    _probe_t probes[CONFIG_BLOOM_BATCH_SIZE];
+    size_t found = 0;
+
+    while (numof) {
+        size_t n = (numof < CONFIG_BLOOM_BATCH_SIZE) ? numof
+                                                     : CONFIG_BLOOM_BATCH_SIZE;
+
+        /* hash the whole batch first, so the block loads are independent */
+        for (size_t i = 0; i < n; i++) {
+            _probe(bloom, _hash(bloom, bufs[i], lens[i]), &probes[i]);
+#ifdef __GNUC__
+            __builtin_prefetch(probes[i].block);
+#endif
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            res[i] = _check_bits(&probes[i], bloom->k);
+            found += res[i];
+        }
+
+        bufs += n;
+        lens += n;
+        res += n;
+        numof -= n;
+    }
+
+    return found;
+}
+
+void bloom_counting_init(bloom_counting_t *bloom, uint32_t *blocks,
+                         size_t numof, unsigned k, hashfp_t hash)
+{
+    _init(bloom, blocks, numof, k, hash);
+}
+
+static inline unsigned _counter_get(const uint32_t *block, unsigned idx)
+{
+    return (block[idx >> 3] >> ((idx & 7) * 4)) & COUNTER_MAX;
+}
+
+static inline void _counter_add(uint32_t *block, unsigned idx, int32_t val)
+{
+    block[idx >> 3] += (uint32_t)val << ((idx & 7) * 4);
+}
+
+void bloom_counting_add(bloom_counting_t *bloom, const uint8_t *buf, size_t len)
+{
+    _probe_t p;
+
+    _probe(bloom, _hash(bloom, buf, len), &p);
+    for (unsigned i = 0; i < bloom->k; i++, p.a += p.b) {
+        unsigned idx = p.a & (BLOCK_COUNTERS - 1);
+        if (_counter_get(p.block, idx) < COUNTER_MAX) {
+            _counter_add(p.block, idx, 1);
+        }
+    }
+}
+
+static bool _check_counters(const _probe_t *probe, unsigned k)
+{
+    uint32_t a = probe->a;
+
+    for (unsigned i = 0; i < k; i++, a += probe->b) {
+        if (!_counter_get(probe->block, a & (BLOCK_COUNTERS - 1))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool bloom_counting_remove(bloom_counting_t *bloom, const uint8_t *buf,
+                           size_t len)
+{
+    _probe_t p;
+
+    _probe(bloom, _hash(bloom, buf, len), &p);
+    if (!_check_counters(&p, bloom->k)) {
+        return false;
+    }
+
+    for (unsigned i = 0; i < bloom->k; i++, p.a += p.b) {
+        unsigned idx = p.a & (BLOCK_COUNTERS - 1);
+        /* a saturated counter no longer knows how many elements it counts */
+        if (_counter_get(p.block, idx) < COUNTER_MAX) {
+            _counter_add(p.block, idx, -1);
+        }
+    }
+
+    return true;
+}
+
+bool bloom_counting_check(const bloom_counting_t *bloom,
+                          const uint8_t *buf, size_t len)
+{
+    _probe_t p;
+
+    _probe(bloom, _hash(bloom, buf, len), &p);
+    return _check_counters(&p, bloom->k);
+}
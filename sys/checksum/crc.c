@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_checksum_crc
+ * @{
+ *
+ * @file
+ * @brief       Generic CRC engine implementation
+ *
+ * Reflected CRCs are kept right-aligned in the 32 bit register and processed
+ * LSB first, non-reflected CRCs are kept left-aligned and processed MSB first.
+ * This way all widths share the same code paths and tables.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "byteorder.h"
+#include "unaligned.h"
+
+#include "checksum/crc.h"
+
+const crc_params_t crc_params_crc8 = {
+    .poly = 0x07, .init = 0x00, .xorout = 0x00,
+    .width = 8, .reflected = false,
+};
+
+const crc_params_t crc_params_crc8_maxim = {
+    .poly = 0x31, .init = 0x00, .xorout = 0x00,
+    .width = 8, .reflected = true,
+};
+
+const crc_params_t crc_params_crc16_ccitt_false = {
+    .poly = 0x1021, .init = 0xffff, .xorout = 0x0000,
+    .width = 16, .reflected = false,
+};
+
+const crc_params_t crc_params_crc16_kermit = {
+    .poly = 0x1021, .init = 0x0000, .xorout = 0x0000,
+    .width = 16, .reflected = true,
+};
+
+const crc_params_t crc_params_crc16_modbus = {
+    .poly = 0x8005, .init = 0xffff, .xorout = 0x0000,
+    .width = 16, .reflected = true,
+};
+
+const crc_params_t crc_params_crc32 = {
+    .poly = 0x04c11db7, .init = 0xffffffff, .xorout = 0xffffffff,
+    .width = 32, .reflected = true,
+};
+
+const crc_params_t crc_params_crc32c = {
+    .poly = 0x1edc6f41, .init = 0xffffffff, .xorout = 0xffffffff,
+    .width = 32, .reflected = true,
+};
+
+static uint32_t _reflect(uint32_t val, unsigned width)
+{
+    uint32_t res = 0;
+
+    for (unsigned i = 0; i < width; i++) {
+        res = (res << 1) | (val & 1);
+        val >>= 1;
+    }
+
+    return res;
+}
+
+static uint32_t _poly(const crc_params_t *params)
+{
+    if (params->reflected) {
+        return _reflect(params->poly, params->width);
+    }
+    return params->poly << (32 - params->width);
+}
+
+/* feed the lowest (reflected) or highest (non-reflected) `bits` bits of the
+ * register through the polynomial */
+static uint32_t _shift(uint32_t crc, uint32_t poly, bool reflected,
+                       unsigned bits)
+{
+    while (bits--) {
+        if (reflected) {
+            crc = (crc >> 1) ^ (poly & (0 - (crc & 1)));
+        }
+        else {
+            crc = (crc << 1) ^ (poly & (0 - (crc >> 31)));
+        }
+    }
+
+    return crc;
+}
+
+static inline uint32_t _le32(const uint8_t *p)
+{
+    le_uint32_t tmp = { .u32 = unaligned_get_u32(p) };
+    return byteorder_ltohl(tmp);
+}
+
+void crc_table_generate(const crc_params_t *params, crc_mode_t mode,
+                        uint32_t *table)
+{
+    uint32_t poly = _poly(params);
+    bool ref = params->reflected;
+    unsigned slices;
+
+    switch (mode) {
+    case CRC_MODE_NIBBLE:
+        for (uint32_t i = 0; i < 16; i++) {
+            table[i] = _shift(ref ? i : (i << 28), poly, ref, 4);
+        }
+        return;
+    case CRC_MODE_TABLE:
+        slices = 1;
+        break;
+    case CRC_MODE_SLICE4:
+        slices = 4;
+        break;
+    case CRC_MODE_SLICE8:
+        slices = 8;
+        break;
+    default:
+        return;
+    }
+
+    for (uint32_t i = 0; i < 256; i++) {
+        table[i] = _shift(ref ? i : (i << 24), poly, ref, 8);
+    }
+
+    /* table k holds the CRC of a byte followed by k zero bytes */
+    for (unsigned k = 1; k < slices; k++) {
+        const uint32_t *prev = &table[(k - 1) * 256];
+        uint32_t *cur = &table[k * 256];
+        for (unsigned i = 0; i < 256; i++) {
+            if (ref) {
+                cur[i] = (prev[i] >> 8) ^ table[prev[i] & 0xff];
+            }
+            else {
+                cur[i] = (prev[i] << 8) ^ table[prev[i] >> 24];
+            }
+        }
+    }
+}
+
+void crc_engine_init(crc_engine_t *engine, const crc_params_t *params,
+                     crc_mode_t mode, const uint32_t *table)
+{
+    engine->params = params;
+    engine->table = table;
+    engine->poly = _poly(params);
+    engine->mode = mode;
+}
+
+uint32_t crc_start(const crc_engine_t *engine)
+{
+    const crc_params_t *params = engine->params;
+
+    if (params->reflected) {
+        return _reflect(params->init, params->width);
+    }
+    return params->init << (32 - params->width);
+}
+
+uint32_t crc_finish(const crc_engine_t *engine, uint32_t crc)
+{
+    const crc_params_t *params = engine->params;
+
+    if (!params->reflected) {
+        crc >>= 32 - params->width;
+    }
+    return crc ^ params->xorout;
+}
+
+static uint32_t _update_ref(const crc_engine_t *engine, uint32_t crc,
+                            const uint8_t *buf, size_t len)
+{
+    const uint32_t *t = engine->table;
+
+    switch (engine->mode) {
+    case CRC_MODE_SLICE8:
+        for (; len >= 8; len -= 8, buf += 8) {
+            uint32_t lo = crc ^ _le32(buf);
+            uint32_t hi = _le32(buf + 4);
+            crc = t[7 * 256 + (lo & 0xff)] ^ t[6 * 256 + ((lo >> 8) & 0xff)] ^
+                  t[5 * 256 + ((lo >> 16) & 0xff)] ^ t[4 * 256 + (lo >> 24)] ^
+                  t[3 * 256 + (hi & 0xff)] ^ t[2 * 256 + ((hi >> 8) & 0xff)] ^
+                  t[1 * 256 + ((hi >> 16) & 0xff)] ^ t[hi >> 24];
+        }
+        break;
+    case CRC_MODE_SLICE4:
+        for (; len >= 4; len -= 4, buf += 4) {
+            crc ^= _le32(buf);
+            crc = t[3 * 256 + (crc & 0xff)] ^ t[2 * 256 + ((crc >> 8) & 0xff)] ^
+                  t[1 * 256 + ((crc >> 16) & 0xff)] ^ t[crc >> 24];
+        }
+        break;
+    case CRC_MODE_NIBBLE:
+        while (len--) {
+            crc ^= *buf++;
+            crc = (crc >> 4) ^ t[crc & 0xf];
+            crc = (crc >> 4) ^ t[crc & 0xf];
+        }
+        return crc;
+    case CRC_MODE_BITWISE:
+        while (len--) {
+            crc = _shift(crc ^ *buf++, engine->poly, true, 8);
+        }
+        return crc;
+    default:
+        break;
+    }
+
+    /* byte-wise table lookup, also used for the tail of the slicing modes */
+    while (len--) {
+        crc = (crc >> 8) ^ t[(crc ^ *buf++) & 0xff];
+    }
+
+    return crc;
+}
+
+static uint32_t _update_norm(const crc_engine_t *engine, uint32_t crc,
+                             const uint8_t *buf, size_t len)
+{
+    const uint32_t *t = engine->table;
+
+    switch (engine->mode) {
+    case CRC_MODE_SLICE8:
+        for (; len >= 8; len -= 8, buf += 8) {
+            uint32_t hi = crc ^ byteorder_bebuftohl(buf);
+            uint32_t lo = byteorder_bebuftohl(buf + 4);
+            crc = t[7 * 256 + (hi >> 24)] ^ t[6 * 256 + ((hi >> 16) & 0xff)] ^
+                  t[5 * 256 + ((hi >> 8) & 0xff)] ^ t[4 * 256 + (hi & 0xff)] ^
+                  t[3 * 256 + (lo >> 24)] ^ t[2 * 256 + ((lo >> 16) & 0xff)] ^
+                  t[1 * 256 + ((lo >> 8) & 0xff)] ^ t[lo & 0xff];
+        }
+        break;
+    case CRC_MODE_SLICE4:
+        for (; len >= 4; len -= 4, buf += 4) {
+            crc ^= byteorder_bebuftohl(buf);
+            crc = t[3 * 256 + (crc >> 24)] ^ t[2 * 256 + ((crc >> 16) & 0xff)] ^
+                  t[1 * 256 + ((crc >> 8) & 0xff)] ^ t[crc & 0xff];
+        }
+        break;
+    case CRC_MODE_NIBBLE:
+        while (len--) {
+            crc ^= (uint32_t)*buf++ << 24;
+            crc = (crc << 4) ^ t[crc >> 28];
+            crc = (crc << 4) ^ t[crc >> 28];
+        }
+        return crc;
+    case CRC_MODE_BITWISE:
+        while (len--) {
+            crc = _shift(crc ^ ((uint32_t)*buf++ << 24), engine->poly, false, 8);
+        }
+        return crc;
+    default:
+        break;
+    }
+
+    while (len--) {
+        crc = (crc << 8) ^ t[(crc >> 24) ^ *buf++];
+    }
+
+    return crc;
+}
+
+uint32_t crc_update(const crc_engine_t *engine, uint32_t crc,
+                    const void *buf, size_t len)
+{
+    if (engine->params->reflected) {
+        return _update_ref(engine, crc, buf, len);
+    }
+    return _update_norm(engine, crc, buf, len);
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include "congure/cocoa.h"
+
+/* number of retransmissions after which no weak RTT sample is taken */
+#define WEAK_MAX_RESENDS    (2U)
+
+static void _snd_init(congure_snd_t *cong, void *ctx);
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs);
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack);
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time);
+
+static const congure_snd_driver_t _driver = {
+    .init = _snd_init,
+    .inter_msg_interval = _snd_inter_msg_interval,
+    .report_msg_sent = _snd_report_msg_sent,
+    .report_msg_discarded = _snd_report_msg_discarded,
+    .report_msgs_timeout = _snd_report_msgs_timeout,
+    /* CoCoA does not distinguish between timeout and loss */
+    .report_msgs_lost = _snd_report_msgs_timeout,
+    .report_msg_acked = _snd_report_msg_acked,
+    .report_ecn_ce = _snd_report_ecn_ce,
+};
+
+static uint32_t _absdiff(uint32_t a, uint32_t b)
+{
+    return (a > b) ? a - b : b - a;
+}
+
+/* RFC 6298, section 2 with K = k, returns the RTO of the estimator */
+static uint32_t _estimate(uint32_t *srtt, uint32_t *rttvar, bool *valid,
+                          uint32_t rtt, unsigned k)
+{
+    if (!*valid) {
+        *srtt = rtt;
+        *rttvar = rtt / 2;
+        *valid = true;
+    }
+    else {
+        *rttvar = (3 * *rttvar + _absdiff(*srtt, rtt)) / 4;
+        *srtt = (7 * *srtt + rtt) / 8;
+    }
+    return *srtt + k * *rttvar;
+}
+
+static void _set_rto(congure_cocoa_snd_t *c, uint32_t rto, ztimer_now_t now)
+{
+    if (rto < CONGURE_COCOA_RTO_MIN_MS) {
+        rto = CONGURE_COCOA_RTO_MIN_MS;
+    }
+    else if (rto > CONGURE_COCOA_RTO_MAX_MS) {
+        rto = CONGURE_COCOA_RTO_MAX_MS;
+    }
+    c->rto = rto;
+    c->last_update = now;
+}
+
+void congure_cocoa_snd_setup(congure_cocoa_snd_t *c)
+{
+    c->super.driver = &_driver;
+}
+
+uint32_t congure_cocoa_snd_rto(congure_cocoa_snd_t *c, ztimer_now_t now)
+{
+    ztimer_now_t idle = now - c->last_update;
+
+    /* aging: move RTOs that were not updated for long towards the default */
+    if ((c->rto < 1000) && (idle > 16 * c->rto)) {
+        _set_rto(c, 2 * c->rto, now);
+    }
+    else if ((c->rto > 3000) && (idle > 4 * c->rto)) {
+        _set_rto(c, (CONGURE_COCOA_RTO_INIT_MS + c->rto) / 2, now);
+    }
+    return c->rto;
+}
+
+uint32_t congure_cocoa_snd_backoff(const congure_cocoa_snd_t *c, uint32_t rto)
+{
+    /* variable backoff factor */
+    if (c->rto < 1000) {
+        rto *= 3;
+    }
+    else if (c->rto > 3000) {
+        rto += rto / 2;
+    }
+    else {
+        rto *= 2;
+    }
+    return (rto > CONGURE_COCOA_RTO_MAX_MS) ? CONGURE_COCOA_RTO_MAX_MS : rto;
+}
+
+static void _snd_init(congure_snd_t *cong, void *ctx)
+{
+    congure_cocoa_snd_t *c = (congure_cocoa_snd_t *)cong;
+
+    c->super.ctx = ctx;
+    /* NSTART */
+    c->super.cwnd = 1;
+    c->rto = CONGURE_COCOA_RTO_INIT_MS;
+    c->last_update = 0;
+    c->strong_valid = false;
+    c->weak_valid = false;
+}
+
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size)
+{
+    (void)cong;
+    (void)msg_size;
+    /* no pacing */
+    return -1;
+}
+
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size)
+{
+    /* the RTO estimation does not depend on the number of messages in
+     * flight */
+    (void)cong;
+    (void)msg_size;
+}
+
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size)
+{
+    (void)cong;
+    (void)msg_size;
+}
+
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs)
+{
+    /* timeouts are handled by the backoff of the caller, an estimator is
+     * only updated once the exchange completed */
+    (void)cong;
+    (void)msgs;
+}
+
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack)
+{
+    congure_cocoa_snd_t *c = (congure_cocoa_snd_t *)cong;
+    uint32_t rtt = ack->recv_time - msg->send_time;
+
+    if (msg->resends == 0) {
+        uint32_t rto = _estimate(&c->strong_srtt, &c->strong_rttvar,
+                                 &c->strong_valid, rtt, 4);
+        _set_rto(c, (rto + c->rto) / 2, ack->recv_time);
+    }
+    else if (msg->resends <= WEAK_MAX_RESENDS) {
+        /* the response may belong to any of the transmissions, so the RTT
+         * is measured from the initial one */
+        uint32_t rto = _estimate(&c->weak_srtt, &c->weak_rttvar,
+                                 &c->weak_valid, rtt, 1);
+        _set_rto(c, (rto + 3 * c->rto) / 4, ack->recv_time);
+    }
+}
+
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time)
+{
+    (void)cong;
+    (void)time;
+}
+
+/** @} */
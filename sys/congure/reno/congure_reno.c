@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+
+#include "congure/reno.h"
+
+static void _snd_init(congure_snd_t *cong, void *ctx);
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs);
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs);
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack);
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time);
+
+static const congure_snd_driver_t _driver = {
+    .init = _snd_init,
+    .inter_msg_interval = _snd_inter_msg_interval,
+    .report_msg_sent = _snd_report_msg_sent,
+    .report_msg_discarded = _snd_report_msg_discarded,
+    .report_msgs_timeout = _snd_report_msgs_timeout,
+    .report_msgs_lost = _snd_report_msgs_lost,
+    .report_msg_acked = _snd_report_msg_acked,
+    .report_ecn_ce = _snd_report_ecn_ce,
+};
+
+static congure_wnd_size_t _add(congure_wnd_size_t a, unsigned b)
+{
+    return ((unsigned)(CONGURE_WND_SIZE_MAX - a) < b) ? CONGURE_WND_SIZE_MAX
+                                                      : a + b;
+}
+
+static congure_wnd_size_t _sub(congure_wnd_size_t a, unsigned b)
+{
+    return (a < b) ? 0 : a - b;
+}
+
+/* initial window, see RFC 5681, section 3.1 */
+static congure_wnd_size_t _init_wnd(congure_wnd_size_t mss)
+{
+    if (mss > 2190) {
+        return _add(mss, mss);
+    }
+    else if (mss > 1095) {
+        return 3 * mss;
+    }
+    return 4 * mss;
+}
+
+/* slow start threshold after a loss, see RFC 5681, equation (4) */
+static void _reduce_ssthresh(congure_reno_snd_t *c)
+{
+    congure_wnd_size_t half = c->in_flight / 2;
+    congure_wnd_size_t min = _add(c->mss, c->mss);
+
+    c->ssthresh = (half > min) ? half : min;
+}
+
+static void _leave_recovery(congure_reno_snd_t *c)
+{
+    c->in_recovery = false;
+    c->dup_acks = 0;
+    c->acked = 0;
+}
+
+void congure_reno_snd_setup(congure_reno_snd_t *c,
+                            const congure_reno_snd_consts_t *consts)
+{
+    assert(consts->init_mss > 0);
+    c->super.driver = &_driver;
+    c->consts = consts;
+}
+
+void congure_reno_snd_set_mss(congure_reno_snd_t *c, congure_wnd_size_t mss)
+{
+    assert(mss > 0);
+    c->mss = mss;
+    c->super.cwnd = _init_wnd(mss);
+}
+
+static void _snd_init(congure_snd_t *cong, void *ctx)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    c->super.ctx = ctx;
+    c->mss = c->consts->init_mss;
+    c->super.cwnd = _init_wnd(c->mss);
+    c->ssthresh = c->consts->init_ssthresh;
+    c->in_flight = 0;
+    c->recover = 0;
+    _leave_recovery(c);
+}
+
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size)
+{
+    (void)cong;
+    (void)msg_size;
+    /* no pacing */
+    return -1;
+}
+
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    c->in_flight = _add(c->in_flight, msg_size);
+}
+
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    c->in_flight = _sub(c->in_flight, msg_size);
+}
+
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    (void)msgs;
+    /* RFC 5681, section 3.1: restart with slow start */
+    _reduce_ssthresh(c);
+    c->super.cwnd = c->mss;
+    _leave_recovery(c);
+}
+
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    (void)msgs;
+    /* known losses without a timeout are handled like a fast retransmit,
+     * but the caller already took care of the retransmission */
+    if (!c->in_recovery) {
+        _reduce_ssthresh(c);
+        c->super.cwnd = c->ssthresh;
+        c->acked = 0;
+    }
+}
+
+static void _dup_ack(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    /* RFC 5681, section 2: only ACKs without data or SYN/FIN while data is
+     * outstanding count as duplicates */
+    if ((c->in_flight == 0) || (ack->size > 0) || !ack->clean) {
+        return;
+    }
+    if (c->dup_acks < UINT8_MAX) {
+        c->dup_acks++;
+    }
+
+    if (c->in_recovery) {
+        /* inflate the window by the segment that left the network */
+        c->super.cwnd = _add(c->super.cwnd, c->mss);
+    }
+    else if (c->dup_acks == c->consts->frthresh) {
+        /* RFC 6582, section 3.2, step 2: enter fast recovery */
+        _reduce_ssthresh(c);
+        c->recover = ack->id + c->in_flight;
+        c->super.cwnd = _add(c->ssthresh, c->consts->frthresh * c->mss);
+        c->in_recovery = true;
+        c->consts->fr(c);
+    }
+}
+
+static void _new_ack(congure_reno_snd_t *c, unsigned acked,
+                     congure_snd_ack_t *ack)
+{
+    c->in_flight = _sub(c->in_flight, acked);
+
+    if (c->in_recovery) {
+        if ((int32_t)(ack->id - c->recover) >= 0) {
+            /* RFC 6582, section 3.2, step 3: full acknowledgment */
+            congure_wnd_size_t flight = (c->in_flight > c->mss) ? c->in_flight
+                                                                : c->mss;
+            flight = _add(flight, c->mss);
+            c->super.cwnd = (c->ssthresh < flight) ? c->ssthresh : flight;
+            _leave_recovery(c);
+        }
+        else {
+            /* RFC 6582, section 3.2, step 4: partial acknowledgment, the
+             * next segment is lost as well */
+            c->super.cwnd = _sub(c->super.cwnd, acked);
+            if (acked >= c->mss) {
+                c->super.cwnd = _add(c->super.cwnd, c->mss);
+            }
+            c->consts->fr(c);
+        }
+        return;
+    }
+
+    c->dup_acks = 0;
+    if (c->super.cwnd < c->ssthresh) {
+        /* slow start, RFC 5681, equation (2) */
+        c->super.cwnd = _add(c->super.cwnd, (acked < c->mss) ? acked : c->mss);
+    }
+    else {
+        /* congestion avoidance with appropriate byte counting, RFC 5681,
+         * section 3.1: one MSS per congestion window acknowledged */
+        c->acked = _add(c->acked, acked);
+        if (c->acked >= c->super.cwnd) {
+            c->acked -= c->super.cwnd;
+            c->super.cwnd = _add(c->super.cwnd, c->mss);
+        }
+    }
+}
+
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    if (msg->size == 0) {
+        _dup_ack(c, ack);
+    }
+    else {
+        _new_ack(c, msg->size, ack);
+    }
+}
+
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    (void)time;
+    /* RFC 3168, section 6.1.2: react as to a loss, but without
+     * retransmission */
+    if (!c->in_recovery) {
+        _reduce_ssthresh(c);
+        c->super.cwnd = c->ssthresh;
+        c->acked = 0;
+    }
+}
+
+/** @} */
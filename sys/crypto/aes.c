@@ -69,7 +69,8 @@ static const cipher_interface_t aes_interface = {
     AES_BLOCK_SIZE,
     aes_init,
     aes_encrypt,
-    aes_decrypt
+    aes_decrypt,
+    NULL
 };
 
 const cipher_id_t CIPHER_AES_128 = &aes_interface;
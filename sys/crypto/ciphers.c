@@ -31,6 +31,27 @@ int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
     return cipher->interface->encrypt(&cipher->context, input, output);
 }
 
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks)
+{
+    const cipher_interface_t *iface = cipher->interface;
+
+    if (iface->encrypt_blocks) {
+        return iface->encrypt_blocks(&cipher->context, input, output, blocks);
+    }
+
+    for (; blocks; blocks--) {
+        int res = iface->encrypt(&cipher->context, input, output);
+        if (res != 1) {
+            return res;
+        }
+        input += iface->block_size;
+        output += iface->block_size;
+    }
+
+    return 1;
+}
+
 int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output)
 {
@@ -20,6 +20,26 @@ void crypto_block_inc_ctr(uint8_t block[16], int L)
     }
 }
 
+void crypto_xor(uint8_t *out, const uint8_t *a, const uint8_t *b, size_t len)
+{
+    if ((((uintptr_t)out | (uintptr_t)a | (uintptr_t)b) & (sizeof(uint32_t) - 1)) == 0) {
+        uint32_t *out32 = (uint32_t *)(uintptr_t)out;
+        const uint32_t *a32 = (const uint32_t *)(uintptr_t)a;
+        const uint32_t *b32 = (const uint32_t *)(uintptr_t)b;
+
+        for (; len >= sizeof(uint32_t); len -= sizeof(uint32_t)) {
+            *out32++ = *a32++ ^ *b32++;
+        }
+        out = (uint8_t *)out32;
+        a = (const uint8_t *)a32;
+        b = (const uint8_t *)b32;
+    }
+
+    while (len--) {
+        *out++ = *a++ ^ *b++;
+    }
+}
+
 int crypto_equals(const uint8_t *a, const uint8_t *b, size_t len)
 {
     uint8_t diff = 0;
@@ -19,10 +19,10 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <string.h>
 #include "debug.h"
 #include "crypto/helper.h"
-#include "crypto/modes/ctr.h"
 #include "crypto/modes/ccm.h"
 
 static inline int min(int a, int b)
@@ -172,6 +172,71 @@ static inline int _fits_in_nbytes(size_t value, uint8_t num_bytes)
     return (value >> shift) <= 1;
 }
 
+/*
+ * Encrypt or decrypt the payload in counter mode and compute the CBC-MAC
+ * over the plaintext in the same pass. When encrypting, the next counter
+ * block and the MAC state are handed to the cipher together. When
+ * decrypting, the plaintext of a block is only known after its key stream
+ * block has been computed, so the MAC of block n is computed together with
+ * the key stream of block n + 1.
+ */
+static int ccm_crypt(const cipher_t *cipher, uint8_t nonce_counter[16],
+                     uint8_t nonce_len, const uint8_t *input, size_t length,
+                     uint8_t *output, uint8_t mac[16], bool encrypt)
+{
+    /* uint32_t for word alignment, so crypto_xor() can go word-wise */
+    uint32_t blocks32[2 * CCM_BLOCK_SIZE / sizeof(uint32_t)];
+    uint8_t *stream_block = (uint8_t *)blocks32;
+    uint8_t *mac_block = stream_block + CCM_BLOCK_SIZE;
+    bool mac_pending = false;
+    size_t offset = 0;
+
+    while (offset < length) {
+        size_t n = (length - offset > CCM_BLOCK_SIZE) ? CCM_BLOCK_SIZE
+                                                      : length - offset;
+        size_t count = 1;
+
+        memcpy(stream_block, nonce_counter, CCM_BLOCK_SIZE);
+        crypto_block_inc_ctr(nonce_counter, CCM_BLOCK_SIZE - nonce_len);
+
+        if (encrypt) {
+            memcpy(mac_block, mac, CCM_BLOCK_SIZE);
+            crypto_xor(mac_block, mac_block, input + offset, n);
+            count = 2;
+        }
+        else if (mac_pending) {
+            memcpy(mac_block, mac, CCM_BLOCK_SIZE);
+            count = 2;
+        }
+
+        if (cipher_encrypt_blocks(cipher, stream_block, stream_block,
+                                  count) != 1) {
+            return CIPHER_ERR_ENC_FAILED;
+        }
+
+        if (count == 2) {
+            memcpy(mac, mac_block, CCM_BLOCK_SIZE);
+        }
+
+        crypto_xor(output + offset, input + offset, stream_block, n);
+
+        if (!encrypt) {
+            crypto_xor(mac, mac, output + offset, n);
+            mac_pending = true;
+        }
+
+        offset += n;
+    }
+
+    if (mac_pending) {
+        if (cipher_encrypt(cipher, mac, mac) != 1) {
+            return CIPHER_ERR_ENC_FAILED;
+        }
+    }
+
+    return offset;
+}
+
 int cipher_encrypt_ccm(const cipher_t *cipher,
                        const uint8_t *auth_data, uint32_t auth_data_len,
                        uint8_t mac_length, uint8_t length_encoding,
@@ -181,7 +246,7 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
 {
     int len = -1;
     uint8_t nonce_counter[16] = { 0 }, mac_iv[16] = { 0 }, mac[16] = { 0 },
-            stream_block[16] = { 0 }, zero_block[16] = { 0 }, block_size;
+            stream_block[16] = { 0 }, block_size;
 
     if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
         return CCM_ERR_INVALID_MAC_LENGTH;
@@ -206,25 +271,19 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
         return len;
     }
 
-    len = ccm_compute_cbc_mac(cipher, mac_iv, input, input_len, mac);
-    if (len < 0) {
-        return len;
-    }
-
     /* Compute first stream block */
     nonce_counter[0] = length_encoding - 1;
     memcpy(&nonce_counter[1], nonce,
            min(nonce_len, (size_t)15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size,
-                             zero_block, block_size, stream_block);
-    if (len < 0) {
-        return len;
+    if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
+        return CIPHER_ERR_ENC_FAILED;
     }
 
-    /* Encrypt message in counter mode  */
+    /* Encrypt message in counter mode and compute the MAC in one pass */
+    memcpy(mac, mac_iv, block_size);
     crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
-                             input_len, output);
+    len = ccm_crypt(cipher, nonce_counter, nonce_len, input, input_len,
+                    output, mac, true);
     if (len < 0) {
         return len;
     }
@@ -246,9 +305,7 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
 {
     int len = -1;
     uint8_t nonce_counter[16] = { 0 }, mac_iv[16] = { 0 }, mac[16] = { 0 },
-            mac_recv[16] = { 0 }, stream_block[16] = { 0 },
-            zero_block[16] = { 0 },
-            block_size;
+            mac_recv[16] = { 0 }, stream_block[16] = { 0 }, block_size;
     size_t plain_len;
 
     if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
@@ -260,26 +317,9 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
         return CCM_ERR_INVALID_LENGTH_ENCODING;
     }
 
-    /* Compute first stream block */
-    nonce_counter[0] = length_encoding - 1;
     block_size = cipher_get_block_size(cipher);
     assert(block_size == CCM_BLOCK_SIZE);
-    memcpy(&nonce_counter[1], nonce, min(nonce_len,
-                                         (size_t)15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size, zero_block,
-                             block_size, stream_block);
-    if (len < 0) {
-        return len;
-    }
-
-    /* Decrypt message in counter mode */
     plain_len = input_len - mac_length;
-    crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
-                             plain_len, plain);
-    if (len < 0) {
-        return len;
-    }
 
     /* Create B0, encrypt it (X1) and use it as mac_iv */
     if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
@@ -287,12 +327,25 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
         return CCM_ERR_INVALID_DATA_LENGTH;
     }
 
-    /* MAC calculation (T) with additional data and plaintext */
+    /* MAC calculation (T) with additional data */
     len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
     if (len < 0) {
         return len;
     }
-    len = ccm_compute_cbc_mac(cipher, mac_iv, plain, plain_len, mac);
+
+    /* Compute first stream block */
+    nonce_counter[0] = length_encoding - 1;
+    memcpy(&nonce_counter[1], nonce, min(nonce_len,
+                                         (size_t)15 - length_encoding));
+    if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
+
+    /* Decrypt message in counter mode and compute the MAC in one pass */
+    memcpy(mac, mac_iv, block_size);
+    crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+    len = ccm_crypt(cipher, nonce_counter, nonce_len, input, plain_len,
+                    plain, mac, false);
     if (len < 0) {
         return len;
     }
@@ -18,6 +18,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 
@@ -25,26 +27,44 @@ int cipher_encrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
                        uint8_t nonce_len, const uint8_t *input, size_t length,
                        uint8_t *output)
 {
+    /* uint32_t for word alignment, so crypto_xor() can go word-wise */
+    uint32_t stream[CONFIG_CIPHER_CTR_BATCH_BLOCKS * CIPHER_MAX_BLOCK_SIZE
+                    / sizeof(uint32_t)];
+    uint8_t *stream_block = (uint8_t *)stream;
+    uint8_t block_size = cipher_get_block_size(cipher);
     size_t offset = 0;
-    uint8_t stream_block[16] = { 0 }, block_size;
-
-    block_size = cipher_get_block_size(cipher);
-    do {
-        uint8_t block_size_input;
 
+    /* an empty input still consumes one counter block, as it always did */
+    if (length == 0) {
         if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
             return CIPHER_ERR_ENC_FAILED;
         }
+        crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+        return 0;
+    }
 
-        block_size_input = (length - offset > block_size) ?
-                           block_size : length - offset;
-        for (uint8_t i = 0; i < block_size_input; ++i) {
-            output[offset + i] = stream_block[i] ^ input[offset + i];
+    while (offset < length) {
+        size_t chunk = length - offset;
+        size_t blocks = (chunk + block_size - 1) / block_size;
+
+        if (blocks > CONFIG_CIPHER_CTR_BATCH_BLOCKS) {
+            blocks = CONFIG_CIPHER_CTR_BATCH_BLOCKS;
+            chunk = blocks * block_size;
         }
 
-        offset += block_size_input;
-        crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    } while (offset < length);
+        for (size_t i = 0; i < blocks; i++) {
+            memcpy(&stream_block[i * block_size], nonce_counter, block_size);
+            crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+        }
+
+        if (cipher_encrypt_blocks(cipher, stream_block, stream_block,
+                                  blocks) != 1) {
+            return CIPHER_ERR_ENC_FAILED;
+        }
+
+        crypto_xor(output + offset, input + offset, stream_block, chunk);
+        offset += chunk;
+    }
 
     return offset;
 }
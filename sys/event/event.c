@@ -22,24 +22,200 @@
  */
 
 #include <assert.h>
-
+#include <stdbool.h>
 #include <string.h>
 
 #include "event.h"
 #include "clist.h"
 #include "thread.h"
+#if IS_USED(MODULE_EVENT_STATS) || IS_USED(MODULE_EVENT_DEADLINE)
+#include "ztimer.h"
+#endif
 
 #if IS_USED(MODULE_XTIMER)
 #include "xtimer.h"
 #endif
 
+#if IS_USED(MODULE_EVENT_MPSC)
+/* next of the oldest event on a pending stack, so that a queued event never
+ * has a NULL next */
+static clist_node_t _end;
+#endif
+
+#if IS_USED(MODULE_EVENT_STATS)
+static void _stats_max(uint32_t *max, uint32_t val)
+{
+    uint32_t cur = __atomic_load_n(max, __ATOMIC_RELAXED);
+
+    while ((val > cur) &&
+           !__atomic_compare_exchange_n(max, &cur, val, true, __ATOMIC_RELAXED,
+                                        __ATOMIC_RELAXED)) {}
+}
+
+static void _stats_post(event_queue_t *queue, event_t *event)
+{
+    event->posted = ztimer_now(ZTIMER_USEC);
+    __atomic_fetch_add(&queue->stats.posts, 1, __ATOMIC_RELAXED);
+    _stats_max(&queue->stats.max_depth,
+               __atomic_add_fetch(&queue->stats.depth, 1, __ATOMIC_RELAXED));
+}
+
+static void _stats_get(event_queue_t *queue, event_t *event)
+{
+    __atomic_fetch_sub(&queue->stats.depth, 1, __ATOMIC_RELAXED);
+    _stats_max(&queue->stats.max_latency,
+               ztimer_now(ZTIMER_USEC) - event->posted);
+}
+#endif
+
+#if IS_USED(MODULE_EVENT_DEADLINE)
+static void _set_due(event_t *event)
+{
+    event->due = ztimer_now(ZTIMER_USEC) +
+                 (event->deadline ? event->deadline
+                                  : CONFIG_EVENT_DEADLINE_DEFAULT);
+}
+
+static bool _due_before(clist_node_t *a, clist_node_t *b)
+{
+    return (int32_t)(container_of(a, event_t, list_node)->due -
+                     container_of(b, event_t, list_node)->due) < 0;
+}
+
+/* insert in front of the first event due later, called with IRQs
+ * disabled */
+static void _enqueue(event_queue_t *queue, clist_node_t *node)
+{
+    clist_node_t *prev = queue->event_list.next;
+
+    /* most events are due after all queued ones */
+    if (!prev || !_due_before(node, prev)) {
+        clist_rpush(&queue->event_list, node);
+        return;
+    }
+    /* the tail is due later, so the search ends before it */
+    while (!_due_before(node, prev->next)) {
+        prev = prev->next;
+    }
+    node->next = prev->next;
+    prev->next = node;
+}
+#else
+static inline void _enqueue(event_queue_t *queue, clist_node_t *node)
+{
+    clist_rpush(&queue->event_list, node);
+}
+#endif
+
+#if IS_USED(MODULE_EVENT_MPSC)
+void event_post(event_queue_t *queue, event_t *event)
+{
+    assert(queue && event);
+
+    clist_node_t *node = &event->list_node;
+    clist_node_t *expected = NULL;
+
+    /* claim the event, only one context may push it */
+    if (!__atomic_compare_exchange_n(&node->next, &expected, &_end, false,
+                                     __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return;
+    }
+#if IS_USED(MODULE_EVENT_STATS)
+    _stats_post(queue, event);
+#endif
+#if IS_USED(MODULE_EVENT_DEADLINE)
+    _set_due(event);
+#endif
+
+    clist_node_t *head = __atomic_load_n(&queue->pending, __ATOMIC_RELAXED);
+
+    do {
+        node->next = head ? head : &_end;
+    } while (!__atomic_compare_exchange_n(&queue->pending, &head, node, true,
+                                          __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    /* the owner takes the whole stack, it only needs waking if it was
+     * empty */
+    thread_t *waiter = queue->waiter;
+
+    if (waiter && !head) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
+
+/* append the pending events to the queue, called with IRQs disabled */
+static void _splice(event_queue_t *queue)
+{
+    clist_node_t *node = __atomic_exchange_n(&queue->pending, NULL,
+                                             __ATOMIC_ACQUIRE);
+    clist_node_t *oldest = NULL;
+
+    /* the stack is newest first */
+    while (node && (node != &_end)) {
+        clist_node_t *next = node->next;
+
+        node->next = oldest;
+        oldest = node;
+        node = next;
+    }
+    while (oldest) {
+        clist_node_t *next = oldest->next;
+
+        _enqueue(queue, oldest);
+        oldest = next;
+    }
+}
+
+static bool _unlink_pending(event_queue_t *queue, clist_node_t *node)
+{
+    clist_node_t *prev = NULL;
+
+    for (clist_node_t *n = queue->pending; n && (n != &_end); n = n->next) {
+        if (n == node) {
+            if (prev) {
+                prev->next = n->next;
+            }
+            else {
+                queue->pending = (n->next == &_end) ? NULL : n->next;
+            }
+            return true;
+        }
+        prev = n;
+    }
+    return false;
+}
+
+void event_cancel(event_queue_t *queue, event_t *event)
+{
+    assert(queue);
+    assert(event);
+
+    unsigned state = irq_disable();
+    if (clist_remove(&queue->event_list, &event->list_node) ||
+        _unlink_pending(queue, &event->list_node)) {
+#if IS_USED(MODULE_EVENT_STATS)
+        queue->stats.depth--;
+#endif
+        event->list_node.next = NULL;
+    }
+    /* otherwise it is not queued, or a preempted event_post() is pushing it
+     * and still owns it */
+    irq_restore(state);
+}
+#else
 void event_post(event_queue_t *queue, event_t *event)
 {
     assert(queue && event);
 
     unsigned state = irq_disable();
     if (!event->list_node.next) {
-        clist_rpush(&queue->event_list, &event->list_node);
+#if IS_USED(MODULE_EVENT_DEADLINE)
+        _set_due(event);
+#endif
+        _enqueue(queue, &event->list_node);
+#if IS_USED(MODULE_EVENT_STATS)
+        _stats_post(queue, event);
+#endif
     }
     thread_t *waiter = queue->waiter;
     irq_restore(state);
@@ -49,39 +225,74 @@ void event_post(event_queue_t *queue, event_t *event)
     }
 }
 
+static inline void _splice(event_queue_t *queue)
+{
+    (void)queue;
+}
+
 void event_cancel(event_queue_t *queue, event_t *event)
 {
     assert(queue);
     assert(event);
 
     unsigned state = irq_disable();
+#if IS_USED(MODULE_EVENT_STATS)
+    if (clist_remove(&queue->event_list, &event->list_node)) {
+        queue->stats.depth--;
+    }
+#else
     clist_remove(&queue->event_list, &event->list_node);
+#endif
     event->list_node.next = NULL;
     irq_restore(state);
 }
+#endif
+
+/* take the next event of a queue, called with IRQs disabled */
+static event_t *_pop(event_queue_t *queue)
+{
+    /* with deadlines, events posted since may be due before the queued
+     * ones */
+    if (IS_USED(MODULE_EVENT_MPSC) &&
+        (IS_USED(MODULE_EVENT_DEADLINE) || !queue->event_list.next)) {
+        _splice(queue);
+    }
+    return container_of(clist_lpop(&queue->event_list), event_t, list_node);
+}
+
+static void _taken(event_queue_t *queue, event_t *event)
+{
+#if IS_USED(MODULE_EVENT_STATS)
+    _stats_get(queue, event);
+#else
+    (void)queue;
+#endif
+    event->list_node.next = NULL;
+}
 
 event_t *event_get(event_queue_t *queue)
 {
     unsigned state = irq_disable();
-    event_t *result = (event_t *) clist_lpop(&queue->event_list);
+    event_t *result = _pop(queue);
     irq_restore(state);
 
     if (result) {
-        result->list_node.next = NULL;
+        _taken(queue, result);
     }
     return result;
 }
 
-event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
+static event_t *_wait_multi(event_queue_t *queues, size_t n_queues,
+                            size_t *idx)
 {
     assert(queues && n_queues);
     event_t *result = NULL;
+    size_t i;
 
     do {
         unsigned state = irq_disable();
-        for (size_t i = 0; i < n_queues; i++) {
-            result = container_of(clist_lpop(&queues[i].event_list),
-                                  event_t, list_node);
+        for (i = 0; i < n_queues; i++) {
+            result = _pop(&queues[i]);
             if (result) {
                 break;
             }
@@ -92,10 +303,34 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
         }
     } while (result == NULL);
 
-    result->list_node.next = NULL;
+    _taken(&queues[i], result);
+    *idx = i;
     return result;
 }
 
+event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
+{
+    size_t idx;
+
+    return _wait_multi(queues, n_queues, &idx);
+}
+
+#if IS_USED(MODULE_EVENT_STATS)
+void event_stats_loop_multi(event_queue_t *queues, size_t n_queues)
+{
+    while (1) {
+        size_t idx;
+        event_t *event = _wait_multi(queues, n_queues, &idx);
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+
+        event->handler(event);
+        /* the handler may have freed the event, only the queue is used */
+        _stats_max(&queues[idx].stats.max_handler,
+                   ztimer_now(ZTIMER_USEC) - start);
+    }
+}
+#endif
+
 #if IS_USED(MODULE_XTIMER) || IS_USED(MODULE_ZTIMER)
 static event_t *_wait_timeout(event_queue_t *queue)
 {
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Event queue statistics
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "event.h"
+#include "irq.h"
+
+static event_queue_t *_queues;
+
+void event_queue_stats_register(event_queue_t *queue, const char *name)
+{
+    assert(queue && name);
+
+    queue->stats.name = name;
+    unsigned state = irq_disable();
+    queue->stats.next = _queues;
+    _queues = queue;
+    irq_restore(state);
+}
+
+void event_queue_stats_print(void)
+{
+    printf("%-12s %10s %6s %10s %12s %12s\n", "queue", "posts", "depth",
+           "max depth", "latency us", "handler us");
+    for (event_queue_t *q = _queues; q; q = q->stats.next) {
+        unsigned state = irq_disable();
+        event_queue_stats_t stats = q->stats;
+        irq_restore(state);
+
+        printf("%-12s %10" PRIu32 " %6" PRIu32 " %10" PRIu32 " %12" PRIu32
+               " %12" PRIu32 "\n", stats.name, stats.posts, stats.depth,
+               stats.max_depth, stats.max_latency, stats.max_handler);
+    }
+}
+
+void event_queue_stats_reset(void)
+{
+    for (event_queue_t *q = _queues; q; q = q->stats.next) {
+        unsigned state = irq_disable();
+        /* the depth is the number of queued events, not a statistic */
+        q->stats.posts = 0;
+        q->stats.max_depth = q->stats.depth;
+        q->stats.max_latency = 0;
+        q->stats.max_handler = 0;
+        irq_restore(state);
+    }
+}
@@ -130,4 +130,12 @@ void auto_init_event_thread(void)
     event_thread_init_multi(qs, qs_numof,
                             _evq_medium_stack, sizeof(_evq_medium_stack),
                             EVENT_THREAD_MEDIUM_PRIO);
+
+#if IS_USED(MODULE_EVENT_STATS)
+    /* the queues are initialized now, the last registered is listed
+     * first */
+    event_queue_stats_register(EVENT_PRIO_LOWEST, "lowest");
+    event_queue_stats_register(EVENT_PRIO_MEDIUM, "medium");
+    event_queue_stats_register(EVENT_PRIO_HIGHEST, "highest");
+#endif
 }
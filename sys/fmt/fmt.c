@@ -31,6 +31,7 @@
 ssize_t write(int fildes, const void *buf, size_t nbyte);
 #endif
 
+#include "architecture.h"
 #include "fmt.h"
 
 static const char _hex_chars[16] = "0123456789ABCDEF";
@@ -76,10 +77,50 @@ size_t fmt_byte_hex(char *out, uint8_t byte)
     return 2;
 }
 
+#if ARCHITECTURE_WORD_BITS >= 32
+/*
+ * SWAR helpers converting two bytes to four hex chars and back, one char per
+ * byte lane of a 32 bit word. None of the lane operations can carry into the
+ * neighbouring lane, as all intermediate values stay below 0x80.
+ */
+static void _two_bytes_hex(char *out, uint8_t b0, uint8_t b1)
+{
+    uint32_t x = ((uint32_t)b0 << 8) | b1;
+    uint32_t nib = ((x & 0xf000) << 12) | ((x & 0x0f00) << 8)
+                 | ((x & 0x00f0) << 4) | (x & 0x000f);
+    /* 1 in every lane holding a nibble >= 10 */
+    uint32_t alpha = ((nib + 0x06060606) >> 4) & 0x01010101;
+    uint32_t hex = nib + 0x30303030 + alpha * ('A' - '9' - 1);
+
+    out[0] = hex >> 24;
+    out[1] = hex >> 16;
+    out[2] = hex >> 8;
+    out[3] = hex;
+}
+
+static uint16_t _hex_two_bytes(const char *hex)
+{
+    uint32_t x = ((uint32_t)(uint8_t)hex[0] << 24)
+               | ((uint32_t)(uint8_t)hex[1] << 16)
+               | ((uint32_t)(uint8_t)hex[2] << 8)
+               | (uint8_t)hex[3];
+    /* letters have bit 6 set, their low nibble is 9 short of their value */
+    uint32_t nib = (x & 0x0f0f0f0f) + ((x >> 6) & 0x01010101) * 9;
+
+    return ((nib >> 12) & 0xf000) | ((nib >> 8) & 0x0f00)
+         | ((nib >> 4) & 0x00f0) | (nib & 0x000f);
+}
+#endif
+
 size_t fmt_bytes_hex(char *out, const uint8_t *ptr, size_t n)
 {
     size_t len = n * 2;
     if (out) {
+#if ARCHITECTURE_WORD_BITS >= 32
+        for (; n >= 2; n -= 2, ptr += 2, out += 4) {
+            _two_bytes_hex(out, ptr[0], ptr[1]);
+        }
+#endif
         while (n--) {
             out += fmt_byte_hex(out, *ptr++);
         }
@@ -130,20 +171,10 @@ size_t fmt_bytes_hex_reverse(char *out, const uint8_t *ptr, size_t n)
     return (n<<1);
 }
 
-static uint8_t _byte_mod25(uint8_t x)
-{
-    for (unsigned divisor = 200; divisor >= 25; divisor >>= 1) {
-        if (x >= divisor) {
-            x -= divisor;
-        }
-    }
-
-    return x;
-}
-
 static uint8_t _hex_nib(uint8_t nib)
 {
-    return _byte_mod25((nib & 0x1f) + 9);
+    /* letters have bit 6 set, their low nibble is 9 short of their value */
+    return (nib & 0x0f) + ((nib >> 6) & 1) * 9;
 }
 
 uint8_t fmt_hex_byte(const char *hex)
@@ -165,8 +196,16 @@ size_t fmt_hex_bytes(uint8_t *out, const char *hex)
         return final_len;
     }
 
-    for (size_t i = 0, j = 0; j < final_len; i += 2, j++) {
-        out[j] = fmt_hex_byte(hex + i);
+    size_t j = 0;
+#if ARCHITECTURE_WORD_BITS >= 32
+    for (; j + 1 < final_len; j += 2, hex += 4) {
+        uint16_t tmp = _hex_two_bytes(hex);
+        out[j] = tmp >> 8;
+        out[j + 1] = tmp;
+    }
+#endif
+    for (; j < final_len; j++, hex += 2) {
+        out[j] = fmt_hex_byte(hex);
     }
 
     return final_len;
@@ -46,11 +46,27 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <assert.h>
 
+#include "byteorder.h"
 #include "hashes/sha2xx_common.h"
 
+/* Use the SHA extensions on native if the host CPU provides them */
+#ifndef CONFIG_SHA2XX_SHANI
+#if defined(CPU_NATIVE) && (defined(__i386__) || defined(__x86_64__))
+#define CONFIG_SHA2XX_SHANI     1
+#else
+#define CONFIG_SHA2XX_SHANI     0
+#endif
+#endif
+
+#if CONFIG_SHA2XX_SHANI
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 #ifdef __BIG_ENDIAN__
 /* Copy a vector of big-endian uint32_t into a vector of bytes */
 #define be32enc_vect memcpy
@@ -96,6 +112,67 @@ static void be32enc_vect(void *dst_, const void *src_, size_t len)
 
 #endif /* __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__ */
 
+#ifdef MODULE_HASHES_SHA2XX_UNROLL
+/* One round; the caller rotates the roles of the working variables instead
+ * of moving them around */
+#define RND(a, b, c, d, e, f, g, h, i)                                  \
+    do {                                                                \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + K[i] + W[(i) & 15];     \
+        d += t0;                                                        \
+        h = t0 + S0(a) + Maj(a, b, c);                                  \
+    } while (0)
+
+/* Message schedule on a 16 word ring: W[i - 16] is replaced by W[i] */
+#define SCHED(i)                                                        \
+    (W[(i) & 15] += s1(W[((i) - 2) & 15]) + W[((i) - 7) & 15] +         \
+                    s0(W[((i) - 15) & 15]))
+
+/*
+ * SHA256 block compression function.  The 256-bit state is transformed via
+ * the 512-bit input block to produce a new state.
+ *
+ * Eight rounds are unrolled per loop iteration, so the working variables
+ * stay in registers and are never shifted.
+ */
+static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
+{
+    uint32_t W[16];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    be32dec_vect(W, block, 64);
+
+    for (int i = 0; i < 64; i += 8) {
+        if (i >= 16) {
+            SCHED(i);
+            SCHED(i + 1);
+            SCHED(i + 2);
+            SCHED(i + 3);
+            SCHED(i + 4);
+            SCHED(i + 5);
+            SCHED(i + 6);
+            SCHED(i + 7);
+        }
+        RND(a, b, c, d, e, f, g, h, i);
+        RND(h, a, b, c, d, e, f, g, i + 1);
+        RND(g, h, a, b, c, d, e, f, i + 2);
+        RND(f, g, h, a, b, c, d, e, i + 3);
+        RND(e, f, g, h, a, b, c, d, i + 4);
+        RND(d, e, f, g, h, a, b, c, i + 5);
+        RND(c, d, e, f, g, h, a, b, i + 6);
+        RND(b, c, d, e, f, g, h, a, i + 7);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+#else /* MODULE_HASHES_SHA2XX_UNROLL */
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
@@ -133,6 +210,151 @@ static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
         state[i] += S[i];
     }
 }
+#endif /* MODULE_HASHES_SHA2XX_UNROLL */
+
+#if CONFIG_SHA2XX_SHANI
+static bool _shani_available(void)
+{
+    static int8_t available = -1;
+
+    if (available < 0) {
+        unsigned eax, ebx, ecx, edx;
+        bool sse41 = __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_1);
+        bool sha = __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & bit_SHA);
+        available = sse41 && sha;
+    }
+
+    return available;
+}
+
+/* Round group: four rounds using the message words in m */
+#define SHANI_RND4(m, k)                                                    \
+    do {                                                                    \
+        __m128i t = _mm_add_epi32(m, _mm_loadu_si128((const __m128i *)&K[k])); \
+        cdgh = _mm_sha256rnds2_epu32(cdgh, abef, t);                        \
+        t = _mm_shuffle_epi32(t, 0x0e);                                     \
+        abef = _mm_sha256rnds2_epu32(abef, cdgh, t);                        \
+    } while (0)
+
+/* Message schedule: m0 = W[i - 16..i - 13] is replaced by W[i..i + 3] */
+#define SHANI_SCHED(m0, m1, m2, m3)                                         \
+    m0 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(m0, m1),   \
+                                            _mm_alignr_epi8(m3, m2, 4)), m3)
+
+/* SHA256 block compression function using the x86 SHA extensions */
+__attribute__((target("sha,sse4.1")))
+static void sha2xx_transform_shani(uint32_t *state, const unsigned char *data,
+                                   size_t blocks)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                         0x0405060700010203ULL);
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xb1);
+    __m128i cdgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1b);
+    __m128i abef = _mm_alignr_epi8(tmp, cdgh, 8);
+
+    cdgh = _mm_blend_epi16(cdgh, tmp, 0xf0);
+
+    for (; blocks; blocks--, data += 64) {
+        __m128i abef_save = abef, cdgh_save = cdgh;
+        __m128i m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 0)), bswap);
+        __m128i m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), bswap);
+        __m128i m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), bswap);
+        __m128i m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), bswap);
+
+        SHANI_RND4(m0, 0);
+        SHANI_RND4(m1, 4);
+        SHANI_RND4(m2, 8);
+        SHANI_RND4(m3, 12);
+        for (int i = 16; i < 64; i += 16) {
+            SHANI_SCHED(m0, m1, m2, m3);
+            SHANI_RND4(m0, i);
+            SHANI_SCHED(m1, m2, m3, m0);
+            SHANI_RND4(m1, i + 4);
+            SHANI_SCHED(m2, m3, m0, m1);
+            SHANI_RND4(m2, i + 8);
+            SHANI_SCHED(m3, m0, m1, m2);
+            SHANI_RND4(m3, i + 12);
+        }
+
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+    }
+
+    tmp = _mm_shuffle_epi32(abef, 0x1b);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128((__m128i *)&state[0], _mm_blend_epi16(tmp, cdgh, 0xf0));
+    _mm_storeu_si128((__m128i *)&state[4], _mm_alignr_epi8(cdgh, tmp, 8));
+}
+#endif /* CONFIG_SHA2XX_SHANI */
+
+/* Compress consecutive blocks, using hardware support if available */
+static void sha2xx_transform_blocks(uint32_t *state, const unsigned char *data,
+                                    size_t blocks)
+{
+#if CONFIG_SHA2XX_SHANI
+    if (_shani_available()) {
+        sha2xx_transform_shani(state, data, blocks);
+        return;
+    }
+#endif
+    for (; blocks; blocks--, data += 64) {
+        sha2xx_transform(state, data);
+    }
+}
+
+/*
+ * Compress one block for each of up to CONFIG_SHA2XX_MULTI_LANES independent
+ * states in lockstep. All lanes execute the same operation on different data
+ * one after another, which allows the compiler to vectorize the lane loops
+ * and lets superscalar CPUs overlap the otherwise serial round dependencies.
+ */
+static void sha2xx_transform_multi(uint32_t *const state[],
+                                   const unsigned char *const block[],
+                                   unsigned lanes)
+{
+    uint32_t W[16][CONFIG_SHA2XX_MULTI_LANES];
+    uint32_t S[8][CONFIG_SHA2XX_MULTI_LANES];
+
+    /* unused lanes compute lane 0 again, their result is discarded */
+    for (unsigned l = 0; l < CONFIG_SHA2XX_MULTI_LANES; l++) {
+        unsigned src = (l < lanes) ? l : 0;
+        for (int i = 0; i < 16; i++) {
+            W[i][l] = byteorder_bebuftohl(&block[src][4 * i]);
+        }
+        for (int i = 0; i < 8; i++) {
+            S[i][l] = state[src][i];
+        }
+    }
+
+    for (int i = 0; i < 64; i++) {
+        uint32_t *a = S[(64 - i) % 8], *b = S[(65 - i) % 8];
+        uint32_t *c = S[(66 - i) % 8], *d = S[(67 - i) % 8];
+        uint32_t *e = S[(68 - i) % 8], *f = S[(69 - i) % 8];
+        uint32_t *g = S[(70 - i) % 8], *h = S[(71 - i) % 8];
+        uint32_t *w = W[i & 15];
+
+        if (i >= 16) {
+            const uint32_t *w2 = W[(i - 2) & 15], *w7 = W[(i - 7) & 15];
+            const uint32_t *w15 = W[(i - 15) & 15];
+            for (unsigned l = 0; l < CONFIG_SHA2XX_MULTI_LANES; l++) {
+                w[l] += s1(w2[l]) + w7[l] + s0(w15[l]);
+            }
+        }
+
+        for (unsigned l = 0; l < CONFIG_SHA2XX_MULTI_LANES; l++) {
+            uint32_t t0 = h[l] + S1(e[l]) + Ch(e[l], f[l], g[l]) + w[l] + K[i];
+            uint32_t t1 = S0(a[l]) + Maj(a[l], b[l], c[l]);
+            d[l] += t0;
+            h[l] = t0 + t1;
+        }
+    }
+
+    for (unsigned l = 0; l < lanes; l++) {
+        for (int i = 0; i < 8; i++) {
+            state[l][i] += S[i][l];
+        }
+    }
+}
 
 static unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -161,12 +383,9 @@ void sha2xx_pad(sha2xx_context_t *ctx)
     sha2xx_update(ctx, len, 8);
 }
 
-/* Add bytes into the hash */
-void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
+/* Add len bytes to the number of processed bits */
+static void sha2xx_count(sha2xx_context_t *ctx, size_t len)
 {
-    /* Number of bytes left in the buffer from previous updates */
-    uint32_t r = (ctx->count[1] >> 3) & 0x3f;
-
     /* Convert the length into a number of bits */
     uint32_t bitlen1 = ((uint32_t) len) << 3;
     uint32_t bitlen0 = ((uint32_t) len) >> 29;
@@ -177,6 +396,15 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     }
 
     ctx->count[0] += bitlen0;
+}
+
+/* Add bytes into the hash */
+void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
+{
+    /* Number of bytes left in the buffer from previous updates */
+    uint32_t r = (ctx->count[1] >> 3) & 0x3f;
+
+    sha2xx_count(ctx, len);
 
     /* Handle the case where we don't need to perform any transforms */
     if (len < 64 - r) {
@@ -190,21 +418,96 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     const unsigned char *src = data;
 
     memcpy(&ctx->buf[r], src, 64 - r);
-    sha2xx_transform(ctx->state, ctx->buf);
+    sha2xx_transform_blocks(ctx->state, ctx->buf, 1);
     src += 64 - r;
     len -= 64 - r;
 
     /* Perform complete blocks */
-    while (len >= 64) {
-        sha2xx_transform(ctx->state, src);
-        src += 64;
-        len -= 64;
-    }
+    sha2xx_transform_blocks(ctx->state, src, len / 64);
+    src += len & ~(size_t)0x3f;
+    len &= 0x3f;
 
     /* Copy left over data into buffer */
     memcpy(ctx->buf, src, len);
 }
 
+/* Add the same number of bytes to up to CONFIG_SHA2XX_MULTI_LANES hashes */
+static void sha2xx_update_lanes(sha2xx_context_t *const ctx[],
+                                const void *const data[], size_t len,
+                                unsigned lanes)
+{
+    uint32_t *state[CONFIG_SHA2XX_MULTI_LANES];
+    const unsigned char *src[CONFIG_SHA2XX_MULTI_LANES];
+    const unsigned char *block[CONFIG_SHA2XX_MULTI_LANES];
+    uint32_t r = (ctx[0]->count[1] >> 3) & 0x3f;
+
+    /* lockstep processing requires the streams to be at the same offset
+     * within a block */
+    for (unsigned l = 1; l < lanes; l++) {
+        if (((ctx[l]->count[1] >> 3) & 0x3f) != r) {
+            for (l = 0; l < lanes; l++) {
+                sha2xx_update(ctx[l], data[l], len);
+            }
+            return;
+        }
+    }
+
+    if (len < 64 - r) {
+        for (unsigned l = 0; l < lanes; l++) {
+            sha2xx_update(ctx[l], data[l], len);
+        }
+        return;
+    }
+
+    /* Finish the current blocks */
+    for (unsigned l = 0; l < lanes; l++) {
+        sha2xx_count(ctx[l], len);
+        memcpy(&ctx[l]->buf[r], data[l], 64 - r);
+        state[l] = ctx[l]->state;
+        block[l] = ctx[l]->buf;
+        src[l] = (const unsigned char *)data[l] + 64 - r;
+    }
+    sha2xx_transform_multi(state, block, lanes);
+    len -= 64 - r;
+
+    /* Perform complete blocks */
+    for (; len >= 64; len -= 64) {
+        for (unsigned l = 0; l < lanes; l++) {
+            block[l] = src[l];
+            src[l] += 64;
+        }
+        sha2xx_transform_multi(state, block, lanes);
+    }
+
+    /* Copy left over data into buffers */
+    for (unsigned l = 0; l < lanes; l++) {
+        memcpy(ctx[l]->buf, src[l], len);
+    }
+}
+
+void sha2xx_update_multi(sha2xx_context_t *const ctx[],
+                         const void *const data[], size_t len, unsigned count)
+{
+#if CONFIG_SHA2XX_SHANI
+    /* a single stream on the SHA extensions beats scalar lockstep */
+    if (_shani_available()) {
+        for (unsigned i = 0; i < count; i++) {
+            sha2xx_update(ctx[i], data[i], len);
+        }
+        return;
+    }
+#endif
+
+    while (count) {
+        unsigned lanes = (count > CONFIG_SHA2XX_MULTI_LANES)
+                         ? CONFIG_SHA2XX_MULTI_LANES : count;
+        sha2xx_update_lanes(ctx, data, len, lanes);
+        ctx += lanes;
+        data += lanes;
+        count -= lanes;
+    }
+}
+
 /*
  * SHA-224 finalization.  Pads the input data, exports the hash value,
  * and clears the context state.
@@ -20,7 +20,9 @@
 #ifndef BASE64_H
 #define BASE64_H
 
+#include <stdbool.h>
 #include <stddef.h> /* for size_t */
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -123,6 +125,123 @@ int base64url_encode(const void *data_in, size_t data_in_size,
 int base64_decode(const void *base64_in, size_t base64_in_size,
                   void *data_out, size_t *data_out_size);
 
+/**
+ * @brief   Streaming base64 encoder context
+ */
+typedef struct {
+    uint8_t buf[3];     /**< input bytes not yet encoded */
+    uint8_t len;        /**< number of bytes in @ref base64_encoder_t::buf */
+    bool urlsafe;       /**< use the URL and Filename Safe Alphabet */
+} base64_encoder_t;
+
+/**
+ * @brief   Streaming base64 decoder context
+ */
+typedef struct {
+    uint8_t buf[4];     /**< base64 codes not yet decoded */
+    uint8_t len;        /**< number of codes in @ref base64_decoder_t::buf */
+} base64_decoder_t;
+
+/**
+ * @brief           Initializes a streaming base64 encoder
+ *
+ * @param[out]      enc               encoder context to initialize
+ * @param[in]       urlsafe           use the URL and Filename Safe Alphabet
+ *                                    without padding, requires the `base64url`
+ *                                    module
+ */
+void base64_encoder_init(base64_encoder_t *enc, bool urlsafe);
+
+/**
+ * @brief           Encodes the next chunk of data
+ *
+ * Only complete groups of three input bytes are encoded, up to two bytes are
+ * kept in @p enc until the next call to base64_encoder_update() or
+ * base64_encoder_finish().
+ *
+ * @param[in,out]   enc               encoder context
+ * @param[in]       data_in           pointer to the data to encode
+ * @param[in]       data_in_size      the size of `data_in`
+ * @param[out]      base64_out        pointer to store the encoded base64 chars
+ * @param[in,out]   base64_out_size   size of `base64_out`, overwritten with the
+ *                                    required size on BASE64_ERROR_BUFFER_OUT_SIZE
+ *                                    and with the number of chars written on
+ *                                    BASE64_SUCCESS
+ *
+ * @returns BASE64_SUCCESS on success,
+            BASE64_ERROR_BUFFER_OUT_SIZE on insufficient size of `base64_out`,
+            BASE64_ERROR_BUFFER_OUT if `base64_out` equals NULL,
+            BASE64_ERROR_DATA_IN if `data_in` equals NULL.
+ */
+int base64_encoder_update(base64_encoder_t *enc, const void *data_in,
+                          size_t data_in_size, void *base64_out,
+                          size_t *base64_out_size);
+
+/**
+ * @brief           Encodes the remaining bytes, including padding
+ *
+ * @param[in,out]   enc               encoder context
+ * @param[out]      base64_out        pointer to store the final (up to four)
+ *                                    base64 chars
+ * @param[in,out]   base64_out_size   size of `base64_out`, overwritten as for
+ *                                    base64_encoder_update()
+ *
+ * @returns BASE64_SUCCESS on success,
+            BASE64_ERROR_BUFFER_OUT_SIZE on insufficient size of `base64_out`,
+            BASE64_ERROR_BUFFER_OUT if `base64_out` equals NULL.
+ */
+int base64_encoder_finish(base64_encoder_t *enc, void *base64_out,
+                          size_t *base64_out_size);
+
+/**
+ * @brief           Initializes a streaming base64 decoder
+ *
+ * @param[out]      dec               decoder context to initialize
+ */
+void base64_decoder_init(base64_decoder_t *dec);
+
+/**
+ * @brief           Decodes the next chunk of base64 chars
+ *
+ * As with base64_decode(), both alphabets are accepted and non-base64 symbols
+ * are skipped. Only complete groups of four codes are decoded, up to three
+ * codes are kept in @p dec.
+ *
+ * @param[in,out]   dec               decoder context
+ * @param[in]       base64_in         pointer to the base64 chars to decode
+ * @param[in]       base64_in_size    the size of `base64_in`
+ * @param[out]      data_out          pointer to store the decoded data
+ * @param[in,out]   data_out_size     size of `data_out`, overwritten with the
+ *                                    required size on BASE64_ERROR_BUFFER_OUT_SIZE
+ *                                    and with the number of bytes written on
+ *                                    BASE64_SUCCESS
+ *
+ * @returns BASE64_SUCCESS on success,
+            BASE64_ERROR_BUFFER_OUT_SIZE on insufficient size of `data_out`,
+            BASE64_ERROR_BUFFER_OUT if `data_out` equals NULL,
+            BASE64_ERROR_DATA_IN if `base64_in` equals NULL.
+ */
+int base64_decoder_update(base64_decoder_t *dec, const void *base64_in,
+                          size_t base64_in_size, void *data_out,
+                          size_t *data_out_size);
+
+/**
+ * @brief           Decodes the remaining base64 codes
+ *
+ * @param[in,out]   dec               decoder context
+ * @param[out]      data_out          pointer to store the final (up to two)
+ *                                    bytes
+ * @param[in,out]   data_out_size     size of `data_out`, overwritten as for
+ *                                    base64_decoder_update()
+ *
+ * @returns BASE64_SUCCESS on success,
+            BASE64_ERROR_BUFFER_OUT_SIZE on insufficient size of `data_out`,
+            BASE64_ERROR_BUFFER_OUT if `data_out` equals NULL,
+            BASE64_ERROR_DATA_IN_SIZE if a single code is left over.
+ */
+int base64_decoder_finish(base64_decoder_t *dec, void *data_out,
+                          size_t *data_out_size);
+
 #ifdef __cplusplus
 }
 #endif
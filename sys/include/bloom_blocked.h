@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_bloom_blocked Blocked Bloom filter
+ * @ingroup     sys_bloom
+ * @brief       Cache-line blocked Bloom filter and counting Bloom filter
+ *
+ * The classic @ref bloom_t calls each of its k hash functions on the full
+ * key and touches k random positions of the whole bit array. The blocked
+ * variant instead hashes the key once: the hash selects one block of
+ * @ref CONFIG_BLOOM_BLOCK_SIZE bytes, and all k bit positions inside that
+ * block are derived from the same hash by double hashing. An operation
+ * thus costs one hash computation and touches a single cache line, at the
+ * price of a slightly higher false positive rate for the same memory.
+ *
+ * The counting variant @ref bloom_counting_t uses the same layout, but with
+ * a 4 bit counter instead of a single bit per position, so elements can be
+ * removed again. Counters saturate at 15 and are never decremented once
+ * saturated.
+ *
+ * Usage example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * BLOOM_BLOCKED_STORAGE(storage, 8);
+ * bloom_blocked_t bloom;
+ *
+ * bloom_blocked_init(&bloom, storage, 8, 6, (hashfp_t)fnv_hash);
+ * bloom_blocked_add(&bloom, key, key_len);
+ * if (bloom_blocked_check(&bloom, key, key_len)) {
+ *     ...
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Blocked Bloom filter API
+ */
+
+#ifndef BLOOM_BLOCKED_H
+#define BLOOM_BLOCKED_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bloom.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of a filter block in bytes, must be 32 or 64
+ *
+ * Should match the cache line size of the target, if it has a cache.
+ */
+#ifndef CONFIG_BLOOM_BLOCK_SIZE
+#define CONFIG_BLOOM_BLOCK_SIZE         (64U)
+#endif
+
+/**
+ * @brief   Number of keys hashed ahead by bloom_blocked_check_many()
+ */
+#ifndef CONFIG_BLOOM_BATCH_SIZE
+#define CONFIG_BLOOM_BATCH_SIZE         (8U)
+#endif
+
+/**
+ * @brief   Number of 32 bit words in a filter block
+ */
+#define BLOOM_BLOCK_WORDS               (CONFIG_BLOOM_BLOCK_SIZE / sizeof(uint32_t))
+
+/**
+ * @brief   Declare the storage of a blocked or counting Bloom filter
+ *
+ * @param[in] name      name of the array
+ * @param[in] numof     number of blocks
+ */
+#define BLOOM_BLOCKED_STORAGE(name, numof) \
+    uint32_t name[(numof) * BLOOM_BLOCK_WORDS] \
+    __attribute__((aligned(CONFIG_BLOOM_BLOCK_SIZE)))
+
+/**
+ * @brief   Blocked Bloom filter
+ */
+typedef struct {
+    uint32_t *blocks;   /**< filter storage, @ref BLOOM_BLOCK_WORDS per block */
+    size_t numof;       /**< number of blocks */
+    hashfp_t hash;      /**< hash function */
+    uint8_t k;          /**< number of bits per element */
+} bloom_blocked_t;
+
+/**
+ * @brief   Counting Bloom filter with 4 bit counters
+ */
+typedef bloom_blocked_t bloom_counting_t;
+
+/**
+ * @brief   Initialize and clear a blocked Bloom filter
+ *
+ * @param[out] bloom    filter to initialize
+ * @param[in]  blocks   storage, see @ref BLOOM_BLOCKED_STORAGE
+ * @param[in]  numof    number of blocks in @p blocks, must not be 0
+ * @param[in]  k        number of bits set per element
+ * @param[in]  hash     hash function applied to the elements
+ */
+void bloom_blocked_init(bloom_blocked_t *bloom, uint32_t *blocks, size_t numof,
+                        unsigned k, hashfp_t hash);
+
+/**
+ * @brief   Remove all elements from a blocked Bloom filter
+ *
+ * @param[in,out] bloom filter to clear
+ */
+void bloom_blocked_clear(bloom_blocked_t *bloom);
+
+/**
+ * @brief   Add an element to a blocked Bloom filter
+ *
+ * @param[in,out] bloom filter to add to
+ * @param[in]  buf      element to add
+ * @param[in]  len      length of @p buf
+ */
+void bloom_blocked_add(bloom_blocked_t *bloom, const uint8_t *buf, size_t len);
+
+/**
+ * @brief   Check whether an element may be in a blocked Bloom filter
+ *
+ * @param[in]  bloom    filter to check
+ * @param[in]  buf      element to check
+ * @param[in]  len      length of @p buf
+ *
+ * @return  false if the element is not in the filter
+ * @return  true if the element may be in the filter
+ */
+bool bloom_blocked_check(const bloom_blocked_t *bloom,
+                         const uint8_t *buf, size_t len);
+
+/**
+ * @brief   Check multiple elements against a blocked Bloom filter
+ *
+ * The elements are hashed in batches of @ref CONFIG_BLOOM_BATCH_SIZE before
+ * their blocks are accessed, so the memory accesses of a batch can overlap.
+ *
+ * @param[in]  bloom    filter to check
+ * @param[in]  bufs     elements to check
+ * @param[in]  lens     lengths of the elements in @p bufs
+ * @param[in]  numof    number of elements
+ * @param[out] res      check result for each element, see
+ *                      bloom_blocked_check()
+ *
+ * @return  number of elements that may be in the filter
+ */
+size_t bloom_blocked_check_many(const bloom_blocked_t *bloom,
+                                const uint8_t *const bufs[],
+                                const size_t lens[], size_t numof, bool *res);
+
+/**
+ * @brief   Initialize and clear a counting Bloom filter
+ *
+ * @param[out] bloom    filter to initialize
+ * @param[in]  blocks   storage, see @ref BLOOM_BLOCKED_STORAGE
+ * @param[in]  numof    number of blocks in @p blocks, must not be 0
+ * @param[in]  k        number of counters incremented per element
+ * @param[in]  hash     hash function applied to the elements
+ */
+void bloom_counting_init(bloom_counting_t *bloom, uint32_t *blocks,
+                         size_t numof, unsigned k, hashfp_t hash);
+
+/**
+ * @brief   Add an element to a counting Bloom filter
+ *
+ * @param[in,out] bloom filter to add to
+ * @param[in]  buf      element to add
+ * @param[in]  len      length of @p buf
+ */
+void bloom_counting_add(bloom_counting_t *bloom, const uint8_t *buf, size_t len);
+
+/**
+ * @brief   Remove an element from a counting Bloom filter
+ *
+ * Only elements that were added before must be removed, otherwise elements
+ * sharing counters with it will be lost from the filter.
+ *
+ * @param[in,out] bloom filter to remove from
+ * @param[in]  buf      element to remove
+ * @param[in]  len      length of @p buf
+ *
+ * @return  true if the element was removed
+ * @return  false if the element was not in the filter, the filter is not
+ *          modified then
+ */
+bool bloom_counting_remove(bloom_counting_t *bloom, const uint8_t *buf,
+                           size_t len);
+
+/**
+ * @brief   Check whether an element may be in a counting Bloom filter
+ *
+ * @param[in]  bloom    filter to check
+ * @param[in]  buf      element to check
+ * @param[in]  len      length of @p buf
+ *
+ * @return  false if the element is not in the filter
+ * @return  true if the element may be in the filter
+ */
+bool bloom_counting_check(const bloom_counting_t *bloom,
+                          const uint8_t *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BLOOM_BLOCKED_H */
+/** @} */
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_checksum_crc    Generic CRC engine
+ * @ingroup     sys_checksum
+ * @brief       Table-driven CRC engine for CRC-8, CRC-16 and CRC-32 variants
+ *
+ * This module calculates any CRC of up to 32 bit width that can be described
+ * by the Rocksoft model with `refin == refout`, which covers all commonly used
+ * CRC-8, CRC-16 and CRC-32 variants. Parameter sets for the most common ones
+ * are provided, e.g. @ref crc_params_crc32 (Ethernet FCS, zlib, littlefs) and
+ * @ref crc_params_crc32c (iSCSI, ext4).
+ *
+ * The speed/memory trade-off is selected per engine via @ref crc_mode_t:
+ *
+ * | Mode                  | Table size | Bytes per lookup step |
+ * |-----------------------|-----------:|----------------------:|
+ * | @ref CRC_MODE_BITWISE |        0 B |     (bit by bit)      |
+ * | @ref CRC_MODE_NIBBLE  |       64 B |                   0.5 |
+ * | @ref CRC_MODE_TABLE   |     1024 B |                     1 |
+ * | @ref CRC_MODE_SLICE4  |     4096 B |                     4 |
+ * | @ref CRC_MODE_SLICE8  |     8192 B |                     8 |
+ *
+ * The lookup table is supplied by the caller, so it can either be generated
+ * into RAM at runtime using @ref crc_table_generate() or be placed in flash
+ * as a `const` array that was generated beforehand.
+ *
+ * Usage example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * static uint32_t table[CRC_TABLE_LEN(CRC_MODE_TABLE)];
+ * crc_engine_t engine;
+ *
+ * crc_table_generate(&crc_params_crc32, CRC_MODE_TABLE, table);
+ * crc_engine_init(&engine, &crc_params_crc32, CRC_MODE_TABLE, table);
+ *
+ * uint32_t crc = crc_start(&engine);
+ * crc = crc_update(&engine, crc, chunk1, chunk1_len);
+ * crc = crc_update(&engine, crc, chunk2, chunk2_len);
+ * crc = crc_finish(&engine, crc);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Generic CRC engine definitions
+ */
+
+#ifndef CHECKSUM_CRC_H
+#define CHECKSUM_CRC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Implementation strategy of a CRC engine
+ */
+typedef enum {
+    CRC_MODE_BITWISE,   /**< bit by bit, no table */
+    CRC_MODE_NIBBLE,    /**< 16 entry table, one lookup per 4 bit */
+    CRC_MODE_TABLE,     /**< 256 entry table, one lookup per byte */
+    CRC_MODE_SLICE4,    /**< 4 x 256 entry table, slicing-by-4 */
+    CRC_MODE_SLICE8,    /**< 8 x 256 entry table, slicing-by-8 */
+} crc_mode_t;
+
+/**
+ * @brief   Number of `uint32_t` table entries required by @p mode
+ */
+#define CRC_TABLE_LEN(mode)                             \
+    (((mode) == CRC_MODE_NIBBLE) ? 16 :                 \
+     ((mode) == CRC_MODE_TABLE)  ? 256 :                \
+     ((mode) == CRC_MODE_SLICE4) ? (4 * 256) :          \
+     ((mode) == CRC_MODE_SLICE8) ? (8 * 256) : 0)
+
+/**
+ * @brief   CRC algorithm description (Rocksoft model)
+ */
+typedef struct {
+    uint32_t poly;      /**< generator polynomial in normal notation */
+    uint32_t init;      /**< initial register value */
+    uint32_t xorout;    /**< value XORed to the final register value */
+    uint8_t width;      /**< width of the CRC in bit, 1 to 32 */
+    bool reflected;     /**< input and output are reflected */
+} crc_params_t;
+
+/**
+ * @brief   CRC engine
+ */
+typedef struct {
+    const crc_params_t *params; /**< CRC algorithm */
+    const uint32_t *table;      /**< lookup table, NULL for bitwise mode */
+    uint32_t poly;              /**< polynomial in register alignment */
+    crc_mode_t mode;            /**< implementation strategy */
+} crc_engine_t;
+
+/**
+ * @name    Predefined CRC algorithms
+ *
+ * Check values (CRC over the ASCII string "123456789") are given in
+ * parentheses.
+ * @{
+ */
+extern const crc_params_t crc_params_crc8;              /**< CRC-8/SMBUS (0xf4) */
+extern const crc_params_t crc_params_crc8_maxim;        /**< CRC-8/MAXIM-DOW (0xa1) */
+extern const crc_params_t crc_params_crc16_ccitt_false; /**< CRC-16/IBM-3740 (0x29b1) */
+extern const crc_params_t crc_params_crc16_kermit;      /**< CRC-16/KERMIT (0x2189) */
+extern const crc_params_t crc_params_crc16_modbus;      /**< CRC-16/MODBUS (0x4b37) */
+extern const crc_params_t crc_params_crc32;             /**< CRC-32/ISO-HDLC (0xcbf43926) */
+extern const crc_params_t crc_params_crc32c;            /**< CRC-32/ISCSI (0xe3069283) */
+/** @} */
+
+/**
+ * @brief   Generate the lookup table for a CRC algorithm
+ *
+ * @param[in]  params   CRC algorithm to generate the table for
+ * @param[in]  mode     implementation strategy the table is used with
+ * @param[out] table    buffer of at least `CRC_TABLE_LEN(mode)` entries
+ */
+void crc_table_generate(const crc_params_t *params, crc_mode_t mode,
+                        uint32_t *table);
+
+/**
+ * @brief   Initialize a CRC engine
+ *
+ * @param[out] engine   engine to initialize
+ * @param[in]  params   CRC algorithm
+ * @param[in]  mode     implementation strategy
+ * @param[in]  table    lookup table generated for @p params and @p mode,
+ *                      may be NULL for @ref CRC_MODE_BITWISE
+ */
+void crc_engine_init(crc_engine_t *engine, const crc_params_t *params,
+                     crc_mode_t mode, const uint32_t *table);
+
+/**
+ * @brief   Get the initial register value of a CRC calculation
+ *
+ * @param[in]  engine   CRC engine
+ *
+ * @return  register value to be passed to crc_update()
+ */
+uint32_t crc_start(const crc_engine_t *engine);
+
+/**
+ * @brief   Feed data into a CRC calculation
+ *
+ * @param[in]  engine   CRC engine
+ * @param[in]  crc      register value as returned by crc_start() or a
+ *                      previous call to crc_update()
+ * @param[in]  buf      start of the memory area to checksum
+ * @param[in]  len      number of bytes to checksum
+ *
+ * @return  updated register value
+ */
+uint32_t crc_update(const crc_engine_t *engine, uint32_t crc,
+                    const void *buf, size_t len);
+
+/**
+ * @brief   Finish a CRC calculation
+ *
+ * @param[in]  engine   CRC engine
+ * @param[in]  crc      register value as returned by crc_update()
+ *
+ * @return  the CRC of all data fed into the calculation
+ */
+uint32_t crc_finish(const crc_engine_t *engine, uint32_t crc);
+
+/**
+ * @brief   Calculate the CRC of a memory area in one go
+ *
+ * @param[in]  engine   CRC engine
+ * @param[in]  buf      start of the memory area to checksum
+ * @param[in]  len      number of bytes to checksum
+ *
+ * @return  the CRC of the specified memory area
+ */
+static inline uint32_t crc_calc(const crc_engine_t *engine,
+                                const void *buf, size_t len)
+{
+    return crc_finish(engine, crc_update(engine, crc_start(engine), buf, len));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHECKSUM_CRC_H */
+/** @} */
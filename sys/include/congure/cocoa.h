@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_congure_cocoa   CongURE implementation of CoCoA
+ * @ingroup     sys_congure
+ * @brief       Implementation of the CoAP Simple Congestion Control/Advanced
+ *              (CoCoA) retransmission timeout estimation
+ *              ([draft-ietf-core-cocoa-03](https://tools.ietf.org/html/draft-ietf-core-cocoa-03))
+ *
+ * CoCoA replaces the fixed initial retransmission timeout (RTO) of CoAP with
+ * an estimation per destination endpoint. It keeps a strong estimator fed by
+ * exchanges without retransmissions and a weak estimator fed by exchanges that
+ * needed one or two retransmissions, and combines both into the overall RTO.
+ * Instead of doubling, retransmission timeouts are backed off with a variable
+ * factor that depends on the initial RTO.
+ *
+ * The caller reports a received response or ACK using
+ * congure_snd_driver_t::report_msg_acked(), with congure_snd_msg_t::send_time
+ * being the time the message was sent initially, congure_snd_msg_t::resends
+ * the number of retransmissions and congure_snd_ack_t::recv_time the time the
+ * response was received (all in milliseconds). The RTO for the initial
+ * transmission of a message is obtained by congure_cocoa_snd_rto(), the one
+ * for the retransmissions by congure_cocoa_snd_backoff().
+ *
+ * As CoAP only allows one outstanding interaction per endpoint by default,
+ * the congestion window congure_snd_t::cwnd is constantly 1 (NSTART).
+ *
+ * @{
+ *
+ * @file
+ */
+#ifndef CONGURE_COCOA_H
+#define CONGURE_COCOA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "congure.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Initial RTO in milliseconds, before any RTT was measured
+ */
+#define CONGURE_COCOA_RTO_INIT_MS       (2000U)
+
+/**
+ * @brief   Lower bound of the RTO in milliseconds
+ *
+ * Keeps the estimation from collapsing on links with RTTs close to the timer
+ * granularity.
+ */
+#define CONGURE_COCOA_RTO_MIN_MS        (100U)
+
+/**
+ * @brief   Upper bound of the RTO in milliseconds
+ */
+#define CONGURE_COCOA_RTO_MAX_MS        (60000U)
+
+/**
+ * @brief   State object for CongURE CoCoA
+ *
+ * @extends congure_snd_t
+ */
+typedef struct {
+    congure_snd_t super;        /**< see @ref congure_snd_t */
+    uint32_t rto;               /**< Overall RTO in milliseconds */
+    uint32_t strong_srtt;       /**< Smoothed RTT of the strong estimator */
+    uint32_t strong_rttvar;     /**< RTT variation of the strong estimator */
+    uint32_t weak_srtt;         /**< Smoothed RTT of the weak estimator */
+    uint32_t weak_rttvar;       /**< RTT variation of the weak estimator */
+    ztimer_now_t last_update;   /**< Time of the last update of the RTO */
+    bool strong_valid;          /**< Strong estimator has a measurement */
+    bool weak_valid;            /**< Weak estimator has a measurement */
+} congure_cocoa_snd_t;
+
+/**
+ * @brief   Set up the driver of a CongURE CoCoA object
+ *
+ * @note    congure_snd_driver_t::init() still needs to be called.
+ *
+ * @param[out] c        A CongURE CoCoA state object
+ */
+void congure_cocoa_snd_setup(congure_cocoa_snd_t *c);
+
+/**
+ * @brief   Get the RTO for the initial transmission of a message
+ *
+ * Applies the aging of the RTO if it was not updated for a long time.
+ *
+ * @param[in,out] c     A CongURE CoCoA state object
+ * @param[in]     now   The current time in milliseconds
+ *
+ * @return  The RTO in milliseconds
+ */
+uint32_t congure_cocoa_snd_rto(congure_cocoa_snd_t *c, ztimer_now_t now);
+
+/**
+ * @brief   Get the RTO for a retransmission of a message
+ *
+ * The backoff factor depends on the current overall RTO: 3 below 1s, 1.5
+ * above 3s, 2 otherwise.
+ *
+ * @param[in] c         A CongURE CoCoA state object
+ * @param[in] rto       The RTO of the previous transmission in milliseconds
+ *
+ * @return  The backed off RTO in milliseconds
+ */
+uint32_t congure_cocoa_snd_backoff(const congure_cocoa_snd_t *c, uint32_t rto);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONGURE_COCOA_H */
+/** @} */
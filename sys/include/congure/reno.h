@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_congure_reno    CongURE implementation of TCP Reno/NewReno
+ * @ingroup     sys_congure
+ * @brief       Implementation of the TCP Reno congestion control mechanism
+ *              ([RFC 5681](https://tools.ietf.org/html/rfc5681)) with the
+ *              NewReno modification to fast recovery
+ *              ([RFC 6582](https://tools.ietf.org/html/rfc6582))
+ *
+ * The sizes reported to this implementation are in bytes, the
+ * congure_snd_ack_t::id of an ACK is its cumulative acknowledgment number.
+ *
+ * The caller reports
+ * - every segment containing new data with
+ *   congure_snd_driver_t::report_msg_sent(),
+ * - every ACK acknowledging new data with
+ *   congure_snd_driver_t::report_msg_acked(), where congure_snd_msg_t::size
+ *   is the number of newly acknowledged bytes,
+ * - every duplicate ACK with congure_snd_driver_t::report_msg_acked(), where
+ *   congure_snd_msg_t::size is 0,
+ * - a retransmission timeout with congure_snd_driver_t::report_msgs_timeout().
+ *
+ * On the third duplicate ACK and on partial ACKs during fast recovery, the
+ * implementation calls congure_reno_snd_consts_t::fr, which is expected to
+ * retransmit the oldest unacknowledged segment.
+ *
+ * @{
+ *
+ * @file
+ */
+#ifndef CONGURE_RENO_H
+#define CONGURE_RENO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "congure.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   State object for CongURE Reno
+ *
+ * @extends congure_snd_t
+ */
+typedef struct congure_reno_snd congure_reno_snd_t;
+
+/**
+ * @brief   Constants for the congestion control
+ *
+ * May be shared between multiple state objects.
+ */
+typedef struct {
+    /**
+     * @brief   Callback to retransmit the oldest unacknowledged segment
+     *
+     * congure_snd_t::ctx of @p c is the context given on initialization.
+     */
+    void (*fr)(congure_reno_snd_t *c);
+    /**
+     * @brief   Initial maximum segment size of the sender in bytes
+     */
+    congure_wnd_size_t init_mss;
+    /**
+     * @brief   Initial slow start threshold in bytes
+     */
+    congure_wnd_size_t init_ssthresh;
+    /**
+     * @brief   Number of duplicate ACKs that trigger fast retransmit
+     */
+    uint8_t frthresh;
+} congure_reno_snd_consts_t;
+
+/**
+ * @brief   State object for CongURE Reno
+ */
+struct congure_reno_snd {
+    congure_snd_t super;                        /**< see @ref congure_snd_t */
+    const congure_reno_snd_consts_t *consts;    /**< Constants */
+    /**
+     * @brief   Highest sequence number in flight when fast recovery was
+     *          entered
+     */
+    uint32_t recover;
+    congure_wnd_size_t mss;         /**< Maximum segment size of the sender */
+    congure_wnd_size_t ssthresh;    /**< Slow start threshold */
+    congure_wnd_size_t in_flight;   /**< Number of bytes in flight */
+    /**
+     * @brief   Bytes acknowledged during congestion avoidance since the last
+     *          window increase
+     */
+    congure_wnd_size_t acked;
+    uint8_t dup_acks;               /**< Number of duplicate ACKs received */
+    bool in_recovery;               /**< Sender is in fast recovery */
+};
+
+/**
+ * @brief   Default constants: 3 duplicate ACKs, no initial threshold
+ */
+#define CONGURE_RENO_SND_CONSTS_INIT(fr_cb, mss)    \
+    {                                               \
+        .fr = (fr_cb),                              \
+        .init_mss = (mss),                          \
+        .init_ssthresh = CONGURE_WND_SIZE_MAX,      \
+        .frthresh = 3,                              \
+    }
+
+/**
+ * @brief   Set up the driver and the constants of a CongURE Reno object
+ *
+ * @note    congure_snd_driver_t::init() still needs to be called.
+ *
+ * @param[out] c        A CongURE Reno state object
+ * @param[in]  consts   Constants for the congestion control
+ */
+void congure_reno_snd_setup(congure_reno_snd_t *c,
+                            const congure_reno_snd_consts_t *consts);
+
+/**
+ * @brief   Set the maximum segment size of a CongURE Reno object
+ *
+ * To be called when the MSS is known, e.g. once the peer announced it, but
+ * before any data was sent. The congestion window is set to the initial
+ * window for @p mss.
+ *
+ * @param[in,out] c     A CongURE Reno state object
+ * @param[in]     mss   The maximum segment size in bytes
+ */
+void congure_reno_snd_set_mss(congure_reno_snd_t *c, congure_wnd_size_t mss);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONGURE_RENO_H */
+/** @} */
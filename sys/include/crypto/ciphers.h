@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "kernel_defines.h"
 
@@ -102,6 +103,18 @@ typedef struct cipher_interface_st {
     /** @brief the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /**
+     * @brief the multi-block encrypt function (optional)
+     *
+     * Encrypts @p blocks consecutive blocks independently of each other
+     * (i.e. in ECB fashion). Drivers for hardware accelerators should
+     * provide this to keep the engine busy across blocks. If NULL,
+     * @ref cipher_encrypt_blocks() calls the encrypt function once per
+     * block instead.
+     */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
 } cipher_interface_t;
 
 typedef const cipher_interface_t *cipher_id_t;
@@ -164,6 +177,26 @@ int cipher_init(cipher_t *cipher, cipher_id_t cipher_id, const uint8_t *key,
 int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
+/**
+ * @brief Encrypt multiple independent blocks in one call
+ *
+ * This is the building block of the modes of operation. It uses the
+ * cipher's multi-block encrypt function if there is one and falls back to
+ * cipher_encrypt() for every block otherwise.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to @p blocks * BLOCK_SIZE bytes of input data
+ * @param output     pointer to allocated memory for the encrypted data. It
+ *                   has to be of size @p blocks * BLOCK_SIZE and may be
+ *                   equal to @p input.
+ * @param blocks     number of blocks to encrypt
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
+
 /**
  * @brief Decrypt data of BLOCK_SIZE length
  * *
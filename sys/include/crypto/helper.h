@@ -37,6 +37,18 @@ extern "C" {
  */
 void crypto_block_inc_ctr(uint8_t block[16], int L);
 
+/**
+ * @brief   XOR two buffers
+ *
+ * The buffers are processed word by word if all of them are word aligned.
+ *
+ * @param[out] out  result of @p a XOR @p b, may be equal to @p a or @p b
+ * @param[in]  a    first operand
+ * @param[in]  b    second operand
+ * @param[in]  len  size of the buffers in bytes
+ */
+void crypto_xor(uint8_t *out, const uint8_t *a, const uint8_t *b, size_t len);
+
 /**
  * @brief   Compares two blocks of same size in deterministic time.
  *
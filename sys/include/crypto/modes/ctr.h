@@ -26,6 +26,18 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of key stream blocks generated per cipher call
+ *
+ * The key stream is generated with cipher_encrypt_blocks() in batches of
+ * this many blocks, which lets ciphers with a multi-block implementation
+ * (e.g. hardware accelerators) process several counter blocks at once. The
+ * batch buffer is allocated on the stack.
+ */
+#ifndef CONFIG_CIPHER_CTR_BATCH_BLOCKS
+#define CONFIG_CIPHER_CTR_BATCH_BLOCKS  (4U)
+#endif
+
 /**
  * @brief Encrypt data of arbitrary length in counter mode.
  *
@@ -84,6 +84,43 @@
  * [...] event_post(&queue, &custom_event)
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * ## Lock-free posting
+ *
+ * With module `event_mpsc`, event_post() doesn't disable interrupts. Posted
+ * events are pushed onto a stack with a compare-and-swap, which the thread
+ * owning the queue takes at once and appends to the queue in the order they
+ * were posted. Taking the stack and event_cancel() still need a short
+ * critical section. On platforms without atomic instructions, the
+ * compare-and-swap is emulated by disabling interrupts.
+ *
+ * ## Statistics
+ *
+ * With module `event_stats`, each queue counts the posted events, the
+ * maximum number of queued events, the maximum time from posting an event to
+ * taking it from the queue, and the maximum run time of a handler in
+ * event_loop_multi(). Queues registered with event_queue_stats_register() are
+ * listed by event_queue_stats_print() and the shell command `event_stats`,
+ * the queues of @ref sys_event_thread are registered. Every post and get
+ * reads @ref ZTIMER_USEC.
+ *
+ * ## Deadlines
+ *
+ * With module `event_deadline`, queues are ordered by deadline instead of
+ * posting order. Each event may set event_t::deadline, the time in
+ * microseconds after posting by which it should be handled, e.g. with
+ * event_post_deadline(). event_post() stores the absolute deadline and
+ * inserts the event in front of all events due later. Events without a
+ * deadline get @ref CONFIG_EVENT_DEADLINE_DEFAULT, so among them the queue
+ * stays first in, first out, and they are not starved by events with a
+ * deadline. A fixed deadline per kind of event acts as a priority: a radio
+ * ACK event with a deadline of 500 us passes any number of queued events
+ * without a deadline, but not one that has waited long enough to be due
+ * earlier.
+ *
+ * Posting an event with a deadline is O(n) in the number of queued events
+ * due later, posting one without a deadline stays O(1) in most cases.
+ * Deadlines must be shorter than half the period of @ref ZTIMER_USEC.
+ *
  * @{
  *
  * @file
@@ -121,6 +158,16 @@ extern "C" {
 #define THREAD_FLAG_EVENT   (0x1)
 #endif
 
+#if IS_USED(MODULE_EVENT_DEADLINE) || defined(DOXYGEN)
+#ifndef CONFIG_EVENT_DEADLINE_DEFAULT
+/**
+ * @brief   Deadline in us of events posted without one, with module
+ *          `event_deadline`
+ */
+#define CONFIG_EVENT_DEADLINE_DEFAULT   (1000000U)
+#endif
+#endif
+
 /**
  * @brief   event_queue_t static initializer
  */
@@ -147,14 +194,50 @@ typedef void (*event_handler_t)(event_t *);
 struct event {
     clist_node_t list_node;     /**< event queue list entry             */
     event_handler_t handler;    /**< pointer to event handler function  */
+#if IS_USED(MODULE_EVENT_STATS) || defined(DOXYGEN)
+    uint32_t posted;            /**< time the event was posted in us,
+                                     with module `event_stats`          */
+#endif
+#if IS_USED(MODULE_EVENT_DEADLINE) || defined(DOXYGEN)
+    uint32_t deadline;          /**< time after posting by which the
+                                     event should be handled in us, 0
+                                     for the default, with module
+                                     `event_deadline`                   */
+    uint32_t due;               /**< absolute deadline, set when
+                                     posted                             */
+#endif
 };
 
+/**
+ * @brief   event queue statistics, with module `event_stats`
+ */
+typedef struct {
+    uint32_t posts;             /**< events posted                      */
+    uint32_t depth;             /**< events queued now                  */
+    uint32_t max_depth;         /**< maximum number of queued events    */
+    uint32_t max_latency;       /**< maximum time from posting an event
+                                     to taking it in us                 */
+    uint32_t max_handler;       /**< maximum run time of a handler in
+                                     event_loop_multi() in us           */
+    const char *name;           /**< name of a registered queue         */
+    struct event_queue *next;   /**< next registered queue              */
+} event_queue_stats_t;
+
 /**
  * @brief   event queue structure
  */
-typedef struct PTRTAG {
+typedef struct PTRTAG event_queue {
     clist_node_t event_list;    /**< list of queued events              */
     thread_t *waiter;           /**< thread owning event queue          */
+#if IS_USED(MODULE_EVENT_MPSC) || defined(DOXYGEN)
+    clist_node_t *pending;      /**< events posted since the owner last
+                                     looked, newest first, with module
+                                     `event_mpsc`                       */
+#endif
+#if IS_USED(MODULE_EVENT_STATS) || defined(DOXYGEN)
+    event_queue_stats_t stats;  /**< statistics, with module
+                                     `event_stats`                      */
+#endif
 } event_queue_t;
 
 /**
@@ -262,6 +345,25 @@ static inline void event_queue_claim(event_queue_t *queue)
  */
 void event_post(event_queue_t *queue, event_t *event);
 
+#if IS_USED(MODULE_EVENT_DEADLINE) || defined(DOXYGEN)
+/**
+ * @brief   Queue an event with a deadline
+ *
+ * Sets event_t::deadline and posts the event. If the event is already
+ * queued, it keeps its position and its deadline.
+ *
+ * @param[in]   queue       event queue to queue event in
+ * @param[in]   event       event to queue in event queue
+ * @param[in]   deadline    time after which the event is due in us
+ */
+static inline void event_post_deadline(event_queue_t *queue, event_t *event,
+                                       uint32_t deadline)
+{
+    event->deadline = deadline;
+    event_post(queue, event);
+}
+#endif
+
 /**
  * @brief   Cancel a queued event
  *
@@ -380,6 +482,36 @@ event_t *event_wait_timeout_ztimer(event_queue_t *queue,
                                    ztimer_clock_t *clock, uint32_t timeout);
 #endif
 
+#if IS_USED(MODULE_EVENT_STATS) || defined(DOXYGEN)
+/**
+ * @brief   List a queue in the statistics
+ *
+ * Call it once, after the queue is initialized.
+ *
+ * @param[in]   queue   the queue
+ * @param[in]   name    name of the queue in the statistics
+ */
+void event_queue_stats_register(event_queue_t *queue, const char *name);
+
+/**
+ * @brief   Print the statistics of the registered queues
+ */
+void event_queue_stats_print(void);
+
+/**
+ * @brief   Reset the statistics of the registered queues
+ */
+void event_queue_stats_reset(void);
+
+/**
+ * @brief   Event loop of event_loop_multi() with module `event_stats`
+ *
+ * @param[in]   queues      Event queues to process
+ * @param[in]   n_queues    Number of queues passed with @p queues
+ */
+NORETURN void event_stats_loop_multi(event_queue_t *queues, size_t n_queues);
+#endif
+
 /**
  * @brief   Simple event loop with multiple queues
  *
@@ -403,11 +535,15 @@ event_t *event_wait_timeout_ztimer(event_queue_t *queue,
  */
 static inline void event_loop_multi(event_queue_t *queues, size_t n_queues)
 {
+#if IS_USED(MODULE_EVENT_STATS)
+    event_stats_loop_multi(queues, n_queues);
+#else
     event_t *event;
 
     while ((event = event_wait_multi(queues, n_queues))) {
         event->handler(event);
     }
+#endif
 }
 
 /**
@@ -110,6 +110,24 @@ static inline void sha256_update(sha256_context_t *ctx, const void *data, size_t
     sha2xx_update(ctx, data, len);
 }
 
+/**
+ * @brief Add the same number of bytes to several independent hashes
+ *
+ * This is intended for verifying several images or chunks at once, see
+ * @ref sha2xx_update_multi() for details.
+ *
+ * @param ctx       array of @p count sha256_context_t handles to use
+ * @param[in] data  array of @p count input buffers of @p len bytes each
+ * @param[in] len   number of bytes to add to each hash
+ * @param[in] count number of hashes
+ */
+static inline void sha256_update_multi(sha256_context_t *const ctx[],
+                                       const void *const data[], size_t len,
+                                       unsigned count)
+{
+    sha2xx_update_multi(ctx, data, len, count);
+}
+
 /**
  * @brief SHA-256 finalization.  Pads the input data, exports the hash value,
  * and clears the context state.
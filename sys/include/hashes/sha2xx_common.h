@@ -34,6 +34,12 @@
  * @defgroup    sys_hashes_sha2xx_common SHA-2xx common
  * @ingroup     sys_hashes_unkeyed
  * @brief       Implementation of common functionality for SHA-224/256 hashing functions
+ *
+ * The block compression function is a compact loop by default. Using the
+ * `hashes_sha2xx_unroll` pseudomodule unrolls it eight rounds at a time,
+ * which trades some flash for a considerably faster hash. On `native`, the
+ * SHA extensions of the host CPU are used if available.
+ *
  * @{
  *
  * @file
@@ -128,6 +134,28 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len);
  */
 void sha2xx_final(sha2xx_context_t *ctx, void *digest, size_t dig_len);
 
+/**
+ * @brief Number of hashes sha2xx_update_multi() processes in lockstep
+ */
+#ifndef CONFIG_SHA2XX_MULTI_LANES
+#define CONFIG_SHA2XX_MULTI_LANES   (4U)
+#endif
+
+/**
+ * @brief Add the same number of bytes to several independent hashes
+ *
+ * Streams that are at the same offset within a block, e.g. because all of
+ * them only ever were updated together, are compressed in lockstep,
+ * @ref CONFIG_SHA2XX_MULTI_LANES at a time.
+ *
+ * @param ctx      array of @p count contexts
+ * @param[in] data array of @p count input buffers of @p len bytes each
+ * @param[in] len  number of bytes to add to each hash
+ * @param[in] count number of hashes
+ */
+void sha2xx_update_multi(sha2xx_context_t *const ctx[],
+                         const void *const data[], size_t len, unsigned count);
+
 #ifdef __cplusplus
 }
 #endif
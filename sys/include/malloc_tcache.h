@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_malloc_tcache   Thread caches for malloc
+ * @ingroup     sys_malloc_ts
+ * @brief       Serves small allocations from per thread caches without
+ *              taking the malloc lock
+ *
+ * With module `malloc_tcache`, the wrappers of @ref sys_malloc_ts serve
+ * allocations of up to @ref MALLOC_TCACHE_MAX bytes from static pools of
+ * fixed size blocks, one @ref sys_memarray per size class. Each thread keeps
+ * up to @ref CONFIG_MALLOC_TCACHE_DEPTH free blocks per size class. Taking
+ * a block from and returning it to the cache of the running thread needs no
+ * lock, as no other thread touches that cache.
+ *
+ * The lock of the heap is only taken if a cache runs empty or full, to move
+ * half a cache worth of blocks from or to the pool, and for allocations the
+ * pools can't serve. Those fall back to the heap of the C library.
+ *
+ * The size classes are the powers of two from @ref CONFIG_MALLOC_TCACHE_MIN
+ * on, @ref CONFIG_MALLOC_TCACHE_CLASSES of them, with
+ * @ref CONFIG_MALLOC_TCACHE_BLOCKS blocks each. A freed block goes to the
+ * cache of the thread that frees it, so blocks migrate between threads as
+ * they are passed on. The blocks cached by a thread that exits stay with its
+ * PID, call @ref malloc_tcache_flush() before exiting to hand them back.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Thread caches for malloc
+ */
+
+#ifndef MALLOC_TCACHE_H
+#define MALLOC_TCACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the smallest size class in bytes, a power of two
+ */
+#ifndef CONFIG_MALLOC_TCACHE_MIN
+#define CONFIG_MALLOC_TCACHE_MIN        (16U)
+#endif
+
+/**
+ * @brief   Number of size classes
+ */
+#ifndef CONFIG_MALLOC_TCACHE_CLASSES
+#define CONFIG_MALLOC_TCACHE_CLASSES    (4U)
+#endif
+
+/**
+ * @brief   Number of blocks in the pool of each size class
+ */
+#ifndef CONFIG_MALLOC_TCACHE_BLOCKS
+#define CONFIG_MALLOC_TCACHE_BLOCKS     (16U)
+#endif
+
+/**
+ * @brief   Maximum number of free blocks a thread caches per size class
+ */
+#ifndef CONFIG_MALLOC_TCACHE_DEPTH
+#define CONFIG_MALLOC_TCACHE_DEPTH      (4U)
+#endif
+
+/**
+ * @brief   Largest allocation served by the caches
+ */
+#define MALLOC_TCACHE_MAX   (CONFIG_MALLOC_TCACHE_MIN << \
+                             (CONFIG_MALLOC_TCACHE_CLASSES - 1))
+
+/**
+ * @brief   Allocator statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< allocations served by a thread cache */
+    uint32_t refills;       /**< caches refilled from the pools */
+    uint32_t flushes;       /**< caches flushed to the pools */
+    uint32_t locked;        /**< times the heap lock was taken, for the
+                                 heap or the pools */
+    uint32_t contended;     /**< times the heap lock was held by another
+                                 thread */
+} malloc_tcache_stats_t;
+
+/**
+ * @brief   Allocate a block from the caches
+ *
+ * Called by the malloc wrappers with the lock not taken.
+ *
+ * @param[in]   size    size of the allocation
+ *
+ * @return  the block
+ * @return  NULL if the size is too large or the pool is exhausted
+ */
+void *malloc_tcache_alloc(size_t size);
+
+/**
+ * @brief   Free a block if it belongs to the caches
+ *
+ * Called by the malloc wrappers with the lock not taken.
+ *
+ * @param[in]   ptr     the block
+ *
+ * @return  1 if the block was freed
+ * @return  0 if the block was allocated from the heap
+ */
+int malloc_tcache_free(void *ptr);
+
+/**
+ * @brief   Get the usable size of a block from the caches
+ *
+ * @param[in]   ptr     the block
+ *
+ * @return  size of the block
+ * @return  0 if the block was allocated from the heap
+ */
+size_t malloc_tcache_size(const void *ptr);
+
+/**
+ * @brief   Return the blocks cached by the running thread to the pools
+ */
+void malloc_tcache_flush(void);
+
+/**
+ * @brief   Get the allocator statistics
+ *
+ * @param[out]  stats   the statistics
+ */
+void malloc_tcache_get_stats(malloc_tcache_stats_t *stats);
+
+/**
+ * @brief   Print the allocator statistics and the pool usage
+ */
+void malloc_tcache_print_stats(void);
+
+/**
+ * @name    Lock of the heap
+ *
+ * Used by the caches and by the wrappers, counted in the statistics
+ * @{
+ */
+void malloc_tcache_lock(void);      /**< lock the heap */
+void malloc_tcache_unlock(void);    /**< unlock the heap */
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MALLOC_TCACHE_H */
+/** @} */
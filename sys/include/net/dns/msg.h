@@ -40,6 +40,16 @@ extern "C" {
 #endif  /* CONFIG_DNS_MSG_LEN */
 /** @} */
 
+/**
+ * @name    Response codes
+ * @see [RFC 1035, section 4.1.1](https://tools.ietf.org/html/rfc1035#section-4.1.1)
+ * @{
+ */
+#define DNS_MSG_RCODE_MASK          (0x000fU)   /**< mask of RCODE in dns_hdr_t::flags */
+#define DNS_MSG_RCODE_NOERROR       (0U)        /**< No error */
+#define DNS_MSG_RCODE_NXDOMAIN      (3U)        /**< Name error */
+/** @} */
+
 /**
  * @brief DNS internal structure
  *
@@ -112,6 +122,33 @@ size_t dns_msg_compose_query(void *dns_buf, const char *domain_name,
 int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
                         void *addr_out);
 
+/**
+ * @brief   Parses a DNS response message and its time to live
+ *
+ * Like @ref dns_msg_parse_reply(), but distinguishes a well-formed negative
+ * answer (name error or no matching record) from a malformed one.
+ *
+ * @param[in] buf           The message to parse.
+ * @param[in] len           Length of @p buf.
+ * @param[in] family        The address family used to compose the query for
+ *                          this response (see @ref dns_msg_compose_query())
+ * @param[out] addr_out     The IP address returned by the response.
+ * @param[out] ttl          The time in seconds the answer may be cached. For
+ *                          a positive answer, this is the smallest TTL of the
+ *                          answer records up to the returned address. For a
+ *                          negative answer, this is derived from the SOA
+ *                          record in the authority section as described in
+ *                          [RFC 2308](https://tools.ietf.org/html/rfc2308),
+ *                          or 0 if there is none. May be NULL.
+ *
+ * @return  Length of the @p addr_out on success.
+ * @return  -ENOENT, when @p buf is a valid answer without an address
+ *          corresponding to @p family.
+ * @return  -EBADMSG, when @p buf is malformed or indicates a server error.
+ */
+int dns_msg_parse_reply_ttl(const uint8_t *buf, size_t len, int family,
+                            void *addr_out, uint32_t *ttl);
+
 #ifdef __cplusplus
 }
 #endif
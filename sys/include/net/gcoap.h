@@ -639,6 +639,17 @@ extern "C" {
 #define CONFIG_GCOAP_RESEND_BUFS_MAX      (1)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Count of remote endpoints with a CoCoA RTO estimation
+ *
+ * Only used with the module `gcoap_cocoa`. If more endpoints are contacted,
+ * the least recently used estimation is replaced.
+ */
+#ifndef CONFIG_GCOAP_COCOA_PEERS
+#define CONFIG_GCOAP_COCOA_PEERS          (4)
+#endif
+
 /**
  * @name Bitwise positional flags for encoding resource links
  * @anchor COAP_LINK_FLAG_
@@ -768,6 +779,12 @@ struct gcoap_request_memo {
     void *context;                      /**< ptr to user defined context data */
     event_timeout_t resp_evt_tmout;     /**< Limits wait for response */
     event_callback_t resp_tmout_cb;     /**< Callback for response timeout */
+#if IS_USED(MODULE_GCOAP_COCOA) || defined(DOXYGEN)
+    uint32_t send_time;                 /**< Time of the initial transmission
+                                             [in msec], for RTO estimation */
+    uint32_t rto;                       /**< Current retransmission timeout
+                                             [in msec] */
+#endif
 };
 
 /**
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_netif_fastfwd  IPv6 forwarding fast path
+ * @ingroup     net_gnrc_netif
+ * @brief       Forwards IPv6 packets directly from the receiving interface
+ *
+ * Without this module, a forwarded packet is handed from the thread of the
+ * receiving interface to the @ref net_gnrc_ipv6 thread and from there to the
+ * thread of the sending interface. With module `gnrc_netif_fastfwd`, the
+ * receiving interface forwards plain packets itself and hands them directly
+ * to the sending interface. This saves a context switch and a message per
+ * hop.
+ *
+ * A packet takes the fast path, if
+ *
+ * - it was received as an uncompressed IPv6 packet, i.e. not over 6LoWPAN,
+ * - its next header is not an extension header,
+ * - its source and destination are neither link-local, multicast nor
+ *   loopback addresses,
+ * - its destination is not an address of this node,
+ * - its hop limit does not reach 0 when forwarded,
+ * - the sending interface is not a 6LoWPAN interface,
+ * - it fits the MTU of the sending interface, and
+ * - the link-layer address of the next hop is known.
+ *
+ * All other packets take the full path through @ref net_gnrc_ipv6, which also
+ * takes care of error messages and address resolution.
+ *
+ * The next hops are kept in a small route cache for at most
+ * @ref CONFIG_GNRC_NETIF_FASTFWD_CACHE_LIFETIME_MS. The cache is flushed when
+ * an address is added to an interface and when the
+ * @ref net_gnrc_ipv6_nib removes a route, a default router or a neighbor,
+ * finds a neighbor unreachable or learns a new link-layer address for it.
+ * New routes take effect on the fast path once the cache entry for their
+ * destination expires, call @ref gnrc_netif_fastfwd_flush() to apply them
+ * immediately.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Definitions for the IPv6 forwarding fast path
+ */
+#ifndef NET_GNRC_NETIF_FASTFWD_H
+#define NET_GNRC_NETIF_FASTFWD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pkt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_netif_fastfwd_conf    IPv6 forwarding fast path compile configurations
+ * @ingroup  net_gnrc_netif_conf
+ * @{
+ */
+/**
+ * @brief   Number of entries in the route cache
+ */
+#ifndef CONFIG_GNRC_NETIF_FASTFWD_CACHE_SIZE
+#define CONFIG_GNRC_NETIF_FASTFWD_CACHE_SIZE            (4U)
+#endif
+
+/**
+ * @brief   Lifetime of a route cache entry in milliseconds
+ */
+#ifndef CONFIG_GNRC_NETIF_FASTFWD_CACHE_LIFETIME_MS
+#define CONFIG_GNRC_NETIF_FASTFWD_CACHE_LIFETIME_MS     (1000U)
+#endif
+/** @} */
+
+/**
+ * @brief   Statistics of the IPv6 forwarding fast path
+ */
+typedef struct {
+    uint32_t forwarded;         /**< packets forwarded on the fast path */
+    uint32_t slow;              /**< packets handed to the full path */
+    uint32_t cache_misses;      /**< route cache misses */
+} gnrc_netif_fastfwd_stats_t;
+
+/**
+ * @brief   Forwards a received packet on the fast path, if possible
+ *
+ * @param[in] netif The interface the packet was received on
+ * @param[in] pkt   The received packet
+ *
+ * @return  true, if the packet was forwarded (or dropped when the sending
+ *          interface could not take it). @p pkt must not be used anymore.
+ * @return  false, if the packet needs to take the full path. @p pkt is not
+ *          changed.
+ */
+bool gnrc_netif_fastfwd(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Removes all entries from the route cache
+ */
+void gnrc_netif_fastfwd_flush(void);
+
+/**
+ * @brief   Gets the statistics of the fast path
+ *
+ * The counters are shared by all interfaces. Each of them is read atomically,
+ * but not all of them at once.
+ *
+ * @param[out] stats    The statistics
+ */
+void gnrc_netif_fastfwd_stats_get(gnrc_netif_fastfwd_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_FASTFWD_H */
+/** @} */
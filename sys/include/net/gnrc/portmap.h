@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_portmap Port-in-use index
+ * @ingroup     net_gnrc
+ * @brief       Constant-time index of the local ports in use by a transport
+ *              protocol
+ *
+ * Counts the users of every local port in a small open-addressing hash
+ * table, so checking whether a port is in use does not depend on the number
+ * of sockets or connections. @ref net_gnrc_udp "UDP" socks (with
+ * `gnrc_sock_check_reuse`) and @ref net_gnrc_tcp "TCP" keep one index each,
+ * updated whenever a local port is bound or released.
+ *
+ * If more distinct ports are in use than the table has slots, the ports
+ * that did not fit are only counted. Looking up a port that is not in the
+ * table then can't tell whether it is free, and the caller has to fall
+ * back to searching its list of sockets.
+ *
+ * @note    The index is not synchronized, the caller has to serialize the
+ *          access.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Port-in-use index definitions
+ */
+
+#ifndef NET_GNRC_PORTMAP_H
+#define NET_GNRC_PORTMAP_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_portmap_conf  GNRC port-in-use index compile
+ *                                  configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of slots of a port-in-use index (as exponent of 2^n).
+ *
+ *          Should be larger than the number of distinct local ports usually
+ *          in use, so the table stays sparse.
+ */
+#ifndef CONFIG_GNRC_PORTMAP_SIZE_EXP
+#define CONFIG_GNRC_PORTMAP_SIZE_EXP    (4U)
+#endif
+/** @} */
+
+/**
+ * @brief   Number of slots of a port-in-use index
+ */
+#define GNRC_PORTMAP_SIZE   (1U << CONFIG_GNRC_PORTMAP_SIZE_EXP)
+
+/**
+ * @brief   Slot of a port-in-use index
+ */
+typedef struct {
+    uint16_t port;          /**< the port, 0 if the slot is free */
+    uint16_t users;         /**< number of users of the port */
+} gnrc_portmap_slot_t;
+
+/**
+ * @brief   Port-in-use index
+ */
+typedef struct {
+    gnrc_portmap_slot_t slots[GNRC_PORTMAP_SIZE];   /**< hash table */
+    uint16_t overflow;      /**< users of ports that did not fit */
+} gnrc_portmap_t;
+
+/**
+ * @brief   Static initializer for @ref gnrc_portmap_t
+ */
+#define GNRC_PORTMAP_INIT   { .overflow = 0 }
+
+/**
+ * @brief   Adds a user of a port
+ *
+ * @param[in,out] map   the index
+ * @param[in] port      the port, must not be 0
+ */
+void gnrc_portmap_add(gnrc_portmap_t *map, uint16_t port);
+
+/**
+ * @brief   Removes a user of a port added with @ref gnrc_portmap_add()
+ *
+ * @param[in,out] map   the index
+ * @param[in] port      the port, must not be 0
+ */
+void gnrc_portmap_remove(gnrc_portmap_t *map, uint16_t port);
+
+/**
+ * @brief   Looks up the number of users of a port
+ *
+ * @param[in] map       the index
+ * @param[in] port      the port
+ *
+ * @return  > 0, if @p port is in use. This is the number of its users, as
+ *          long as all ports fit into the index.
+ * @return  0, if @p port is free
+ * @return  -1, if it is unknown whether @p port is in use, because not all
+ *          ports fit into the index
+ */
+int gnrc_portmap_lookup(const gnrc_portmap_t *map, uint16_t port);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_PORTMAP_H */
+/** @} */
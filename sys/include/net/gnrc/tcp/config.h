@@ -108,6 +108,39 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Maximum number of unacknowledged segments in flight per connection.
+ *
+ * Every segment in flight is kept in the packet buffer until it is
+ * acknowledged. A value of 1 results in stop-and-wait behavior. The segments
+ * in flight are limited by the receive window of the peer as well, so
+ * between two nodes using the default window of one MSS (see
+ * @ref CONFIG_GNRC_TCP_MSS_MULTIPLICATOR) a transfer stays stop-and-wait.
+ *
+ * The fast retransmit of `gnrc_tcp_congure_reno` is triggered by three
+ * duplicate ACKs, so it needs at least four segments in flight.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#ifdef MODULE_GNRC_TCP_CONGURE_RENO
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (4U)
+#else
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (2U)
+#endif
+#endif
+
+/**
+ * @brief Maximum number of out-of-order byte ranges tracked per receive buffer.
+ *
+ * Segments received out of order are stored in the free part of the receive
+ * buffer until the missing data arrives. This only has an effect if the
+ * receive window is larger than a single MSS (see
+ * @ref CONFIG_GNRC_TCP_MSS_MULTIPLICATOR). A value of 0 drops out-of-order
+ * segments.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+#define CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS (2U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
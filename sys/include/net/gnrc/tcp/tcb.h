@@ -34,6 +34,10 @@
 #include "net/gnrc/ipv6.h"
 #endif
 
+#ifdef MODULE_GNRC_TCP_CONGURE_RENO
+#include "congure/reno.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -63,14 +67,20 @@ typedef struct sock_tcp {
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t rtt_seq;      /**< Sequence number acknowledging the timed segment */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
-    uint8_t retries;       /**< Number of retransmissions */
+    uint8_t retries;       /**< Number of retransmissions of the oldest segment */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    gnrc_pktsnip_t *pkt_retransmit[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE]; /**< Retransmit queue,
+                                                                               oldest segment first */
+    uint8_t pkt_retransmit_len; /**< Number of packets in the retransmit queue */
+#ifdef MODULE_GNRC_TCP_CONGURE_RENO
+    congure_reno_snd_t cong; /**< Congestion control state */
+#endif
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_trace  Packet path tracing
+ * @ingroup     net_gnrc
+ * @brief       Records the path of packets through GNRC with timestamps
+ *
+ * With module `gnrc_trace`, the layers of GNRC record an entry whenever a
+ * packet passes one of the trace points listed in @ref gnrc_trace_event_t.
+ * An entry holds a timestamp, the layer, the event, the packet pointer and
+ * the length of the packet. The entries are kept in a ring buffer of
+ * @ref GNRC_TRACE_BUF_SIZE entries, the oldest ones are overwritten.
+ *
+ * Recording an entry takes no lock, so it is cheap enough to leave tracing
+ * enabled in production. Reading the buffer while it is written only skips
+ * the entries that are overwritten at that moment.
+ *
+ * The buffer can be printed with the `gnrc_trace` shell command or
+ * @ref gnrc_trace_dump(). `dist/tools/gnrc_trace/gnrc_trace.py` follows the
+ * packets through a dump and computes the latency between the trace points,
+ * e.g. how long packets wait in the message queue of a layer.
+ *
+ * @note    A packet is identified by the pointer to its first snip. Layers
+ *          that copy or rebuild a packet, e.g. 6LoWPAN header decompression,
+ *          start a new identity.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Definitions for GNRC packet path tracing
+ */
+#ifndef NET_GNRC_TRACE_H
+#define NET_GNRC_TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "net/gnrc/pkt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_trace_conf    GNRC packet path tracing compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Default number of entries in the trace buffer (as exponent of 2^n).
+ *
+ *          As the number of entries ALWAYS needs to be a power of two, this
+ *          option represents the exponent of 2^n.
+ */
+#ifndef CONFIG_GNRC_TRACE_BUF_SIZE_EXP
+#define CONFIG_GNRC_TRACE_BUF_SIZE_EXP  (7U)
+#endif
+/** @} */
+
+/**
+ * @brief   Number of entries in the trace buffer
+ */
+#define GNRC_TRACE_BUF_SIZE             (1U << CONFIG_GNRC_TRACE_BUF_SIZE_EXP)
+
+/**
+ * @brief   Layers recording trace entries
+ */
+typedef enum {
+    GNRC_TRACE_LAYER_NETIF = 0,         /**< network interface */
+    GNRC_TRACE_LAYER_SIXLOWPAN,         /**< 6LoWPAN */
+    GNRC_TRACE_LAYER_IPV6,              /**< IPv6 */
+    GNRC_TRACE_LAYER_UDP,               /**< UDP */
+    GNRC_TRACE_LAYER_TCP,               /**< TCP */
+    GNRC_TRACE_LAYER_SOCK,              /**< sock */
+    GNRC_TRACE_LAYER_NUMOF,             /**< number of layers */
+} gnrc_trace_layer_t;
+
+/**
+ * @brief   Trace points
+ */
+typedef enum {
+    /**
+     * @brief   Packet received from the layer below
+     *
+     * For the network interface: the packet was received from the device.
+     */
+    GNRC_TRACE_EVENT_RX = 0,
+    /**
+     * @brief   Packet to be sent received from the layer above
+     */
+    GNRC_TRACE_EVENT_TX,
+    /**
+     * @brief   Packet handed to the layer below
+     *
+     * For the network interface: the packet is handed to the device.
+     */
+    GNRC_TRACE_EVENT_OUT,
+    GNRC_TRACE_EVENT_FWD,               /**< packet forwarded */
+    /**
+     * @brief   Fragment of a packet sent
+     *
+     * Recorded for the fragmented packet with the length of the fragment.
+     */
+    GNRC_TRACE_EVENT_FRAG,
+    GNRC_TRACE_EVENT_REASS,             /**< packet reassembled */
+    GNRC_TRACE_EVENT_DEMUX,             /**< packet handed to the receivers
+                                         *   of its port or connection */
+    GNRC_TRACE_EVENT_DELIVER,           /**< packet handed to the application */
+    GNRC_TRACE_EVENT_NUMOF,             /**< number of trace points */
+} gnrc_trace_event_t;
+
+/**
+ * @brief   Trace buffer entry
+ */
+typedef struct {
+    uint32_t seq;                       /**< sequence number of the entry */
+    uint32_t time;                      /**< timestamp in microseconds */
+    const void *pkt;                    /**< the packet */
+    uint16_t len;                       /**< length of the packet */
+    uint8_t layer;                      /**< @ref gnrc_trace_layer_t */
+    uint8_t event;                      /**< @ref gnrc_trace_event_t */
+} gnrc_trace_entry_t;
+
+/**
+ * @brief   Record a trace entry
+ *
+ * @note    Use @ref gnrc_trace() to record a whole packet. Calls to this
+ *          function need to be guarded with `IS_USED(MODULE_GNRC_TRACE)`.
+ *
+ * @param[in] layer     the layer recording the entry
+ * @param[in] event     the trace point
+ * @param[in] pkt       the packet
+ * @param[in] len       length of the packet
+ */
+void gnrc_trace_add(gnrc_trace_layer_t layer, gnrc_trace_event_t event,
+                    const void *pkt, size_t len);
+
+/**
+ * @brief   Record a trace entry for a packet, if module `gnrc_trace` is used
+ *
+ * @param[in] layer     the layer recording the entry
+ * @param[in] event     the trace point
+ * @param[in] pkt       the packet
+ */
+static inline void gnrc_trace(gnrc_trace_layer_t layer,
+                              gnrc_trace_event_t event,
+                              const gnrc_pktsnip_t *pkt)
+{
+    if (IS_USED(MODULE_GNRC_TRACE)) {
+        gnrc_trace_add(layer, event, pkt, gnrc_pkt_len(pkt));
+    }
+}
+
+/**
+ * @brief   Enable or disable recording entries
+ *
+ * Recording is enabled on start-up.
+ *
+ * @param[in] enable    true to enable recording
+ */
+void gnrc_trace_enable(bool enable);
+
+/**
+ * @brief   Read the entries of the trace buffer
+ *
+ * @param[in,out] seq   the sequence number of the first entry to read, set
+ *                      to the sequence number following the last entry read.
+ *                      Entries already overwritten are skipped.
+ * @param[out] entries  the entries read, oldest first
+ * @param[in] max       maximum number of entries to read
+ *
+ * @return  number of entries read
+ */
+unsigned gnrc_trace_read(uint32_t *seq, gnrc_trace_entry_t *entries,
+                         unsigned max);
+
+/**
+ * @brief   Print all entries of the trace buffer
+ *
+ * Prints a line per entry, oldest first:
+ *
+ *     trace <seq> <time in us> <layer> <event> <pkt> <len>
+ */
+void gnrc_trace_dump(void);
+
+/**
+ * @brief   Remove all entries from the trace buffer
+ */
+void gnrc_trace_reset(void);
+
+/**
+ * @brief   Get the name of a layer
+ */
+const char *gnrc_trace_layer_str(gnrc_trace_layer_t layer);
+
+/**
+ * @brief   Get the name of a trace point
+ */
+const char *gnrc_trace_event_str(gnrc_trace_event_t event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_TRACE_H */
+/** @} */
@@ -12,6 +12,47 @@
  *
  * @brief       Sock DNS client
  *
+ * The client is reentrant, so multiple threads may resolve names at the same
+ * time.
+ *
+ * Caching
+ * =======
+ *
+ * With the module `sock_dns_cache`, answers are kept in a small cache of
+ * @ref CONFIG_SOCK_DNS_CACHE_SIZE entries for as long as their time to live
+ * allows. Negative answers (the name does not exist or has no address of the
+ * requested family) are cached as well, for the time given by the SOA record
+ * of the answer, but at most @ref CONFIG_SOCK_DNS_CACHE_NEG_TTL_MAX seconds.
+ * Entries are identified by the name, compared case-insensitively, and the
+ * requested family.
+ *
+ * The cache also deduplicates requests: when a thread asks for a name that is
+ * already being resolved, synchronously or asynchronously, it waits for the
+ * answer of the query in flight instead of sending another one.
+ *
+ * Asynchronous queries
+ * ====================
+ *
+ * With the module `sock_dns_async`, @ref sock_dns_query_async() resolves a
+ * name without blocking the caller. The exchange is driven from an event
+ * queue and the result is delivered by posting an event to the same queue.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * static sock_dns_async_t query;
+ *
+ * static void _resolved(event_t *ev)
+ * {
+ *     sock_dns_async_t *q = container_of(ev, sock_dns_async_t, super);
+ *
+ *     if (q->res > 0) {
+ *         ... use q->addr ...
+ *     }
+ * }
+ *
+ * sock_dns_query_async(&query, EVENT_PRIO_MEDIUM, _resolved, "example.org",
+ *                      AF_INET6);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
  * @{
  *
  * @file
@@ -27,9 +68,14 @@
 #include <stdint.h>
 #include <unistd.h>
 
+#include "kernel_defines.h"
 #include "net/dns/msg.h"
 
 #include "net/sock/udp.h"
+#if IS_USED(MODULE_SOCK_DNS_ASYNC) || defined(DOXYGEN)
+#include "event.h"
+#include "event/timeout.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -45,6 +91,35 @@ extern "C" {
 #define SOCK_DNS_MAX_NAME_LEN   (CONFIG_DNS_MSG_LEN - sizeof(dns_hdr_t) - 4)
 /** @} */
 
+/**
+ * @defgroup net_sock_dns_conf  DNS sock configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Timeout for the first try of a query in milliseconds
+ *
+ * The timeout is doubled for every further try.
+ */
+#ifndef CONFIG_SOCK_DNS_TIMEOUT_MS
+#define CONFIG_SOCK_DNS_TIMEOUT_MS          (1000U)
+#endif
+
+/**
+ * @brief   Number of entries in the DNS cache (module `sock_dns_cache`)
+ */
+#ifndef CONFIG_SOCK_DNS_CACHE_SIZE
+#define CONFIG_SOCK_DNS_CACHE_SIZE          (4U)
+#endif
+
+/**
+ * @brief   Maximum time in seconds a negative answer is cached
+ */
+#ifndef CONFIG_SOCK_DNS_CACHE_NEG_TTL_MAX
+#define CONFIG_SOCK_DNS_CACHE_NEG_TTL_MAX   (300U)
+#endif
+/** @} */
+
 /**
  * @brief Get IP address for DNS name
  *
@@ -65,10 +140,86 @@ extern "C" {
  * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
  *
  * @return      the size of the resolved address on success
+ * @return      -ENOENT, if the name has no address of @p family
  * @return      < 0 otherwise
  */
 int sock_dns_query(const char *domain_name, void *addr_out, int family);
 
+#if IS_USED(MODULE_SOCK_DNS_ASYNC) || defined(DOXYGEN)
+/**
+ * @brief   Asynchronous DNS query
+ *
+ * All members but sock_dns_async_t::res and sock_dns_async_t::addr are
+ * private.
+ */
+typedef struct sock_dns_async {
+    /**
+     * @brief   Event posted when the query finished
+     *
+     * The handler is the one given to @ref sock_dns_query_async().
+     */
+    event_t super;
+    int res;                            /**< result, see @ref sock_dns_query() */
+    uint8_t addr[16];                   /**< resolved address */
+    event_queue_t *queue;               /**< queue driving the query */
+    sock_udp_t sock;                    /**< sock of the exchange */
+    event_timeout_t timeout;            /**< retransmission timeout */
+    event_t timeout_event;              /**< event of the retransmission timeout */
+    struct sock_dns_cache_entry *entry; /**< cache entry of the query in flight */
+    uint16_t id;                        /**< ID of the query message */
+    uint8_t family;                     /**< requested address family */
+    uint8_t tries;                      /**< number of queries sent */
+    char name[SOCK_DNS_MAX_NAME_LEN + 1];   /**< name to resolve */
+} sock_dns_async_t;
+
+/**
+ * @brief   Get IP address for DNS name without blocking
+ *
+ * Like @ref sock_dns_query(), but returns immediately. The exchange with the
+ * DNS server is driven from @p queue. When the query finished,
+ * sock_dns_async_t::res and sock_dns_async_t::addr of @p query are set and
+ * sock_dns_async_t::super is posted to @p queue. If the answer is in the
+ * cache, this happens before this function returns.
+ *
+ * @pre `(query != NULL) && (queue != NULL) && (handler != NULL)`
+ * @pre @p query is not in use by another query
+ *
+ * @param[out]  query           query object, must stay valid until the
+ *                              query finished or was cancelled
+ * @param[in]   queue           event queue to drive the query from
+ * @param[in]   handler         handler of the event posted on completion
+ * @param[in]   domain_name     DNS name to resolve into address
+ * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
+ *
+ * @return      0 if the query was started
+ * @return      -ECONNREFUSED, if no DNS server is configured
+ * @return      -ENOSPC, if @p domain_name is too long
+ * @return      < 0 on other errors creating the sock
+ */
+int sock_dns_query_async(sock_dns_async_t *query, event_queue_t *queue,
+                         event_handler_t handler, const char *domain_name,
+                         int family);
+
+/**
+ * @brief   Cancel an asynchronous DNS query
+ *
+ * No event will be posted for @p query afterwards.
+ *
+ * @note    Must be called from the thread handling the queue the query was
+ *          started on.
+ *
+ * @param[in,out] query         query to cancel
+ */
+void sock_dns_query_async_cancel(sock_dns_async_t *query);
+#endif /* MODULE_SOCK_DNS_ASYNC */
+
+#if IS_USED(MODULE_SOCK_DNS_CACHE) || defined(DOXYGEN)
+/**
+ * @brief   Remove all entries from the DNS cache
+ */
+void sock_dns_cache_flush(void);
+#endif
+
 /**
  * @brief global DNS server endpoint
  */
@@ -682,6 +682,96 @@ static inline ssize_t sock_udp_send(sock_udp_t *sock,
     return sock_udp_send_aux(sock, data, len, remote, NULL);
 }
 
+/**
+ * @brief   Descriptor of a datagram for @ref sock_udp_recv_many()
+ */
+typedef struct {
+    void *data;             /**< Buffer for the received data */
+    size_t max_len;         /**< Maximum space available at sock_udp_rx_msg_t::data */
+    size_t len;             /**< Number of bytes received into sock_udp_rx_msg_t::data */
+    sock_udp_ep_t remote;   /**< Remote end point of the received datagram */
+    /**
+     * @brief   Auxiliary data about the received datagram.
+     *          May be `NULL`, if it is not required by the application.
+     */
+    sock_udp_aux_rx_t *aux;
+} sock_udp_rx_msg_t;
+
+/**
+ * @brief   Descriptor of a datagram for @ref sock_udp_send_many()
+ */
+typedef struct {
+    const void *data;               /**< Data to send. May be `NULL` if `len == 0` */
+    size_t len;                     /**< Length of sock_udp_tx_msg_t::data */
+    /**
+     * @brief   Remote end point for the datagram.
+     *          May be `NULL`, if the sock has a remote end point.
+     */
+    const sock_udp_ep_t *remote;
+    /**
+     * @brief   Auxiliary data about the transmission.
+     *          May be `NULL`, if it is not required by the application.
+     */
+    sock_udp_aux_tx_t *aux;
+} sock_udp_tx_msg_t;
+
+/**
+ * @brief   Receives multiple UDP messages from remote end points
+ *
+ * Waits up to @p timeout for the first datagram and then takes all further
+ * datagrams that are already queued for @p sock, until @p numof datagrams
+ * were received. This is the equivalent of `recvmmsg()`: compared to calling
+ * @ref sock_udp_recv_aux() for each datagram, a timeout is only set up for
+ * the first datagram. Each datagram is still taken from the queue of @p sock
+ * on its own.
+ *
+ * A datagram that does not fit into the buffer of its descriptor is dropped.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (numof > 0)`
+ * @pre `(msgs[i].data != NULL) && (msgs[i].max_len > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Descriptors of the datagrams. sock_udp_rx_msg_t::len
+ *                      and sock_udp_rx_msg_t::remote are set for all
+ *                      received datagrams.
+ * @param[in] numof     Number of descriptors in @p msgs.
+ * @param[in] timeout   Timeout for the first datagram in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @return  The number of datagrams received on success (at least 1).
+ * @return  Any error of @ref sock_udp_recv_aux(), if no datagram was received.
+ */
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_rx_msg_t *msgs,
+                       unsigned numof, uint32_t timeout);
+
+/**
+ * @brief   Sends multiple UDP messages to remote end points
+ *
+ * This is the equivalent of `sendmmsg()`: the local end point is resolved
+ * only once for all datagrams and the implementation may hand the datagrams
+ * to the network stack without waiting for the transmission of each single
+ * one. Each datagram is still handed to the network stack on its own.
+ *
+ * @pre `(msgs != NULL) && (numof > 0)`
+ * @pre `(sock != NULL) || (msgs[i].remote != NULL)`
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in] msgs      Descriptors of the datagrams.
+ * @param[in] numof     Number of descriptors in @p msgs.
+ *
+ * @return  The number of datagrams sent on success. This may be less than
+ *          @p numof, if sending a datagram failed after the first one.
+ * @return  Any error of @ref sock_udp_send_aux(), if the first datagram could
+ *          not be sent.
+ */
+int sock_udp_send_many(sock_udp_t *sock, const sock_udp_tx_msg_t *msgs,
+                       unsigned numof);
+
 #include "sock_types.h"
 
 #ifdef __cplusplus
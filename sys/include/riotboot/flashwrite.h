@@ -50,6 +50,12 @@
  * fit into this and FLASHPAGE_SIZE must be a multiple of
  * RIOTBOOT_FLASHPAGE_BUFFER_SIZE
  *
+ * With module `riotboot_flashwrite_sha256`, the SHA-256 digest of the image
+ * is updated by riotboot_flashwrite_putbytes() while it is written, and
+ * riotboot_flashwrite_sha256() returns it without reading the slot back. This
+ * digest is over the data passed in, it does not detect a failed flash write.
+ * Use riotboot_flashwrite_verify_sha256() to verify the flash contents.
+ *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  * @author      Koen Zandberg <koen@bergzand.net>
  *
@@ -63,8 +69,12 @@
 extern "C" {
 #endif
 
+#include "kernel_defines.h"
 #include "riotboot/slot.h"
 #include "periph/flashpage.h"
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+#include "hashes/sha256.h"
+#endif
 
 /**
  * @brief Enable/disable raw writes to flash
@@ -121,6 +131,9 @@ typedef struct {
     uint8_t RIOTBOOT_FLASHPAGE_BUFFER_ATTRS
         firstblock_buf[RIOTBOOT_FLASHPAGE_BUFFER_SIZE];
 #endif
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256) || DOXYGEN
+    sha256_context_t sha256;                /**< digest of the image so far   */
+#endif
 } riotboot_flashwrite_t;
 
 /**
@@ -165,8 +178,15 @@ static inline int riotboot_flashwrite_init(riotboot_flashwrite_t *state,
                                            int target_slot)
 {
     /* initialize state, but skip "RIOT" */
-    return riotboot_flashwrite_init_raw(state, target_slot,
-                                        RIOTBOOT_FLASHWRITE_SKIPLEN);
+    int res = riotboot_flashwrite_init_raw(state, target_slot,
+                                           RIOTBOOT_FLASHWRITE_SKIPLEN);
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+    /* the digest is over the image as it is after
+     * riotboot_flashwrite_finish() */
+    sha256_update(&state->sha256, "RIOT", RIOTBOOT_FLASHWRITE_SKIPLEN);
+#endif
+    return res;
 }
 
 /**
@@ -273,6 +293,24 @@ size_t riotboot_flashwrite_slotsize(const riotboot_flashwrite_t *state);
 int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest,
                                       size_t img_size, int target_slot);
 
+/**
+ * @brief       Get the digest of the image written so far
+ *
+ * The digest is updated by @ref riotboot_flashwrite_putbytes(). After @ref
+ * riotboot_flashwrite_init(), it includes riotboot's magic number, so it
+ * matches the digest of the complete image. After @ref
+ * riotboot_flashwrite_init_raw(), it only covers the bytes put.
+ *
+ * Doesn't change @p state, the digest can be taken at any time.
+ *
+ * @note        Needs module `riotboot_flashwrite_sha256`
+ *
+ * @param[in]   state   ptr to state struct
+ * @param[out]  digest  the SHA-256 digest, SHA256_DIGEST_LENGTH bytes
+ */
+void riotboot_flashwrite_sha256(const riotboot_flashwrite_t *state,
+                                uint8_t *digest);
+
 #ifdef __cplusplus
 }
 #endif
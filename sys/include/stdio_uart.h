@@ -47,6 +47,29 @@
  *    low power scenarios being covered by RIOT. Thus, be prepared to
  *    loose output when using STDIO from ISR.
  *
+ * ## Buffered output
+ *
+ * By default, @ref stdio_write() returns when the last byte left the UART,
+ * a thread printing a line of 80 characters at 115200 baud is stalled for
+ * 7 ms. With the module `stdio_uart_async`, output is copied into a ring
+ * buffer of @ref STDIO_UART_TX_BUFSIZE bytes and sent by a thread of low
+ * priority:
+ * ```
+ * USEMODULE += stdio_uart_async
+ * ```
+ *
+ * On platforms with the feature `periph_uart_nonblocking`, the UART driver
+ * sends from its TX interrupt (or by DMA) and the thread only hands the
+ * bytes over. On all others, the thread polls the UART while it sends.
+ *
+ * If the buffer is full, @ref STDIO_UART_TX_OVERFLOW decides whether the
+ * writer waits for space, or bytes get lost. Writers in interrupt context or
+ * with interrupts disabled never wait. Output written before the thread
+ * starts in auto_init is sent synchronously.
+ *
+ * Output still in the buffer is lost when the system crashes or reboots,
+ * call @ref stdio_uart_flush() before. The kernel panic handler does so.
+ *
  * @{
  * @file
  *
@@ -86,6 +109,58 @@ extern "C" {
 #define STDIO_UART_RX_BUFSIZE   (64)
 #endif
 
+/**
+ * @name    Overflow policies of the TX buffer
+ * @{
+ */
+#define STDIO_UART_TX_BLOCK     (0)     /**< wait for space */
+#define STDIO_UART_TX_DROP      (1)     /**< drop the new bytes */
+#define STDIO_UART_TX_OVERWRITE (2)     /**< drop the oldest bytes */
+/** @} */
+
+#ifndef STDIO_UART_TX_BUFSIZE
+/**
+ * @brief TX buffer size for module `stdio_uart_async`, a power of two
+ */
+#define STDIO_UART_TX_BUFSIZE   (256)
+#endif
+
+#ifndef STDIO_UART_TX_OVERFLOW
+/**
+ * @brief What happens to output that doesn't fit in the TX buffer
+ */
+#define STDIO_UART_TX_OVERFLOW  STDIO_UART_TX_BLOCK
+#endif
+
+#ifndef STDIO_UART_TX_PRIO
+/**
+ * @brief Priority of the thread sending the TX buffer
+ */
+#define STDIO_UART_TX_PRIO      (THREAD_PRIORITY_MIN - 1)
+#endif
+
+#ifndef STDIO_UART_TX_STACKSIZE
+/**
+ * @brief Stack size of the thread sending the TX buffer
+ */
+#define STDIO_UART_TX_STACKSIZE (THREAD_STACKSIZE_SMALL)
+#endif
+
+/**
+ * @brief   Send the buffered output synchronously, and all output after it
+ *
+ * Meant for crashes and reboots, the buffer isn't used again. Does nothing
+ * without module `stdio_uart_async`.
+ */
+void stdio_uart_flush(void);
+
+/**
+ * @brief   Get the number of bytes lost because the TX buffer was full
+ *
+ * @return  number of bytes lost, 0 without module `stdio_uart_async`
+ */
+unsigned stdio_uart_dropped(void);
+
 #ifdef __cplusplus
 }
 #endif
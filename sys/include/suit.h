@@ -220,6 +220,8 @@ typedef struct {
     suit_param_ref_t param_digest;              /**< Payload verification digest */
     suit_param_ref_t param_uri;                 /**< Payload fetch URI */
     suit_param_ref_t param_size;                /**< Payload size */
+    suit_param_ref_t param_compression_info;    /**< Payload compression */
+    suit_param_ref_t param_unpack_info;         /**< Payload unpacking */
 
     /**
      * @brief Component offset inside the device memory.
@@ -324,6 +326,24 @@ int suit_component_name_to_string(const suit_manifest_t *manifest,
                                   const suit_component_t *component,
                                   char separator, char *buf, size_t buf_len);
 
+/**
+ * @brief Callback for payload data
+ *
+ * Called by the transports for each part of a payload, in order. Same
+ * signature as @ref suit_storage_helper().
+ *
+ * @param[in]   arg     user argument
+ * @param[in]   offset  offset of the part in the payload
+ * @param[in]   buf     payload data
+ * @param[in]   len     length of the payload data
+ * @param[in]   more    whether more data is coming
+ *
+ * @return              0 on success
+ * @return              <0 on error
+ */
+typedef int (*suit_payload_cb_t)(void *arg, size_t offset, uint8_t *buf,
+                                 size_t len, int more);
+
 /**
  * @brief Helper function for writing bytes on flash a specified offset
  *
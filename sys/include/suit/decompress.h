@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_suit
+ * @defgroup    sys_suit_decompress SUIT compressed payloads
+ * @brief       Decompresses SUIT payloads while they are fetched
+ *
+ * With module `suit_decompress`, a component may carry the
+ * `suit-parameter-compression-info` parameter. Its payload is then fetched
+ * compressed and decompressed on the fly, the storage backend only sees the
+ * decompressed image. The image size and digest in the manifest are those
+ * of the decompressed image.
+ *
+ * The only supported algorithm is heatshrink (@ref pkg_heatshrink), as it
+ * decompresses with a few hundred bytes of RAM. Its window and lookahead are
+ * fixed when building the package, the payload must be compressed with the
+ * same parameters (`-w 8 -l 4` by default). `dist/tools/suit/heatshrink.py`
+ * compresses payloads with these parameters and reports the size saved.
+ *
+ * @{
+ *
+ * @brief       SUIT payload decompression API
+ */
+
+#ifndef SUIT_DECOMPRESS_H
+#define SUIT_DECOMPRESS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "heatshrink_decoder.h"
+#include "suit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the buffer for decompressed data in bytes
+ *
+ * The storage backend is written in chunks of this size.
+ */
+#ifndef CONFIG_SUIT_DECOMPRESS_BUF_SIZE
+#define CONFIG_SUIT_DECOMPRESS_BUF_SIZE     (64U)
+#endif
+
+/**
+ * @name    SUIT compression algorithms
+ *
+ * Values of `suit-parameter-compression-info`
+ * @{
+ */
+#define SUIT_COMPRESSION_NONE           (0)     /**< payload not compressed */
+#define SUIT_COMPRESSION_LZ4            (4)     /**< LZ4, not supported */
+#define SUIT_COMPRESSION_HEATSHRINK     (-1)    /**< heatshrink, private use */
+/** @} */
+
+/**
+ * @brief   Decompression context
+ */
+typedef struct {
+    heatshrink_decoder decoder;     /**< heatshrink decoder state */
+    suit_payload_cb_t cb;           /**< receives the decompressed data */
+    void *arg;                      /**< argument of the callback */
+    size_t in;                      /**< compressed bytes consumed */
+    size_t out;                     /**< decompressed bytes handed on */
+    size_t len;                     /**< bytes in the buffer */
+    uint8_t buf[CONFIG_SUIT_DECOMPRESS_BUF_SIZE];   /**< decompressed data */
+} suit_decompress_t;
+
+/**
+ * @brief   Get the compression algorithm of a component
+ *
+ * @param[in]   manifest    the manifest
+ * @param[in]   comp        the component
+ *
+ * @return  SUIT_COMPRESSION_NONE if the payload is not compressed
+ * @return  one of the SUIT compression algorithms
+ */
+int32_t suit_decompress_get_algorithm(const suit_manifest_t *manifest,
+                                      const suit_component_t *comp);
+
+/**
+ * @brief   Start decompressing a payload
+ *
+ * @param[out]  ctx         decompression context
+ * @param[in]   cb          callback for the decompressed data
+ * @param[in]   arg         argument of the callback
+ */
+void suit_decompress_init(suit_decompress_t *ctx, suit_payload_cb_t cb,
+                          void *arg);
+
+/**
+ * @brief   Decompress the next part of a payload
+ *
+ * A @ref suit_payload_cb_t, with the context as @p arg. The parts must be
+ * passed in order.
+ *
+ * @param[in]   arg     the decompression context
+ * @param[in]   offset  offset of the part in the compressed payload
+ * @param[in]   buf     the compressed data
+ * @param[in]   len     length of the compressed data
+ * @param[in]   more    whether more data is coming
+ *
+ * @return  0 on success
+ * @return  <0 on error, from decompressing or the callback
+ */
+int suit_decompress_write(void *arg, size_t offset, uint8_t *buf, size_t len,
+                          int more);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SUIT_DECOMPRESS_H */
+/** @} */
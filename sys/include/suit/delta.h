@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_suit
+ * @defgroup    sys_suit_delta SUIT delta payloads
+ * @brief       Reconstructs SUIT payloads from the running image and a patch
+ *
+ * With module `suit_delta`, a component with `suit-parameter-unpack-info`
+ * set to @ref SUIT_UNPACK_DELTA fetches a patch instead of the whole image.
+ * The new image is reconstructed from the source image and the patch while
+ * the patch is fetched and written to the storage backend as usual. The
+ * image size and digest in the manifest are those of the new image.
+ *
+ * The source image is the running slot when module `riotboot_slot` is used,
+ * including its header. For other setups, it is set with
+ * @ref suit_delta_set_source().
+ *
+ * The patch is a sequence of bsdiff style records that is applied in a
+ * single pass, with a buffer of @ref CONFIG_SUIT_DELTA_BUF_SIZE bytes:
+ *
+ *     header: "RDIF" | source size | image size
+ *     record: diff length | extra length | seek
+ *             diff length bytes added to the source bytes
+ *             extra length bytes copied to the image
+ *
+ * All numbers are 32 bit little endian, seek is signed. After a record, the
+ * position in the source is moved by seek. The added bytes are mostly zero,
+ * so patches should be compressed as well (@ref sys_suit_decompress).
+ * `dist/tools/suit/delta.py` creates patches.
+ *
+ * @{
+ *
+ * @brief       SUIT delta payload API
+ */
+
+#ifndef SUIT_DELTA_H
+#define SUIT_DELTA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "suit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the buffer for the new image in bytes
+ *
+ * The storage backend is written in chunks of this size.
+ */
+#ifndef CONFIG_SUIT_DELTA_BUF_SIZE
+#define CONFIG_SUIT_DELTA_BUF_SIZE      (64U)
+#endif
+
+/**
+ * @name    SUIT unpack information
+ *
+ * Values of `suit-parameter-unpack-info`
+ * @{
+ */
+#define SUIT_UNPACK_NONE            (0)     /**< payload is the image */
+#define SUIT_UNPACK_DELTA           (-1)    /**< patch, private use */
+/** @} */
+
+/**
+ * @brief   Length of the patch header and of a record header in bytes
+ */
+#define SUIT_DELTA_HDR_LEN          (12U)
+
+/**
+ * @brief   Delta context
+ */
+typedef struct {
+    suit_payload_cb_t cb;           /**< receives the new image */
+    void *arg;                      /**< argument of the callback */
+    const uint8_t *src;             /**< source image */
+    size_t src_len;                 /**< length of the source image */
+    size_t img_len;                 /**< length of the new image */
+    size_t in;                      /**< patch bytes consumed */
+    size_t out;                     /**< image bytes handed on */
+    size_t pos;                     /**< position in the source image */
+    uint32_t diff;                  /**< diff bytes left in the record */
+    uint32_t extra;                 /**< extra bytes left in the record */
+    int32_t seek;                   /**< seek at the end of the record */
+    uint8_t state;                  /**< parser state */
+    uint8_t hdr_len;                /**< bytes in the header buffer */
+    uint8_t hdr[SUIT_DELTA_HDR_LEN];    /**< header being received */
+    size_t len;                     /**< bytes in the buffer */
+    uint8_t buf[CONFIG_SUIT_DELTA_BUF_SIZE];    /**< new image data */
+} suit_delta_t;
+
+/**
+ * @brief   Get the unpack information of a component
+ *
+ * @param[in]   manifest    the manifest
+ * @param[in]   comp        the component
+ *
+ * @return  SUIT_UNPACK_NONE if the payload is the image itself
+ * @return  one of the SUIT unpack information values
+ */
+int32_t suit_delta_get_unpack_info(const suit_manifest_t *manifest,
+                                   const suit_component_t *comp);
+
+/**
+ * @brief   Set the source image for the patches
+ *
+ * Overrides the running slot.
+ *
+ * @param[in]   src     the source image, must stay valid
+ * @param[in]   len     length of the source image
+ */
+void suit_delta_set_source(const uint8_t *src, size_t len);
+
+/**
+ * @brief   Start reconstructing an image
+ *
+ * @param[out]  ctx     delta context
+ * @param[in]   cb      callback for the new image
+ * @param[in]   arg     argument of the callback
+ *
+ * @return  0 on success
+ * @return  -ENOENT if there is no source image
+ */
+int suit_delta_init(suit_delta_t *ctx, suit_payload_cb_t cb, void *arg);
+
+/**
+ * @brief   Apply the next part of a patch
+ *
+ * A @ref suit_payload_cb_t, with the context as @p arg. The parts must be
+ * passed in order.
+ *
+ * @param[in]   arg     the delta context
+ * @param[in]   offset  offset of the part in the patch
+ * @param[in]   buf     the patch data
+ * @param[in]   len     length of the patch data
+ * @param[in]   more    whether more data is coming
+ *
+ * @return  0 on success
+ * @return  <0 on error, from applying the patch or the callback
+ */
+int suit_delta_write(void *arg, size_t offset, uint8_t *buf, size_t len,
+                     int more);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SUIT_DELTA_H */
+/** @} */
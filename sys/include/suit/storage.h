@@ -59,7 +59,9 @@
  * data and check the digest of the payload. @ref suit_storage_driver_t::read
  * must be implemented, providing piecewise reading of the data. @ref
  * suit_storage_driver_t::read_ptr is optional to implement, it can provide
- * direct read access on memory-mapped storage.
+ * direct read access on memory-mapped storage. @ref
+ * suit_storage_driver_t::sha256 is optional as well, a backend that hashes the
+ * payload while it is written provides the digest without reading it back.
  *
  * As the storage backend provides a mechanism to store persistent data,
  * functions are added to set and retrieve the manifest sequence number. While
@@ -82,9 +84,10 @@
  * 6.  At least one @ref suit_storage_driver_t::write calls to write the payload
  *     data.
  * 7.  @ref suit_storage_driver_t::finish to mark the end of the payload write.
- * 8.  @ref suit_storage_driver_t::read or @ref suit_storage_driver_t::read_ptr
- *     to read back the written payload. This to verify the digest of the
- *     payload with what is provided in the manifest.
+ * 8.  @ref suit_storage_driver_t::sha256, or @ref suit_storage_driver_t::read
+ *     or @ref suit_storage_driver_t::read_ptr to read back the written
+ *     payload. This to verify the digest of the payload with what is provided
+ *     in the manifest.
  * 9.  @ref suit_storage_driver_t::install if the digest matches with what is
  *     expected and the payload can be installed or marked as valid, or:
  * 10. @ref suit_storage_driver_t::erase if the digest does not match with what
@@ -104,6 +107,17 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Verify payloads by reading them back
+ *
+ * Set to 1 to read the payload back for the digest even if the backend
+ * provides @ref suit_storage_driver_t::sha256. This also catches data that
+ * didn't make it to the storage intact, at the cost of reading it all.
+ */
+#ifndef CONFIG_SUIT_STORAGE_READBACK
+#define CONFIG_SUIT_STORAGE_READBACK    0
+#endif
+
 /**
  * @brief   Forward declaration for storage struct
  */
@@ -189,6 +203,19 @@ typedef struct suit_storage_driver {
     int (*read_ptr)(suit_storage_t *storage,
                     const uint8_t **buf, size_t *len);
 
+    /**
+     * @brief Get the SHA-256 digest of the data written since the start
+     *
+     * @note Optional to implement
+     *
+     * @param[in]   storage     Storage context
+     * @param[out]  digest      The digest, SHA256_DIGEST_LENGTH bytes
+     *
+     * @returns     @ref SUIT_OK on successfully providing the digest
+     * @returns     @ref suit_error_t on error
+     */
+    int (*sha256)(suit_storage_t *storage, uint8_t *digest);
+
     /**
      * @brief Install the payload or mark the payload as valid
      *
@@ -376,6 +403,20 @@ static inline bool suit_storage_has_readptr(const suit_storage_t *storage)
     return (storage->driver->read_ptr);
 }
 
+/**
+ * @brief Check if the storage backend implements the @ref
+ * suit_storage_driver_t::sha256 function
+ *
+ * @param[in]   storage     Storage context
+ *
+ * @returns     True if the function is implemented,
+ * @returns     False otherwise
+ */
+static inline bool suit_storage_has_sha256(const suit_storage_t *storage)
+{
+    return (storage->driver->sha256);
+}
+
 /**
  * @brief Check if the storage backend implements the @ref
  * suit_storage_driver_t::match_offset function
@@ -487,6 +528,23 @@ static inline int suit_storage_read_ptr(suit_storage_t *storage, const uint8_t
     return storage->driver->read_ptr(storage, buf, len);
 }
 
+/**
+ * @brief Get the SHA-256 digest of the data written since the start
+ *
+ * @note Optional to implement
+ *
+ * @param[in]   storage     Storage context
+ * @param[out]  digest      The digest, SHA256_DIGEST_LENGTH bytes
+ *
+ * @returns     @ref SUIT_OK on successfully providing the digest
+ * @returns     @ref suit_error_t on error
+ */
+static inline int suit_storage_sha256(suit_storage_t *storage,
+                                      uint8_t *digest)
+{
+    return storage->driver->sha256(storage, digest);
+}
+
 /**
  * @brief Install the payload or mark the payload as valid
  *
@@ -26,6 +26,7 @@
 #define SUIT_TRANSPORT_COAP_H
 
 #include "net/nanocoap.h"
+#include "net/sock/udp.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -128,6 +129,19 @@ typedef enum {
 #define CONFIG_SUIT_COAP_BLOCKSIZE  COAP_BLOCKSIZE_64
 #endif
 
+/**
+ * @brief Number of Block2 requests kept outstanding during a SUIT download
+ *
+ * With 1, each block is requested after the previous one was received. With
+ * a larger window, the next blocks are requested while the previous ones are
+ * still in flight, which hides the round trip time on slow links. Blocks
+ * received out of order are buffered until they can be handed on in order,
+ * which takes `CONFIG_SUIT_COAP_WINDOW` blocks of stack.
+ */
+#ifndef CONFIG_SUIT_COAP_WINDOW
+#define CONFIG_SUIT_COAP_WINDOW     (1U)
+#endif
+
 /**
  * @brief    Performs a blockwise coap get request to the specified url.
  *
@@ -148,6 +162,31 @@ int suit_coap_get_blockwise_url(const char *url,
                                coap_blksize_t blksize,
                                coap_blockwise_cb_t callback, void *arg);
 
+/**
+ * @brief    Performs a blockwise coap get request with a window of
+ *           outstanding requests
+ *
+ * Keeps up to @p window Block2 requests in flight. Each request is
+ * retransmitted on its own, the blocks are handed to @p callback in order.
+ * As the size of the resource is not known in advance, up to @p window - 1
+ * requests beyond its end may be sent.
+ *
+ * @param[in]   remote     remote endpoint
+ * @param[in]   path       path of the resource
+ * @param[in]   blksize    sender suggested SZX for the COAP block request
+ * @param[in]   window     number of outstanding requests, at most
+ *                         @ref CONFIG_SUIT_COAP_WINDOW. 1 fetches one block
+ *                         after the other.
+ * @param[in]   callback   callback to be executed on each received block
+ * @param[in]   arg        optional function arguments
+ *
+ * @returns     -1         if failed to fetch the resource
+ * @returns      0         on success
+ */
+int suit_coap_get_blockwise_window(sock_udp_ep_t *remote, const char *path,
+                                   coap_blksize_t blksize, unsigned window,
+                                   coap_blockwise_cb_t callback, void *arg);
+
 /**
  * @brief   Trigger a SUIT udate
  *
@@ -44,14 +44,18 @@ typedef struct {
  * @brief 'fetch' a payload
  *
  * The payload fetched from the payloads array is indicated by the @ref
- * suit_manifest_t::component_current member
+ * suit_manifest_t::component_current member. It is handed to @p cb in a
+ * single part, just like the CoAP transport hands on the blocks.
  *
  * @param[in]   manifest    suit manifest context
+ * @param[in]   cb          callback for the payload
+ * @param[in]   arg         argument of the callback
  *
  * @returns     SUIT_OK if valid
  * @returns     negative otherwise
  */
-int suit_transport_mock_fetch(const suit_manifest_t *manifest);
+int suit_transport_mock_fetch(const suit_manifest_t *manifest,
+                              suit_payload_cb_t cb, void *arg);
 
 #ifdef __cplusplus
 }
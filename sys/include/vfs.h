@@ -320,6 +320,44 @@ typedef struct {
     char  d_name[VFS_NAME_MAX + 1]; /**< file name, relative to its containing directory */
 } vfs_dirent_t;
 
+/**
+ * @name    Readiness events of an open file
+ *
+ * Have the same values as the respective `POLL*` events of `poll()`.
+ * @{
+ */
+#define VFS_POLLIN      (0x0001U)   /**< data can be read without blocking */
+#define VFS_POLLOUT     (0x0004U)   /**< data can be written without blocking */
+#define VFS_POLLERR     (0x0008U)   /**< an error is pending, always reported */
+#define VFS_POLLHUP     (0x0010U)   /**< the peer hung up, always reported */
+#define VFS_POLLNVAL    (0x0020U)   /**< the file was closed, always reported */
+/** @} */
+
+/**
+ * @brief struct @c vfs_poll_waiter typedef
+ */
+typedef struct vfs_poll_waiter vfs_poll_waiter_t;
+
+/**
+ * @brief Waiter for events on an open file
+ *
+ * @see vfs_poll()
+ */
+struct vfs_poll_waiter {
+    vfs_poll_waiter_t *next;    /**< next waiter on the same file */
+    /**
+     * @brief Called when events the waiter is interested in became ready
+     *
+     * Called with interrupts disabled from the context that made the file
+     * ready, e.g. the thread of a network stack. It must not block.
+     *
+     * @param[in]  waiter   the waiter
+     * @param[in]  events   the events that became ready, VFS_POLL*
+     */
+    void (*notify)(vfs_poll_waiter_t *waiter, unsigned events);
+    unsigned events;            /**< events the waiter is interested in */
+};
+
 /**
  * @brief Operations on open files
  *
@@ -440,6 +478,35 @@ struct vfs_file_ops {
      * @return <0 on error
      */
     ssize_t (*write) (vfs_file_t *filp, const void *src, size_t nbytes);
+
+    /**
+     * @brief Check which events are ready on an open file
+     *
+     * If @p waiter is not NULL, it is added to the waiters of the file before
+     * checking, so no event gets lost in between. The file notifies it of
+     * every event in @c waiter->events (and of VFS_POLLERR, VFS_POLLHUP and
+     * VFS_POLLNVAL) that becomes ready, until it is removed with
+     * @ref vfs_file_ops::poll_del. When the file is closed, all its waiters
+     * are notified with VFS_POLLNVAL and removed.
+     *
+     * Files not implementing this are always ready for reading and writing.
+     *
+     * @see vfs_poll_waiters_add(), vfs_poll_waiters_notify()
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[in]  waiter   waiter to add, may be NULL
+     *
+     * @return bitmask of the VFS_POLL* events that are ready
+     */
+    unsigned (*poll) (vfs_file_t *filp, vfs_poll_waiter_t *waiter);
+
+    /**
+     * @brief Remove a waiter added by @ref vfs_file_ops::poll
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[in]  waiter   waiter to remove
+     */
+    void (*poll_del) (vfs_file_t *filp, vfs_poll_waiter_t *waiter);
 };
 
 /**
@@ -739,6 +806,70 @@ ssize_t vfs_read(int fd, void *dest, size_t count);
  */
 ssize_t vfs_write(int fd, const void *src, size_t count);
 
+/**
+ * @brief Check which events are ready on an open file
+ *
+ * If @p waiter is not NULL, its @c events are set to @p events and it is added
+ * to the waiters of the file. Its @c notify callback is then called whenever
+ * one of the events becomes ready, until it is removed again with
+ * @ref vfs_poll_del(). This allows waiting for many files without checking
+ * all of them again on every wakeup.
+ *
+ * Files that don't support this are always ready for reading and writing.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  events   events of interest, VFS_POLL*
+ * @param[in]  waiter   waiter to add to the file, may be NULL
+ *
+ * @return bitmask of the events in @p events that are ready, VFS_POLLERR,
+ *         VFS_POLLHUP and VFS_POLLNVAL are always included
+ * @return -EBADF, if @p fd is not open
+ */
+int vfs_poll(int fd, unsigned events, vfs_poll_waiter_t *waiter);
+
+/**
+ * @brief Remove a waiter added by @ref vfs_poll()
+ *
+ * Does nothing if @p waiter is not a waiter of the file, e.g. because the
+ * file was closed in between.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  waiter   waiter to remove
+ */
+void vfs_poll_del(int fd, vfs_poll_waiter_t *waiter);
+
+/**
+ * @brief Add a waiter to the list of waiters of a file
+ *
+ * Helper for file system drivers implementing @ref vfs_file_ops::poll.
+ *
+ * @param[in,out] list  list of waiters of the file
+ * @param[in]  waiter   waiter to add
+ */
+void vfs_poll_waiters_add(vfs_poll_waiter_t **list, vfs_poll_waiter_t *waiter);
+
+/**
+ * @brief Remove a waiter from the list of waiters of a file
+ *
+ * Helper for file system drivers implementing @ref vfs_file_ops::poll_del.
+ *
+ * @param[in,out] list  list of waiters of the file
+ * @param[in]  waiter   waiter to remove, does nothing if it is not in @p list
+ */
+void vfs_poll_waiters_del(vfs_poll_waiter_t **list, vfs_poll_waiter_t *waiter);
+
+/**
+ * @brief Notify the waiters of a file that events became ready
+ *
+ * May be called from interrupt context. Only waiters interested in one of
+ * @p events are notified. With VFS_POLLNVAL all waiters are removed, as the
+ * file is gone.
+ *
+ * @param[in,out] list  list of waiters of the file
+ * @param[in]  events   events that became ready, VFS_POLL*
+ */
+void vfs_poll_waiters_notify(vfs_poll_waiter_t **list, unsigned events);
+
 /**
  * @brief Open a directory for reading with readdir
  *
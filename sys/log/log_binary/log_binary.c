@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_log_binary
+ * @{
+ *
+ * @file
+ * @brief       Binary log module implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "base64.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "log.h"
+#include "mutex.h"
+#include "stdio_base.h"
+#include "thread.h"
+#include "ztimer.h"
+
+/* header and timestamp */
+#define RECORD_HDR_LEN      (2U)
+#define RECORD_MAX_LEN      (RECORD_HDR_LEN + LOG_BINARY_ARGS_MAX)
+#define MASK                (LOG_BINARY_BUFSIZE - 1)
+
+static_assert((LOG_BINARY_BUFSIZE & MASK) == 0,
+              "LOG_BINARY_BUFSIZE must be a power of two");
+
+static uint32_t _buf[LOG_BINARY_BUFSIZE];
+/* words written and read, wrapping */
+static unsigned _head;
+static unsigned _tail;
+/* records dropped since the last record of lost records */
+static uint32_t _lost;
+static bool _clock_ready;
+
+#if LOG_BINARY_STDIO
+/* unlocked when there are records */
+static mutex_t _data = MUTEX_INIT_LOCKED;
+static char _stack[THREAD_STACKSIZE_SMALL];
+#endif
+
+static void _put(uint32_t hdr, uint32_t now, const uint32_t *args,
+                 unsigned nargs)
+{
+    _buf[_head++ & MASK] = hdr;
+    _buf[_head++ & MASK] = now;
+    for (unsigned i = 0; i < nargs; i++) {
+        _buf[_head++ & MASK] = args[i];
+    }
+}
+
+void log_binary_write(uint32_t hdr, const uint32_t *args)
+{
+    unsigned nargs = LOG_BINARY_NARGS(hdr);
+    uint32_t now = _clock_ready ? ztimer_now(ZTIMER_USEC) : 0;
+    unsigned state = irq_disable();
+    unsigned space = LOG_BINARY_BUFSIZE - (_head - _tail);
+
+    if (_lost) {
+        /* the record of lost records goes in before the next record */
+        if (space < (2 * RECORD_HDR_LEN + 1 + nargs)) {
+            _lost++;
+            irq_restore(state);
+            return;
+        }
+        _put(LOG_BINARY_HDR(LOG_BINARY_ID_LOST, LOG_ERROR, 1), now, &_lost, 1);
+        _lost = 0;
+    }
+    else if (space < RECORD_HDR_LEN + nargs) {
+        _lost++;
+        irq_restore(state);
+        return;
+    }
+    _put(hdr, now, args, nargs);
+    irq_restore(state);
+
+#if LOG_BINARY_STDIO
+    mutex_unlock(&_data);
+#endif
+}
+
+size_t log_binary_read(uint32_t *buf, size_t len)
+{
+    size_t done = 0;
+    unsigned state = irq_disable();
+
+    while (_tail != _head) {
+        unsigned rec_len = RECORD_HDR_LEN +
+                           LOG_BINARY_NARGS(_buf[_tail & MASK]);
+
+        if (done + rec_len > len) {
+            break;
+        }
+        for (unsigned i = 0; i < rec_len; i++) {
+            buf[done++] = _buf[_tail++ & MASK];
+        }
+    }
+    irq_restore(state);
+
+    return done;
+}
+
+#if LOG_BINARY_STDIO
+static void _send(const uint32_t *rec, unsigned len)
+{
+    char line[sizeof(LOG_BINARY_PREFIX) - 1 + ((RECORD_MAX_LEN * 4 + 2) / 3) * 4
+              + 1];
+    size_t size = sizeof(line) - (sizeof(LOG_BINARY_PREFIX) - 1);
+
+    memcpy(line, LOG_BINARY_PREFIX, sizeof(LOG_BINARY_PREFIX) - 1);
+    base64_encode(rec, len * 4, &line[sizeof(LOG_BINARY_PREFIX) - 1], &size);
+    size += sizeof(LOG_BINARY_PREFIX) - 1;
+    line[size++] = '\n';
+    stdio_write(line, size);
+}
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+    uint32_t recs[RECORD_MAX_LEN];
+
+    while (1) {
+        size_t len = log_binary_read(recs, ARRAY_SIZE(recs));
+
+        if (len == 0) {
+            mutex_lock(&_data);
+            continue;
+        }
+        for (size_t pos = 0; pos < len;) {
+            unsigned rec_len = RECORD_HDR_LEN + LOG_BINARY_NARGS(recs[pos]);
+
+            _send(&recs[pos], rec_len);
+            pos += rec_len;
+        }
+    }
+
+    return NULL;
+}
+#endif
+
+void log_binary_init(void)
+{
+    _clock_ready = true;
+#if LOG_BINARY_STDIO
+    thread_create(_stack, sizeof(_stack), LOG_BINARY_PRIO,
+                  THREAD_CREATE_STACKTEST, _thread, NULL, "log_binary");
+#endif
+}
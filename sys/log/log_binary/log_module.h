@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_log_binary Binary log module
+ * @ingroup     sys
+ * @brief       Records log messages in binary, formatted on the host
+ *
+ * With this module, the `LOG_*` macros don't format the message. They store
+ * the ID of the format string, a timestamp and the arguments in a ring buffer
+ * in RAM, a few stores instead of a call to printf. The format strings are
+ * placed in section `.log_binary` of the ELF file, which isn't loaded to the
+ * device. The ID of a string is its offset in that section.
+ *
+ * A thread of low priority sends the records to stdio, one line each. The
+ * tool `dist/tools/log_binary/log_binary.py` turns them back into text with
+ * the format strings from the ELF file:
+ * ```
+ * make term | dist/tools/log_binary/log_binary.py bin/<board>/<app>.elf
+ * ```
+ *
+ * With @ref LOG_BINARY_STDIO set to 0, the thread isn't started and the
+ * application takes the records with @ref log_binary_read(), e.g. to store
+ * them in flash.
+ *
+ * The arguments are stored as 32 bit words, which limits them:
+ * - the format must be a string literal, with at most
+ *   @ref LOG_BINARY_ARGS_MAX arguments
+ * - 64 bit integers are cut to 32 bits, `double` is stored as `float`
+ * - `%s` is only decoded for strings in the ELF file, e.g. string literals,
+ *   as only the pointer is stored
+ * - the arguments are converted with `_Generic`, the module can't be used
+ *   from C++
+ *
+ * If the ring buffer is full, new records are dropped and the decoder prints
+ * the number of lost records.
+ *
+ * @{
+ *
+ * @file
+ * @brief       log_module header
+ */
+
+#ifndef LOG_MODULE_H
+#define LOG_MODULE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef LOG_BINARY_BUFSIZE
+/**
+ * @brief   Size of the ring buffer in 32 bit words, a power of two
+ */
+#define LOG_BINARY_BUFSIZE      (128U)
+#endif
+
+#ifndef LOG_BINARY_STDIO
+/**
+ * @brief   Send the records to stdio
+ */
+#define LOG_BINARY_STDIO        (1)
+#endif
+
+#ifndef LOG_BINARY_PRIO
+/**
+ * @brief   Priority of the thread sending the records to stdio
+ */
+#define LOG_BINARY_PRIO         (THREAD_PRIORITY_MIN - 1)
+#endif
+
+/**
+ * @brief   Maximum number of arguments of a log message
+ */
+#define LOG_BINARY_ARGS_MAX     (8U)
+
+/**
+ * @brief   Start of a record in the output on stdio
+ */
+#define LOG_BINARY_PREFIX       "~L"
+
+/**
+ * @brief   ID of the record of lost records
+ */
+#define LOG_BINARY_ID_LOST      (0xffffffU)
+
+/**
+ * @brief   Record header, made of the ID, the level and the number of
+ *          arguments
+ */
+#define LOG_BINARY_HDR(id, level, nargs) \
+    (((uint32_t)(id) << 8) | (((level) & 0xf) << 4) | (nargs))
+
+/**
+ * @brief   Get the number of arguments of a record from its header
+ */
+#define LOG_BINARY_NARGS(hdr)   ((hdr) & 0xf)
+
+/**
+ * @brief   Convert a log argument to a 32 bit word
+ */
+#define LOG_BINARY_ARG(x) _Generic((x), \
+        float: log_binary_float(_Generic((x), float: (x), default: 0)), \
+        double: log_binary_float(_Generic((x), double: (x), default: 0)), \
+        default: (uint32_t)(uintptr_t)(x))
+
+#ifndef DOXYGEN
+#define _LOG_BINARY_A0()
+#define _LOG_BINARY_A1(a) , LOG_BINARY_ARG(a)
+#define _LOG_BINARY_A2(a, ...) , LOG_BINARY_ARG(a) _LOG_BINARY_A1(__VA_ARGS__)
+#define _LOG_BINARY_A3(a, ...) , LOG_BINARY_ARG(a) _LOG_BINARY_A2(__VA_ARGS__)
+#define _LOG_BINARY_A4(a, ...) , LOG_BINARY_ARG(a) _LOG_BINARY_A3(__VA_ARGS__)
+#define _LOG_BINARY_A5(a, ...) , LOG_BINARY_ARG(a) _LOG_BINARY_A4(__VA_ARGS__)
+#define _LOG_BINARY_A6(a, ...) , LOG_BINARY_ARG(a) _LOG_BINARY_A5(__VA_ARGS__)
+#define _LOG_BINARY_A7(a, ...) , LOG_BINARY_ARG(a) _LOG_BINARY_A6(__VA_ARGS__)
+#define _LOG_BINARY_A8(a, ...) , LOG_BINARY_ARG(a) _LOG_BINARY_A7(__VA_ARGS__)
+#define _LOG_BINARY_SEL(_0, _1, _2, _3, _4, _5, _6, _7, _8, n, ...) n
+/* expands to ", arg0, arg1, ...", the comma before an empty __VA_ARGS__ is
+ * swallowed */
+#define _LOG_BINARY_ARGS(...) \
+    _LOG_BINARY_SEL(_, ##__VA_ARGS__, _LOG_BINARY_A8, _LOG_BINARY_A7, \
+                    _LOG_BINARY_A6, _LOG_BINARY_A5, _LOG_BINARY_A4, \
+                    _LOG_BINARY_A3, _LOG_BINARY_A2, _LOG_BINARY_A1, \
+                    _LOG_BINARY_A0)(__VA_ARGS__)
+#endif
+
+/**
+ * @brief   log_write overridden function
+ *
+ * Places @p format in the section `.log_binary` and records its ID with the
+ * arguments.
+ *
+ * @param[in] level     level of the message
+ * @param[in] format    format string, a string literal
+ */
+#define log_write(level, format, ...) do { \
+        static const char _log_binary_fmt[] \
+            __attribute__((section(".log_binary.fmt"), used)) = format; \
+        const uint32_t _log_binary_args[] = { \
+            0 _LOG_BINARY_ARGS(__VA_ARGS__) \
+        }; \
+        log_binary_write(LOG_BINARY_HDR((uintptr_t)_log_binary_fmt, level, \
+                                        sizeof(_log_binary_args) / 4 - 1), \
+                         &_log_binary_args[1]); \
+    } while (0U)
+
+/**
+ * @brief   Record a log message
+ *
+ * Safe to call from interrupt context.
+ *
+ * @param[in] hdr       header of the record, see @ref LOG_BINARY_HDR
+ * @param[in] args      arguments, as many as the header says
+ */
+void log_binary_write(uint32_t hdr, const uint32_t *args);
+
+/**
+ * @brief   Take records from the ring buffer
+ *
+ * A record is a header (see @ref LOG_BINARY_HDR), a timestamp in
+ * microseconds and the arguments, each a 32 bit word in the byte order of
+ * the device. Only whole records are taken.
+ *
+ * @param[out] buf      buffer for the records
+ * @param[in]  len      size of @p buf in 32 bit words
+ *
+ * @return  number of words taken, 0 if there are no records
+ */
+size_t log_binary_read(uint32_t *buf, size_t len);
+
+/**
+ * @brief   Convert a floating point argument to a 32 bit word
+ *
+ * @param[in] val   the argument
+ *
+ * @return  the bits of @p val as `float`
+ */
+static inline uint32_t log_binary_float(float val)
+{
+    union {
+        float f;
+        uint32_t u;
+    } conv = { .f = val };
+
+    return conv.u;
+}
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
+#endif /* LOG_MODULE_H */
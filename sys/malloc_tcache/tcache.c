@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_malloc_tcache
+ * @{
+ *
+ * @file
+ * @brief       Thread caches for malloc
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "memarray.h"
+#include "mutex.h"
+#include "thread.h"
+
+#include "malloc_tcache.h"
+
+#define POOL_SIZE       (CONFIG_MALLOC_TCACHE_BLOCKS * \
+                         CONFIG_MALLOC_TCACHE_MIN * \
+                         ((1U << CONFIG_MALLOC_TCACHE_CLASSES) - 1))
+/* blocks moved between a cache and its pool at once */
+#define BATCH           ((CONFIG_MALLOC_TCACHE_DEPTH + 1) / 2)
+
+static_assert(CONFIG_MALLOC_TCACHE_MIN >= sizeof(void *),
+              "blocks must hold a pointer");
+static_assert((CONFIG_MALLOC_TCACHE_MIN & (CONFIG_MALLOC_TCACHE_MIN - 1)) == 0,
+              "CONFIG_MALLOC_TCACHE_MIN must be a power of two");
+static_assert(CONFIG_MALLOC_TCACHE_DEPTH <= UINT8_MAX,
+              "CONFIG_MALLOC_TCACHE_DEPTH too large");
+
+typedef struct {
+    void *head;             /**< free blocks, linked through their start */
+    uint8_t num;            /**< number of free blocks */
+} _cache_t;
+
+static mutex_t _lock;
+static bool _init;
+static malloc_tcache_stats_t _stats;
+static memarray_t _pools[CONFIG_MALLOC_TCACHE_CLASSES];
+static _cache_t _caches[MAXTHREADS][CONFIG_MALLOC_TCACHE_CLASSES];
+/* updated by the owning thread only */
+static uint32_t _hits[MAXTHREADS];
+static uint8_t _pool[POOL_SIZE] __attribute__((aligned(sizeof(void *) * 2)));
+
+static size_t _class_size(unsigned cls)
+{
+    return CONFIG_MALLOC_TCACHE_MIN << cls;
+}
+
+static size_t _class_start(unsigned cls)
+{
+    return CONFIG_MALLOC_TCACHE_BLOCKS * CONFIG_MALLOC_TCACHE_MIN *
+           ((1U << cls) - 1);
+}
+
+static int _class_of(const void *ptr)
+{
+    const uint8_t *p = ptr;
+
+    if ((p < _pool) || (p >= _pool + sizeof(_pool))) {
+        return -1;
+    }
+    for (unsigned cls = CONFIG_MALLOC_TCACHE_CLASSES - 1; ; cls--) {
+        if ((size_t)(p - _pool) >= _class_start(cls)) {
+            return cls;
+        }
+    }
+}
+
+/* index of the caches of the running thread */
+static int _get_idx(void)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    /* no thread running yet */
+    return pid_is_valid(pid) ? pid - KERNEL_PID_FIRST : -1;
+}
+
+void malloc_tcache_lock(void)
+{
+    bool contended = !mutex_trylock(&_lock);
+
+    if (contended) {
+        mutex_lock(&_lock);
+    }
+    _stats.locked++;
+    _stats.contended += contended;
+}
+
+void malloc_tcache_unlock(void)
+{
+    mutex_unlock(&_lock);
+}
+
+static void _pools_init(void)
+{
+    for (unsigned cls = 0; cls < CONFIG_MALLOC_TCACHE_CLASSES; cls++) {
+        memarray_init(&_pools[cls], &_pool[_class_start(cls)],
+                      _class_size(cls), CONFIG_MALLOC_TCACHE_BLOCKS);
+    }
+    _init = true;
+}
+
+static void _push(_cache_t *cache, void *block)
+{
+    *(void **)block = cache->head;
+    cache->head = block;
+    cache->num++;
+}
+
+static void *_pop(_cache_t *cache)
+{
+    void *block = cache->head;
+
+    cache->head = *(void **)block;
+    cache->num--;
+    return block;
+}
+
+/* called with the lock taken */
+static void _flush(_cache_t *cache, unsigned cls, unsigned num)
+{
+    while (num-- && cache->head) {
+        memarray_free(&_pools[cls], _pop(cache));
+    }
+}
+
+void *malloc_tcache_alloc(size_t size)
+{
+    int idx = _get_idx();
+    unsigned cls = 0;
+
+    if ((size > MALLOC_TCACHE_MAX) || (idx < 0)) {
+        return NULL;
+    }
+    while (_class_size(cls) < size) {
+        cls++;
+    }
+
+    _cache_t *cache = &_caches[idx][cls];
+
+    if (cache->head) {
+        _hits[idx]++;
+        return _pop(cache);
+    }
+    /* read without the lock, an outdated value only costs a heap allocation
+     * or taking the lock for nothing */
+    if (_init && !_pools[cls].free_data) {
+        return NULL;
+    }
+
+    malloc_tcache_lock();
+    if (!_init) {
+        _pools_init();
+    }
+    for (unsigned i = 0; i < BATCH; i++) {
+        void *block = memarray_alloc(&_pools[cls]);
+
+        if (!block) {
+            break;
+        }
+        _push(cache, block);
+    }
+    _stats.refills++;
+    malloc_tcache_unlock();
+
+    return cache->head ? _pop(cache) : NULL;
+}
+
+int malloc_tcache_free(void *ptr)
+{
+    int cls = _class_of(ptr);
+
+    if (cls < 0) {
+        return 0;
+    }
+
+    int idx = _get_idx();
+
+    if (idx < 0) {
+        malloc_tcache_lock();
+        memarray_free(&_pools[cls], ptr);
+        malloc_tcache_unlock();
+        return 1;
+    }
+
+    _cache_t *cache = &_caches[idx][cls];
+
+    _push(cache, ptr);
+    if (cache->num > CONFIG_MALLOC_TCACHE_DEPTH) {
+        malloc_tcache_lock();
+        _flush(cache, cls, BATCH);
+        _stats.flushes++;
+        malloc_tcache_unlock();
+    }
+    return 1;
+}
+
+size_t malloc_tcache_size(const void *ptr)
+{
+    int cls = _class_of(ptr);
+
+    return (cls < 0) ? 0 : _class_size(cls);
+}
+
+void malloc_tcache_flush(void)
+{
+    int idx = _get_idx();
+
+    if (idx < 0) {
+        return;
+    }
+    malloc_tcache_lock();
+    for (unsigned cls = 0; cls < CONFIG_MALLOC_TCACHE_CLASSES; cls++) {
+        _flush(&_caches[idx][cls], cls, CONFIG_MALLOC_TCACHE_DEPTH);
+    }
+    _stats.flushes++;
+    malloc_tcache_unlock();
+}
+
+void malloc_tcache_get_stats(malloc_tcache_stats_t *stats)
+{
+    /* not counted in the statistics */
+    mutex_lock(&_lock);
+    *stats = _stats;
+    mutex_unlock(&_lock);
+    stats->hits = 0;
+    for (unsigned i = 0; i < MAXTHREADS; i++) {
+        stats->hits += _hits[i];
+    }
+}
+
+void malloc_tcache_print_stats(void)
+{
+    malloc_tcache_stats_t stats;
+
+    malloc_tcache_get_stats(&stats);
+    printf("tcache: %" PRIu32 " hits, %" PRIu32 " refills, %" PRIu32
+           " flushes\n", stats.hits, stats.refills, stats.flushes);
+    printf("lock: taken %" PRIu32 " times, %" PRIu32 " contended, "
+           "%" PRIu32 " heap operations\n", stats.locked, stats.contended,
+           stats.locked - stats.refills - stats.flushes);
+    for (unsigned cls = 0; cls < CONFIG_MALLOC_TCACHE_CLASSES; cls++) {
+        unsigned cached = 0;
+
+        for (unsigned i = 0; i < MAXTHREADS; i++) {
+            cached += _caches[i][cls].num;
+        }
+        printf("class %4u: %2u/%u in pool, %2u cached\n",
+               (unsigned)_class_size(cls),
+               _init ? (unsigned)memarray_available(&_pools[cls])
+                     : CONFIG_MALLOC_TCACHE_BLOCKS,
+               CONFIG_MALLOC_TCACHE_BLOCKS, cached);
+    }
+}
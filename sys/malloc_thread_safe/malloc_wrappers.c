@@ -18,29 +18,68 @@
 
 #include "assert.h"
 #include "irq.h"
+#include "kernel_defines.h"
 #include "mutex.h"
 
+#if IS_USED(MODULE_MALLOC_TCACHE)
+#include "malloc_tcache.h"
+#endif
+
 extern void *__real_malloc(size_t size);
 extern void __real_free(void *ptr);
 extern void *__real_realloc(void *ptr, size_t size);
 
+#if IS_USED(MODULE_MALLOC_TCACHE)
+/* the caches share the lock and count it in their statistics */
+static inline void _heap_lock(void)
+{
+    malloc_tcache_lock();
+}
+
+static inline void _heap_unlock(void)
+{
+    malloc_tcache_unlock();
+}
+#else
 static mutex_t _lock;
 
+static inline void _heap_lock(void)
+{
+    mutex_lock(&_lock);
+}
+
+static inline void _heap_unlock(void)
+{
+    mutex_unlock(&_lock);
+}
+#endif
+
 void *__wrap_malloc(size_t size)
 {
     assert(!irq_is_in());
-    mutex_lock(&_lock);
+#if IS_USED(MODULE_MALLOC_TCACHE)
+    void *block = malloc_tcache_alloc(size);
+    if (block) {
+        return block;
+    }
+#endif
+    _heap_lock();
     void *ptr = __real_malloc(size);
-    mutex_unlock(&_lock);
+    _heap_unlock();
     return ptr;
 }
 
 void __wrap_free(void *ptr)
 {
     assert(!irq_is_in());
-    mutex_lock(&_lock);
+#if IS_USED(MODULE_MALLOC_TCACHE)
+    if (malloc_tcache_free(ptr)) {
+        return;
+    }
+#endif
+    _heap_lock();
     __real_free(ptr);
-    mutex_unlock(&_lock);
+    _heap_unlock();
 }
 
 void *__wrap_calloc(size_t nmemb, size_t size)
@@ -64,9 +103,28 @@ void *__wrap_calloc(size_t nmemb, size_t size)
 void *__wrap_realloc(void *ptr, size_t size)
 {
     assert(!irq_is_in());
-    mutex_lock(&_lock);
+#if IS_USED(MODULE_MALLOC_TCACHE)
+    size_t old_size = malloc_tcache_size(ptr);
+
+    if (!ptr) {
+        return __wrap_malloc(size);
+    }
+    if (old_size) {
+        /* blocks of the caches don't shrink, moving up may leave them */
+        if (size <= old_size) {
+            return ptr;
+        }
+        void *block = __wrap_malloc(size);
+        if (block) {
+            memcpy(block, ptr, old_size);
+            malloc_tcache_free(ptr);
+        }
+        return block;
+    }
+#endif
+    _heap_lock();
     void *new = __real_realloc(ptr, size);
-    mutex_unlock(&_lock);
+    _heap_unlock();
     return new;
 }
 
@@ -26,6 +26,9 @@
 
 #include "net/dns/msg.h"
 
+/* length of the MINIMUM field at the end of SOA RDATA */
+#define SOA_MINIMUM_LENGTH  (4U)
+
 static ssize_t _enc_domain_name(uint8_t *out, const char *domain_name)
 {
     /*
@@ -130,12 +133,64 @@ size_t dns_msg_compose_query(void *dns_buf, const char *domain_name,
     return bufpos - buf;
 }
 
-int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
-                        void *addr_out)
+static uint32_t _get_long(const uint8_t *buf)
+{
+    uint32_t _tmp;
+    memcpy(&_tmp, buf, 4);
+    return ntohl(_tmp);
+}
+
+/* returns the TTL for a negative answer from the SOA record in the authority
+ * section (RFC 2308, section 5) or 0 if there is none */
+static uint32_t _parse_neg_ttl(const uint8_t *buf, size_t len,
+                               const uint8_t *bufpos, unsigned nscount)
+{
+    const uint8_t *buflim = buf + len;
+
+    for (unsigned n = 0; n < nscount; n++) {
+        ssize_t tmp = _skip_hostname(buf, len, bufpos);
+        if (tmp < 0) {
+            return 0;
+        }
+        bufpos += tmp;
+        if ((bufpos + RR_TYPE_LENGTH + RR_CLASS_LENGTH +
+             RR_TTL_LENGTH + RR_RDLENGTH_LENGTH) > buflim) {
+            return 0;
+        }
+        uint16_t _type = ntohs(_get_short(bufpos));
+        uint32_t ttl = _get_long(bufpos + RR_TYPE_LENGTH + RR_CLASS_LENGTH);
+        bufpos += RR_TYPE_LENGTH + RR_CLASS_LENGTH + RR_TTL_LENGTH;
+        unsigned rdlen = ntohs(_get_short(bufpos));
+        bufpos += RR_RDLENGTH_LENGTH;
+        if ((rdlen > len) || ((bufpos + rdlen) > buflim)) {
+            return 0;
+        }
+        /* MINIMUM is the last field of the SOA RDATA */
+        if ((_type == DNS_TYPE_SOA) && (rdlen >= SOA_MINIMUM_LENGTH)) {
+            uint32_t minimum = _get_long(bufpos + rdlen - SOA_MINIMUM_LENGTH);
+            return (minimum < ttl) ? minimum : ttl;
+        }
+        bufpos += rdlen;
+    }
+    return 0;
+}
+
+int dns_msg_parse_reply_ttl(const uint8_t *buf, size_t len, int family,
+                            void *addr_out, uint32_t *ttl_out)
 {
     const uint8_t *buflim = buf + len;
     const dns_hdr_t *hdr = (dns_hdr_t *)buf;
     const uint8_t *bufpos = buf + sizeof(*hdr);
+    uint32_t min_ttl = UINT32_MAX;
+    unsigned rcode;
+
+    if (len < sizeof(*hdr)) {
+        return -EBADMSG;
+    }
+    rcode = ntohs(hdr->flags) & DNS_MSG_RCODE_MASK;
+    if ((rcode != DNS_MSG_RCODE_NOERROR) && (rcode != DNS_MSG_RCODE_NXDOMAIN)) {
+        return -EBADMSG;
+    }
 
     /* skip all queries that are part of the reply */
     for (unsigned n = 0; n < ntohs(hdr->qdcount); n++) {
@@ -162,9 +217,14 @@ int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
         bufpos += RR_TYPE_LENGTH;
         uint16_t class = ntohs(_get_short(bufpos));
         bufpos += RR_CLASS_LENGTH;
-        bufpos += RR_TTL_LENGTH; /* skip ttl */
+        uint32_t ttl = _get_long(bufpos);
+        bufpos += RR_TTL_LENGTH;
 
         unsigned addrlen = ntohs(_get_short(bufpos));
+        /* the address is only valid as long as e.g. a preceding CNAME */
+        if (ttl < min_ttl) {
+            min_ttl = ttl;
+        }
         /* skip unwanted answers */
         if ((class != DNS_CLASS_IN) ||
                 ((_type == DNS_TYPE_A) && (family == AF_INET6)) ||
@@ -175,7 +235,7 @@ int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
                 /* buffer wraps around memory space */
                 return -EBADMSG;
             }
-            bufpos += addrlen;
+            bufpos += RR_RDLENGTH_LENGTH + addrlen;
             /* other out-of-bound is checked in `_skip_hostname()` at start of
              * loop */
             continue;
@@ -192,10 +252,25 @@ int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
         }
 
         memcpy(addr_out, bufpos, addrlen);
+        if (ttl_out != NULL) {
+            *ttl_out = min_ttl;
+        }
         return addrlen;
     }
 
-    return -EBADMSG;
+    /* a well-formed answer without a matching address */
+    if (ttl_out != NULL) {
+        *ttl_out = _parse_neg_ttl(buf, len, bufpos, ntohs(hdr->nscount));
+    }
+    return -ENOENT;
+}
+
+int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
+                        void *addr_out)
+{
+    int res = dns_msg_parse_reply_ttl(buf, len, family, addr_out, NULL);
+
+    return (res == -ENOENT) ? -EBADMSG : res;
 }
 
 /** @} */
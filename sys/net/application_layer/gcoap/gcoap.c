@@ -39,6 +39,11 @@
 #include "net/dsm.h"
 #endif
 
+#if IS_USED(MODULE_GCOAP_COCOA)
+#include "congure/cocoa.h"
+#include "ztimer.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -83,6 +88,12 @@ static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *
 static void _dtls_free_up_session(void *arg);
 #endif
 
+#if IS_USED(MODULE_GCOAP_COCOA)
+static uint32_t _cocoa_initial_timeout(gcoap_request_memo_t *memo);
+static uint32_t _cocoa_backoff(gcoap_request_memo_t *memo);
+static void _cocoa_report_ack(const gcoap_request_memo_t *memo);
+#endif
+
 /* Internal variables */
 const coap_resource_t _default_resources[] = {
     { "/.well-known/core", COAP_GET, _well_known_core_handler, NULL },
@@ -96,6 +107,15 @@ static gcoap_listener_t _default_listener = {
     _request_matcher_default
 };
 
+#if IS_USED(MODULE_GCOAP_COCOA)
+/* RTO estimation for a remote endpoint */
+typedef struct {
+    congure_cocoa_snd_t cong;           /* Estimator; unused if driver is NULL */
+    sock_udp_ep_t remote;               /* Remote endpoint */
+    uint32_t last_used;                 /* Time of last use [in msec] */
+} gcoap_cocoa_peer_t;
+#endif
+
 /* Container for the state of gcoap itself */
 typedef struct {
     mutex_t lock;                       /* Shares state attributes safely */
@@ -114,6 +134,10 @@ typedef struct {
                                         /* Buffers for PDU for request resends;
                                            if first byte of an entry is zero,
                                            the entry is available */
+#if IS_USED(MODULE_GCOAP_COCOA)
+    gcoap_cocoa_peer_t cocoa_peers[CONFIG_GCOAP_COCOA_PEERS];
+                                        /* RTO estimations of remote endpoints */
+#endif
 } gcoap_state_t;
 
 static gcoap_state_t _coap_state = {
@@ -364,6 +388,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote,
                 _find_req_memo(&memo, &pdu, remote, true);
                 if ((memo != NULL) && (memo->send_limit != GCOAP_SEND_LIMIT_NON)) {
                     DEBUG("gcoap: empty ACK processed, stopping retransmissions\n");
+#if IS_USED(MODULE_GCOAP_COCOA)
+                    _cocoa_report_ack(memo);
+#endif
                     _cease_retransmission(memo);
                 } else {
                     DEBUG("gcoap: empty ACK matches no known CON, ignoring\n");
@@ -414,6 +441,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote,
                 if (memo->resp_evt_tmout.queue) {
                     event_timeout_clear(&memo->resp_evt_tmout);
                 }
+#if IS_USED(MODULE_GCOAP_COCOA)
+                _cocoa_report_ack(memo);
+#endif
                 memo->state = truncated ? GCOAP_MEMO_RESP_TRUNC : GCOAP_MEMO_RESP;
                 if (memo->resp_handler) {
                     memo->resp_handler(memo, &pdu, remote);
@@ -466,6 +496,9 @@ static void _on_resp_timeout(void *arg) {
     /* reduce retries remaining, double timeout and resend */
     else {
         memo->send_limit--;
+#if IS_USED(MODULE_GCOAP_COCOA)
+        uint32_t timeout  = _cocoa_backoff(memo);
+#else
 #ifdef CONFIG_GCOAP_NO_RETRANS_BACKOFF
         unsigned i        = 0;
 #else
@@ -475,6 +508,7 @@ static void _on_resp_timeout(void *arg) {
 #if CONFIG_COAP_RANDOM_FACTOR_1000 > 1000
         uint32_t end = ((uint32_t)TIMEOUT_RANGE_END << i) * US_PER_SEC;
         timeout = random_uint32_range(timeout, end);
+#endif
 #endif
         event_timeout_set(&memo->resp_evt_tmout, timeout);
 
@@ -521,6 +555,105 @@ static void _cease_retransmission(gcoap_request_memo_t *memo) {
     memo->state = GCOAP_MEMO_WAIT;
 }
 
+#if IS_USED(MODULE_GCOAP_COCOA)
+/* Finds the RTO estimation for a remote endpoint. If none exists and create
+ * is set, replaces the least recently used estimation.
+ *
+ * Caller must hold _coap_state.lock. Returns NULL if not found. */
+static congure_cocoa_snd_t *_cocoa_find(const sock_udp_ep_t *remote,
+                                        uint32_t now, bool create)
+{
+    gcoap_cocoa_peer_t *lru = NULL;
+
+    for (unsigned i = 0; i < CONFIG_GCOAP_COCOA_PEERS; i++) {
+        gcoap_cocoa_peer_t *peer = &_coap_state.cocoa_peers[i];
+
+        if (peer->cong.super.driver == NULL) {
+            lru = peer;
+            continue;
+        }
+        if (sock_udp_ep_equal(&peer->remote, remote)) {
+            peer->last_used = now;
+            return &peer->cong;
+        }
+        if ((lru == NULL) || ((lru->cong.super.driver != NULL) &&
+                              ((int32_t)(peer->last_used - lru->last_used) < 0))) {
+            lru = peer;
+        }
+    }
+    if (!create) {
+        return NULL;
+    }
+
+    congure_cocoa_snd_setup(&lru->cong);
+    lru->cong.super.driver->init(&lru->cong.super, NULL);
+    memcpy(&lru->remote, remote, sizeof(sock_udp_ep_t));
+    lru->last_used = now;
+    return &lru->cong;
+}
+
+/* Sets up the CoCoA state of a new confirmable request, returns the timeout
+ * for the initial transmission [in usec].
+ *
+ * Caller must hold _coap_state.lock. */
+static uint32_t _cocoa_initial_timeout(gcoap_request_memo_t *memo)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    congure_cocoa_snd_t *cong = _cocoa_find(&memo->remote_ep, now, true);
+    uint32_t rto = congure_cocoa_snd_rto(cong, now);
+
+#if CONFIG_COAP_RANDOM_FACTOR_1000 > 1000
+    uint32_t end = rto * CONFIG_COAP_RANDOM_FACTOR_1000 / 1000;
+
+    /* very short RTOs leave no room for the random factor */
+    if (end > rto) {
+        rto = random_uint32_range(rto, end);
+    }
+#endif
+    memo->send_time = now;
+    memo->rto = rto;
+    return rto * US_PER_MS;
+}
+
+/* Backs off the timeout of a request, returns the timeout for the next
+ * transmission [in usec]. */
+static uint32_t _cocoa_backoff(gcoap_request_memo_t *memo)
+{
+#ifndef CONFIG_GCOAP_NO_RETRANS_BACKOFF
+    mutex_lock(&_coap_state.lock);
+    congure_cocoa_snd_t *cong = _cocoa_find(&memo->remote_ep,
+                                            ztimer_now(ZTIMER_MSEC), false);
+    memo->rto = (cong != NULL) ? congure_cocoa_snd_backoff(cong, memo->rto)
+                               : 2 * memo->rto;
+    mutex_unlock(&_coap_state.lock);
+#endif
+    return memo->rto * US_PER_MS;
+}
+
+/* Feeds the RTT of a confirmable request into the RTO estimation, if the
+ * request was not answered before */
+static void _cocoa_report_ack(const gcoap_request_memo_t *memo)
+{
+    if ((memo->send_limit == GCOAP_SEND_LIMIT_NON) ||
+        (memo->state != GCOAP_MEMO_RETRANSMIT)) {
+        return;
+    }
+
+    mutex_lock(&_coap_state.lock);
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    congure_cocoa_snd_t *cong = _cocoa_find(&memo->remote_ep, now, false);
+    if (cong != NULL) {
+        congure_snd_msg_t msg = {
+            .send_time = memo->send_time,
+            .resends = CONFIG_COAP_MAX_RETRANSMIT - memo->send_limit,
+        };
+        congure_snd_ack_t ack = { .recv_time = now };
+        cong->super.driver->report_msg_acked(&cong->super, &msg, &ack);
+    }
+    mutex_unlock(&_coap_state.lock);
+}
+#endif
+
 /*
  * Main request handler: generates response PDU in the provided buffer.
  *
@@ -1157,9 +1290,13 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             }
             if (memo->msg.data.pdu_buf) {
                 memo->send_limit  = CONFIG_COAP_MAX_RETRANSMIT;
+#if IS_USED(MODULE_GCOAP_COCOA)
+                timeout           = _cocoa_initial_timeout(memo);
+#else
                 timeout           = (uint32_t)CONFIG_COAP_ACK_TIMEOUT * US_PER_SEC;
 #if CONFIG_COAP_RANDOM_FACTOR_1000 > 1000
                 timeout = random_uint32_range(timeout, TIMEOUT_RANGE_END * US_PER_SEC);
+#endif
 #endif
                 memo->state = GCOAP_MEMO_RETRANSMIT;
             }
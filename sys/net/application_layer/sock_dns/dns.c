@@ -15,62 +15,322 @@
  * @}
  */
 
+#include <arpa/inet.h>
 #include <errno.h>
 #include <string.h>
 
+#include "cond.h"
+#include "irq.h"
+#include "mutex.h"
 #include "net/dns.h"
 #include "net/dns/msg.h"
 #include "net/sock/udp.h"
 #include "net/sock/dns.h"
+#include "timex.h"
+#include "ztimer.h"
 
-/* min domain name length is 1, so minimum record length is 7 */
-#define DNS_MIN_REPLY_LEN   (unsigned)(sizeof(dns_hdr_t ) + 7)
+#include "sock_dns_internal.h"
+
+/* QR bit in the flags of the DNS header */
+#define DNS_FLAGS_RESPONSE  (0x8000U)
+
+enum {
+    CACHE_ENTRY_FREE = 0,
+    CACHE_ENTRY_PENDING,
+    CACHE_ENTRY_DONE,
+};
+
+struct sock_dns_cache_entry {
+    uint32_t hash;          /* hash of the name */
+    uint32_t expires;       /* in seconds of ZTIMER_SEC */
+    int16_t res;            /* result of the query */
+    uint8_t family;         /* requested address family */
+    uint8_t state;          /* CACHE_ENTRY_% */
+    uint8_t gen;            /* incremented on every change of state */
+    uint8_t addr[16];       /* resolved address */
+    char name[SOCK_DNS_MAX_NAME_LEN + 1];   /* the hash is only a shortcut */
+};
 
 /* global DNS server UDP endpoint */
 sock_udp_ep_t sock_dns_server;
 
-int sock_dns_query(const char *domain_name, void *addr_out, int family)
+static uint16_t _id;
+
+#if IS_USED(MODULE_SOCK_DNS_CACHE)
+static sock_dns_cache_entry_t _cache[CONFIG_SOCK_DNS_CACHE_SIZE];
+static mutex_t _cache_lock = MUTEX_INIT;
+static cond_t _cache_cond = COND_INIT;
+#endif
+
+uint16_t sock_dns_next_id(void)
 {
-    static uint8_t dns_buf[CONFIG_DNS_MSG_LEN];
+    unsigned state = irq_disable();
+    uint16_t id = _id++;
 
-    if (sock_dns_server.port == 0) {
-        return -ECONNREFUSED;
+    irq_restore(state);
+    return id;
+}
+
+int sock_dns_parse_reply(const uint8_t *buf, size_t len, uint16_t id,
+                         int family, void *addr_out, uint32_t *ttl)
+{
+    const dns_hdr_t *hdr = (const dns_hdr_t *)buf;
+
+    if (len <= SOCK_DNS_MIN_REPLY_LEN) {
+        return -EBADMSG;
+    }
+    if ((hdr->id != htons(id)) || !(ntohs(hdr->flags) & DNS_FLAGS_RESPONSE)) {
+        return -EPROTO;
     }
+    return dns_msg_parse_reply_ttl(buf, len, family, addr_out, ttl);
+}
 
-    if (strlen(domain_name) > SOCK_DNS_MAX_NAME_LEN) {
-        return -ENOSPC;
+#if IS_USED(MODULE_SOCK_DNS_CACHE)
+static inline char _lower(char c)
+{
+    return ((c >= 'A') && (c <= 'Z')) ? c + ('a' - 'A') : c;
+}
+
+static uint32_t _hash(const char *name)
+{
+    /* FNV-1a, domain names are case-insensitive */
+    uint32_t hash = 0x811c9dc5;
+
+    for (; *name; name++) {
+        hash ^= (uint8_t)_lower(*name);
+        hash *= 0x01000193;
+    }
+    return hash;
+}
+
+static bool _name_equal(const char *a, const char *b)
+{
+    for (; _lower(*a) == _lower(*b); a++, b++) {
+        if (*a == '\0') {
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline bool _valid(const sock_dns_cache_entry_t *e, uint32_t now)
+{
+    return (e->state == CACHE_ENTRY_DONE) && ((int32_t)(e->expires - now) > 0);
+}
+
+static int _result(const sock_dns_cache_entry_t *e, void *addr_out)
+{
+    if (e->res > 0) {
+        memcpy(addr_out, e->addr, e->res);
+    }
+    return e->res;
+}
+
+static sock_dns_cache_entry_t *_find(const char *name, uint32_t hash,
+                                     int family)
+{
+    for (unsigned i = 0; i < CONFIG_SOCK_DNS_CACHE_SIZE; i++) {
+        sock_dns_cache_entry_t *e = &_cache[i];
+        if ((e->state != CACHE_ENTRY_FREE) && (e->hash == hash) &&
+            (e->family == family) && _name_equal(e->name, name)) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static sock_dns_cache_entry_t *_alloc(uint32_t now)
+{
+    sock_dns_cache_entry_t *res = NULL;
+
+    /* take a free entry or the one expiring first, but never one in flight */
+    for (unsigned i = 0; i < CONFIG_SOCK_DNS_CACHE_SIZE; i++) {
+        sock_dns_cache_entry_t *e = &_cache[i];
+        if (e->state == CACHE_ENTRY_FREE) {
+            return e;
+        }
+        if ((e->state == CACHE_ENTRY_DONE) &&
+            ((res == NULL) ||
+             ((int32_t)(e->expires - now) < (int32_t)(res->expires - now)))) {
+            res = e;
+        }
+    }
+    return res;
+}
+
+int sock_dns_cache_begin(const char *name, int family, void *addr_out,
+                         bool wait, sock_dns_cache_entry_t **entry)
+{
+    uint32_t hash = _hash(name);
+    int res = -EINPROGRESS;
+
+    *entry = NULL;
+    mutex_lock(&_cache_lock);
+    while (1) {
+        uint32_t now = ztimer_now(ZTIMER_SEC);
+        sock_dns_cache_entry_t *e = _find(name, hash, family);
+
+        if ((e != NULL) && _valid(e, now)) {
+            res = _result(e, addr_out);
+            break;
+        }
+        if ((e != NULL) && (e->state == CACHE_ENTRY_PENDING)) {
+            uint8_t gen = e->gen;
+
+            if (!wait) {
+                /* query on our own, without caching the result */
+                break;
+            }
+            while ((e->state == CACHE_ENTRY_PENDING) && (e->gen == gen)) {
+                cond_wait(&_cache_cond, &_cache_lock);
+            }
+            if ((e->gen == (uint8_t)(gen + 1)) && (e->res != -ECANCELED)) {
+                /* take the result of the query we waited for, even if it
+                 * must not be cached */
+                res = _result(e, addr_out);
+                break;
+            }
+            /* entry was reused or the query cancelled, look up again */
+            continue;
+        }
+        if (e == NULL) {
+            e = _alloc(now);
+        }
+        if (e != NULL) {
+            e->hash = hash;
+            strcpy(e->name, name);
+            e->family = family;
+            e->state = CACHE_ENTRY_PENDING;
+            e->gen++;
+        }
+        *entry = e;
+        break;
+    }
+    mutex_unlock(&_cache_lock);
+    return res;
+}
+
+void sock_dns_cache_finish(sock_dns_cache_entry_t *entry, int res,
+                           const void *addr, uint32_t ttl)
+{
+    if (entry == NULL) {
+        return;
+    }
+    if (res == -ENOENT) {
+        if (ttl > CONFIG_SOCK_DNS_CACHE_NEG_TTL_MAX) {
+            ttl = CONFIG_SOCK_DNS_CACHE_NEG_TTL_MAX;
+        }
+    }
+    else if (res < 0) {
+        /* errors are only handed to the queries waiting for this one */
+        ttl = 0;
+    }
+    else if (ttl > INT32_MAX) {
+        ttl = INT32_MAX;
+    }
+
+    mutex_lock(&_cache_lock);
+    entry->res = res;
+    if (res > 0) {
+        memcpy(entry->addr, addr, res);
+    }
+    entry->expires = ztimer_now(ZTIMER_SEC) + ttl;
+    entry->state = CACHE_ENTRY_DONE;
+    entry->gen++;
+    cond_broadcast(&_cache_cond);
+    mutex_unlock(&_cache_lock);
+}
+
+void sock_dns_cache_flush(void)
+{
+    mutex_lock(&_cache_lock);
+    for (unsigned i = 0; i < CONFIG_SOCK_DNS_CACHE_SIZE; i++) {
+        if (_cache[i].state == CACHE_ENTRY_DONE) {
+            _cache[i].state = CACHE_ENTRY_FREE;
+            _cache[i].gen++;
+        }
     }
+    mutex_unlock(&_cache_lock);
+}
+#else
+int sock_dns_cache_begin(const char *name, int family, void *addr_out,
+                         bool wait, sock_dns_cache_entry_t **entry)
+{
+    (void)name;
+    (void)family;
+    (void)addr_out;
+    (void)wait;
+    *entry = NULL;
+    return -EINPROGRESS;
+}
 
+void sock_dns_cache_finish(sock_dns_cache_entry_t *entry, int res,
+                           const void *addr, uint32_t ttl)
+{
+    (void)entry;
+    (void)res;
+    (void)addr;
+    (void)ttl;
+}
+#endif /* MODULE_SOCK_DNS_CACHE */
+
+static int _query(const char *domain_name, void *addr_out, int family,
+                  uint32_t *ttl)
+{
+    uint8_t dns_buf[CONFIG_DNS_MSG_LEN];
+    uint32_t timeout = CONFIG_SOCK_DNS_TIMEOUT_MS * US_PER_MS;
+    uint16_t id = sock_dns_next_id();
     sock_udp_t sock_dns;
 
     ssize_t res = sock_udp_create(&sock_dns, NULL, &sock_dns_server, 0);
     if (res) {
-        goto out;
+        return res;
     }
 
-    uint16_t id = 0;
-    for (int i = 0; i < SOCK_DNS_RETRIES; i++) {
+    for (int i = 0; i < SOCK_DNS_RETRIES; i++, timeout *= 2) {
         size_t buflen = dns_msg_compose_query(dns_buf, domain_name, id, family);
 
         res = sock_udp_send(&sock_dns, dns_buf, buflen, NULL);
         if (res <= 0) {
             continue;
         }
-        res = sock_udp_recv(&sock_dns, dns_buf, sizeof(dns_buf), 1000000LU, NULL);
-        if (res > 0) {
-            if (res > (int)DNS_MIN_REPLY_LEN) {
-                if ((res = dns_msg_parse_reply(dns_buf, res, family,
-                                               addr_out)) > 0) {
-                    goto out;
-                }
-            }
-            else {
-                res = -EBADMSG;
+        do {
+            res = sock_udp_recv(&sock_dns, dns_buf, sizeof(dns_buf), timeout,
+                                NULL);
+            if (res > 0) {
+                res = sock_dns_parse_reply(dns_buf, res, id, family, addr_out,
+                                           ttl);
             }
+            /* ignore stray replies to other queries */
+        } while (res == -EPROTO);
+        if ((res > 0) || (res == -ENOENT)) {
+            break;
         }
     }
 
-out:
     sock_udp_close(&sock_dns);
     return res;
 }
+
+int sock_dns_query(const char *domain_name, void *addr_out, int family)
+{
+    sock_dns_cache_entry_t *entry;
+    uint32_t ttl = 0;
+    int res;
+
+    if (sock_dns_server.port == 0) {
+        return -ECONNREFUSED;
+    }
+
+    if (strlen(domain_name) > SOCK_DNS_MAX_NAME_LEN) {
+        return -ENOSPC;
+    }
+
+    res = sock_dns_cache_begin(domain_name, family, addr_out, true, &entry);
+    if (res != -EINPROGRESS) {
+        return res;
+    }
+    res = _query(domain_name, addr_out, family, &ttl);
+    sock_dns_cache_finish(entry, res, addr_out, ttl);
+    return res;
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_sock_dns
+ * @{
+ * @file
+ * @brief   Asynchronous sock DNS client implementation
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/sock/dns.h"
+
+#if IS_USED(MODULE_SOCK_DNS_ASYNC)
+#include "net/sock/async/event.h"
+#include "ztimer.h"
+
+#include "sock_dns_internal.h"
+
+static void _stop(sock_dns_async_t *q)
+{
+    event_timeout_clear(&q->timeout);
+    sock_udp_close(&q->sock);
+    event_cancel(q->queue, &sock_udp_get_async_ctx(&q->sock)->event.super);
+    q->tries = 0;
+}
+
+static void _finish(sock_dns_async_t *q, int res, uint32_t ttl)
+{
+    _stop(q);
+    sock_dns_cache_finish(q->entry, res, q->addr, ttl);
+    q->entry = NULL;
+    q->res = res;
+    event_post(q->queue, &q->super);
+}
+
+static void _send(sock_dns_async_t *q)
+{
+    uint8_t buf[CONFIG_DNS_MSG_LEN];
+    size_t len = dns_msg_compose_query(buf, q->name, q->id, q->family);
+
+    /* a failed send is handled like a lost query */
+    sock_udp_send(&q->sock, buf, len, NULL);
+    event_timeout_set(&q->timeout, CONFIG_SOCK_DNS_TIMEOUT_MS << q->tries);
+    q->tries++;
+}
+
+static void _on_timeout(event_t *ev)
+{
+    sock_dns_async_t *q = container_of(ev, sock_dns_async_t, timeout_event);
+
+    if (q->tries < SOCK_DNS_RETRIES) {
+        _send(q);
+    }
+    else {
+        _finish(q, -ETIMEDOUT, 0);
+    }
+}
+
+static void _on_sock(sock_udp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    sock_dns_async_t *q = arg;
+    uint8_t buf[CONFIG_DNS_MSG_LEN];
+    ssize_t res;
+
+    if (!(flags & SOCK_ASYNC_MSG_RECV)) {
+        return;
+    }
+    while ((res = sock_udp_recv(sock, buf, sizeof(buf), 0, NULL)) >= 0) {
+        uint32_t ttl = 0;
+
+        if (res > 0) {
+            res = sock_dns_parse_reply(buf, res, q->id, q->family, q->addr,
+                                       &ttl);
+        }
+        if ((res > 0) || (res == -ENOENT)) {
+            _finish(q, res, ttl);
+            return;
+        }
+        /* ignore stray or malformed replies and wait for the timeout */
+    }
+}
+
+int sock_dns_query_async(sock_dns_async_t *query, event_queue_t *queue,
+                         event_handler_t handler, const char *domain_name,
+                         int family)
+{
+    size_t len = strlen(domain_name);
+    int res;
+
+    assert((query != NULL) && (queue != NULL) && (handler != NULL));
+    if (sock_dns_server.port == 0) {
+        return -ECONNREFUSED;
+    }
+    if (len > SOCK_DNS_MAX_NAME_LEN) {
+        return -ENOSPC;
+    }
+
+    memset(query, 0, sizeof(*query));
+    query->super.handler = handler;
+    query->queue = queue;
+    query->family = family;
+    memcpy(query->name, domain_name, len + 1);
+
+    /* don't block the queue on a synchronous query in flight */
+    res = sock_dns_cache_begin(domain_name, family, query->addr, false,
+                               &query->entry);
+    if (res != -EINPROGRESS) {
+        query->res = res;
+        event_post(queue, &query->super);
+        return 0;
+    }
+
+    res = sock_udp_create(&query->sock, NULL, &sock_dns_server, 0);
+    if (res < 0) {
+        sock_dns_cache_finish(query->entry, res, NULL, 0);
+        return res;
+    }
+    sock_udp_event_init(&query->sock, queue, _on_sock, query);
+    query->timeout_event.handler = _on_timeout;
+    event_timeout_ztimer_init(&query->timeout, ZTIMER_MSEC, queue,
+                              &query->timeout_event);
+    query->id = sock_dns_next_id();
+    _send(query);
+    return 0;
+}
+
+void sock_dns_query_async_cancel(sock_dns_async_t *query)
+{
+    if (query->queue == NULL) {
+        /* never started */
+        return;
+    }
+    if (query->tries > 0) {
+        /* exchange still running */
+        _stop(query);
+        event_cancel(query->queue, &query->timeout_event);
+        sock_dns_cache_finish(query->entry, -ECANCELED, NULL, 0);
+        query->entry = NULL;
+    }
+    event_cancel(query->queue, &query->super);
+}
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_SOCK_DNS_ASYNC */
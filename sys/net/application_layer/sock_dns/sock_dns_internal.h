@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_sock_dns
+ * @{
+ *
+ * @file
+ * @brief       Internal functions shared by the sock DNS client modules
+ * @internal
+ */
+#ifndef SOCK_DNS_INTERNAL_H
+#define SOCK_DNS_INTERNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "net/sock/dns.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Minimum length of a reply: min domain name length is 1, so minimum
+ *          record length is 7
+ */
+#define SOCK_DNS_MIN_REPLY_LEN  (unsigned)(sizeof(dns_hdr_t) + 7)
+
+/**
+ * @brief   Entry of the DNS cache
+ */
+typedef struct sock_dns_cache_entry sock_dns_cache_entry_t;
+
+/**
+ * @brief   Get an ID for a new query
+ */
+uint16_t sock_dns_next_id(void);
+
+/**
+ * @brief   Check whether @p buf is the reply to the query with @p id and
+ *          parse it
+ *
+ * @return  see @ref dns_msg_parse_reply_ttl()
+ * @return  -EPROTO, if @p buf is no reply to the query
+ */
+int sock_dns_parse_reply(const uint8_t *buf, size_t len, uint16_t id,
+                         int family, void *addr_out, uint32_t *ttl);
+
+/**
+ * @brief   Look up a name in the cache and reserve an entry for the query if
+ *          it is not there
+ *
+ * @param[in]  name     the name to look up, at most @ref SOCK_DNS_MAX_NAME_LEN
+ *                      characters long
+ * @param[in]  family   the requested address family
+ * @param[out] addr_out the address, if it was cached
+ * @param[in]  wait     wait for a query for the same name in flight
+ * @param[out] entry    the entry reserved for the query or NULL if there is
+ *                      none available
+ *
+ * @return  the cached result, see @ref sock_dns_query()
+ * @return  -EINPROGRESS, if the caller has to query the server and call
+ *          @ref sock_dns_cache_finish() with @p entry afterwards
+ */
+int sock_dns_cache_begin(const char *name, int family, void *addr_out,
+                         bool wait, sock_dns_cache_entry_t **entry);
+
+/**
+ * @brief   Store the result of a query in the entry reserved for it and
+ *          wake up everyone waiting for it
+ *
+ * @param[in] entry     the entry returned by @ref sock_dns_cache_begin(),
+ *                      may be NULL
+ * @param[in] res       the result of the query, see @ref sock_dns_query()
+ * @param[in] addr      the resolved address, if @p res > 0
+ * @param[in] ttl       time to live of the result in seconds
+ */
+void sock_dns_cache_finish(sock_dns_cache_entry_t *entry, int res,
+                           const void *addr, uint32_t ttl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOCK_DNS_INTERNAL_H */
+/** @} */
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_netif_fastfwd
+ * @{
+ *
+ * @file
+ * @brief   IPv6 forwarding fast path implementation
+ * @}
+ */
+
+#include <string.h>
+
+#include "atomic_utils.h"
+#include "mutex.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/trace.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "ztimer.h"
+
+#include "net/gnrc/netif/fastfwd.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+typedef struct {
+    ipv6_addr_t dst;
+    uint32_t expires;       /* in ms of ZTIMER_MSEC */
+    kernel_pid_t iface;     /* KERNEL_PID_UNDEF marks a free entry */
+    uint8_t l2addr_len;
+    uint8_t l2addr[CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN];
+} _route_t;
+
+static _route_t _cache[CONFIG_GNRC_NETIF_FASTFWD_CACHE_SIZE];
+static mutex_t _cache_lock = MUTEX_INIT;
+/* counts flushes, so a route looked up in the NIB during a flush is not
+ * cached afterwards; protected by _cache_lock */
+static unsigned _flushes;
+/* updated by the threads of all interfaces, so only atomically */
+static gnrc_netif_fastfwd_stats_t _stats;
+
+static bool _is_ext(uint8_t nh)
+{
+    switch (nh) {
+        case PROTNUM_IPV6_EXT_HOPOPT:
+        case PROTNUM_IPV6_EXT_RH:
+        case PROTNUM_IPV6_EXT_FRAG:
+        case PROTNUM_IPV6_EXT_ESP:
+        case PROTNUM_IPV6_EXT_AH:
+        case PROTNUM_IPV6_EXT_DST:
+        case PROTNUM_IPV6_EXT_MOB:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool _is_special(const ipv6_addr_t *addr)
+{
+    return ipv6_addr_is_link_local(addr) || ipv6_addr_is_multicast(addr) ||
+           ipv6_addr_is_loopback(addr) || ipv6_addr_is_unspecified(addr);
+}
+
+static bool _fast_path_applies(const gnrc_pktsnip_t *pkt)
+{
+    const gnrc_pktsnip_t *netif_snip = pkt->next;
+    const ipv6_hdr_t *hdr = pkt->data;
+
+    /* only an unparsed IPv6 packet with just the interface header */
+    if ((pkt->type != GNRC_NETTYPE_IPV6) || (netif_snip == NULL) ||
+        (netif_snip->type != GNRC_NETTYPE_NETIF) ||
+        (netif_snip->next != NULL) || (pkt->size < sizeof(ipv6_hdr_t)) ||
+        !ipv6_hdr_is(hdr)) {
+        return false;
+    }
+    /* let the full path trim or drop malformed packets and send the time
+     * exceeded error */
+    return (byteorder_ntohs(hdr->len) + sizeof(ipv6_hdr_t) == pkt->size) &&
+           (hdr->hl > 1) && !_is_ext(hdr->nh) &&
+           !_is_special(&hdr->src) && !_is_special(&hdr->dst);
+}
+
+static _route_t *_cache_find(const ipv6_addr_t *dst, uint32_t now)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_FASTFWD_CACHE_SIZE; i++) {
+        _route_t *route = &_cache[i];
+
+        if ((route->iface != KERNEL_PID_UNDEF) &&
+            ((int32_t)(route->expires - now) > 0) &&
+            ipv6_addr_equal(&route->dst, dst)) {
+            return route;
+        }
+    }
+    return NULL;
+}
+
+static void _cache_add(const _route_t *new)
+{
+    _route_t *route = &_cache[0];
+
+    /* replace the entry expiring first, free entries are expired anyway */
+    for (unsigned i = 1; i < CONFIG_GNRC_NETIF_FASTFWD_CACHE_SIZE; i++) {
+        if ((route->iface != KERNEL_PID_UNDEF) &&
+            ((_cache[i].iface == KERNEL_PID_UNDEF) ||
+             ((int32_t)(_cache[i].expires - route->expires) < 0))) {
+            route = &_cache[i];
+        }
+    }
+    *route = *new;
+}
+
+static int _get_route(const ipv6_addr_t *dst, _route_t *res)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    unsigned flushes;
+
+    mutex_lock(&_cache_lock);
+    _route_t *route = _cache_find(dst, now);
+    if (route != NULL) {
+        *res = *route;
+        mutex_unlock(&_cache_lock);
+        return 0;
+    }
+    flushes = _flushes;
+    mutex_unlock(&_cache_lock);
+
+    atomic_fetch_add_u32(&_stats.cache_misses, 1);
+    /* don't cache what the NIB can't answer without the packet, e.g.
+     * neighbors that still need to be resolved */
+    if ((gnrc_netif_get_by_ipv6_addr(dst) != NULL) ||
+        (gnrc_ipv6_nib_get_next_hop_l2addr(dst, NULL, NULL, &nce) < 0) ||
+        (nce.l2addr_len > sizeof(res->l2addr))) {
+        return -1;
+    }
+    memcpy(&res->dst, dst, sizeof(res->dst));
+    res->expires = now + CONFIG_GNRC_NETIF_FASTFWD_CACHE_LIFETIME_MS;
+    res->iface = gnrc_ipv6_nib_nc_get_iface(&nce);
+    res->l2addr_len = nce.l2addr_len;
+    memcpy(res->l2addr, nce.l2addr, nce.l2addr_len);
+
+    mutex_lock(&_cache_lock);
+    if (flushes == _flushes) {
+        _cache_add(res);
+    }
+    mutex_unlock(&_cache_lock);
+    return 0;
+}
+
+bool gnrc_netif_fastfwd(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif_snip;
+    gnrc_netif_t *out;
+    ipv6_hdr_t *hdr;
+    _route_t route;
+
+    (void)netif;
+    if (!_fast_path_applies(pkt) ||
+        (_get_route(&((ipv6_hdr_t *)pkt->data)->dst, &route) < 0) ||
+        ((out = gnrc_netif_get_by_pid(route.iface)) == NULL) ||
+        /* 6LoWPAN interfaces need header compression and fragmentation by
+         * the 6LoWPAN thread, see _send_to_iface() of gnrc_ipv6 */
+        gnrc_netif_is_6lo(out) || (pkt->size > out->ipv6.mtu)) {
+        atomic_fetch_add_u32(&_stats.slow, 1);
+        return false;
+    }
+    netif_snip = gnrc_netif_hdr_build(NULL, 0, route.l2addr,
+                                      route.l2addr_len);
+    if (netif_snip == NULL) {
+        atomic_fetch_add_u32(&_stats.slow, 1);
+        return false;
+    }
+    gnrc_trace(GNRC_TRACE_LAYER_NETIF, GNRC_TRACE_EVENT_FWD, pkt);
+    /* the header is changed below */
+    if ((pkt = gnrc_pktbuf_start_write(pkt)) == NULL) {
+        DEBUG("gnrc_netif_fastfwd: unable to get write access, dropping\n");
+        gnrc_pktbuf_release(netif_snip);
+        return true;
+    }
+    hdr = pkt->data;
+    hdr->hl--;
+    /* swap the interface header of the receiving for the one of the sending
+     * interface and turn the packet into send order */
+    gnrc_pktbuf_remove_snip(pkt, pkt->next);
+    gnrc_netif_hdr_set_netif(netif_snip->data, out);
+    netif_snip->next = pkt;
+#ifdef MODULE_NETSTATS_IPV6
+    out->ipv6.stats.tx_unicast_count++;
+    out->ipv6.stats.tx_success++;
+    out->ipv6.stats.tx_bytes += pkt->size;
+#endif
+    atomic_fetch_add_u32(&_stats.forwarded, 1);
+    DEBUG("gnrc_netif_fastfwd: forward %p over interface %" PRIkernel_pid
+          "\n", (void *)netif_snip, out->pid);
+    if (gnrc_netif_send(out, netif_snip) < 1) {
+        DEBUG("gnrc_netif_fastfwd: unable to send packet\n");
+        gnrc_pktbuf_release(netif_snip);
+    }
+    return true;
+}
+
+void gnrc_netif_fastfwd_flush(void)
+{
+    mutex_lock(&_cache_lock);
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_FASTFWD_CACHE_SIZE; i++) {
+        _cache[i].iface = KERNEL_PID_UNDEF;
+    }
+    _flushes++;
+    mutex_unlock(&_cache_lock);
+}
+
+void gnrc_netif_fastfwd_stats_get(gnrc_netif_fastfwd_stats_t *stats)
+{
+    stats->forwarded = atomic_load_u32(&_stats.forwarded);
+    stats->slow = atomic_load_u32(&_stats.slow);
+    stats->cache_misses = atomic_load_u32(&_stats.cache_misses);
+}
@@ -32,7 +32,11 @@
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
 #include "net/gnrc/netif/pktq.h"
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+#include "net/gnrc/netif/fastfwd.h"
+#endif /* IS_USED(MODULE_GNRC_NETIF_FASTFWD) */
 #include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/trace.h"
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
 #include "net/gnrc/sixlowpan/frag/sfr.h"
 #endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
@@ -614,6 +618,10 @@ int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
 #endif /* CONFIG_GNRC_IPV6_NIB_ARSM */
     netif->ipv6.addrs_flags[idx] = flags;
     memcpy(&netif->ipv6.addrs[idx], addr, sizeof(netif->ipv6.addrs[idx]));
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+    /* the address might have been a forwarding destination */
+    gnrc_netif_fastfwd_flush();
+#endif /* IS_USED(MODULE_GNRC_NETIF_FASTFWD) */
 #ifdef MODULE_GNRC_IPV6_NIB
     if (_get_state(netif, idx) == GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) {
         void *state = NULL;
@@ -1759,6 +1767,7 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
     /* Split off the TX sync snip */
     gnrc_pktsnip_t *tx_sync = IS_USED(MODULE_GNRC_TX_SYNC)
                             ? gnrc_tx_sync_split(pkt) : NULL;
+    gnrc_trace(GNRC_TRACE_LAYER_NETIF, GNRC_TRACE_EVENT_OUT, pkt);
     res = netif->ops->send(netif, pkt);
     if (tx_sync != NULL) {
         uint32_t err = (res < 0) ? -res : GNRC_NETERR_SUCCESS;
@@ -1886,6 +1895,8 @@ static void *_gnrc_netif_thread(void *args)
                 break;
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
+                gnrc_trace(GNRC_TRACE_LAYER_NETIF, GNRC_TRACE_EVENT_TX,
+                           msg.content.ptr);
                 _send(netif, msg.content.ptr, false);
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
                 xtimer_periodic_wakeup(
@@ -1984,6 +1995,13 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 _send_queued_pkt(netif);
                 if (pkt) {
                     _process_receive_stats(netif, pkt);
+                    gnrc_trace(GNRC_TRACE_LAYER_NETIF, GNRC_TRACE_EVENT_RX,
+                               pkt);
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+                    if (gnrc_netif_fastfwd(netif, pkt)) {
+                        break;
+                    }
+#endif /* IS_USED(MODULE_GNRC_NETIF_FASTFWD) */
                     _pass_on_packet(pkt);
                 }
                 break;
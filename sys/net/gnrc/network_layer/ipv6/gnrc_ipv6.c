@@ -24,6 +24,7 @@
 #include "net/gnrc/icmpv6.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "net/gnrc/sixlowpan/nd.h"
+#include "net/gnrc/trace.h"
 #include "net/protnum.h"
 #include "thread.h"
 #include "utlist.h"
@@ -197,11 +198,15 @@ static void *_event_loop(void *args)
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
+                gnrc_trace(GNRC_TRACE_LAYER_IPV6, GNRC_TRACE_EVENT_RX,
+                           msg.content.ptr);
                 _receive(msg.content.ptr);
                 break;
 
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
+                gnrc_trace(GNRC_TRACE_LAYER_IPV6, GNRC_TRACE_EVENT_TX,
+                           msg.content.ptr);
                 _send(msg.content.ptr, true);
                 break;
 
@@ -275,6 +280,7 @@ static void _send_to_iface(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     netif->ipv6.stats.tx_bytes += gnrc_pkt_len(pkt->next);
 #endif
 
+    gnrc_trace(GNRC_TRACE_LAYER_IPV6, GNRC_TRACE_EVENT_OUT, pkt);
 #ifdef MODULE_GNRC_SIXLOWPAN
     if (gnrc_netif_is_6lo(netif)) {
         DEBUG("ipv6: send to 6LoWPAN instead\n");
@@ -862,6 +868,9 @@ static void _receive(gnrc_pktsnip_t *pkt)
         /* TODO: check if receiving interface is router */
         else if (--(hdr->hl) > 0) {  /* drop packets that *reach* Hop Limit 0 */
             DEBUG("ipv6: forward packet to next hop\n");
+            /* recorded for the received packet, reversing the snips below
+             * changes its identity */
+            gnrc_trace(GNRC_TRACE_LAYER_IPV6, GNRC_TRACE_EVENT_FWD, pkt);
 
             /* remove L2 headers around IPV6 */
             if (netif_hdr != NULL) {
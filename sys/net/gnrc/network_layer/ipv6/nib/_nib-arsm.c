@@ -20,6 +20,9 @@
 #include "net/gnrc/ndp.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/netif/internal.h"
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+#include "net/gnrc/netif/fastfwd.h"
+#endif /* IS_USED(MODULE_GNRC_NETIF_FASTFWD) */
 #ifdef MODULE_GNRC_SIXLOWPAN_ND
 #include "net/gnrc/sixlowpan/nd.h"
 #endif  /* MODULE_GNRC_SIXLOWPAN_ND */
@@ -155,6 +158,13 @@ void _handle_sl2ao(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
         /* a 6LR MUST NOT modify an existing NCE based on an SL2AO in an RS
          * see https://tools.ietf.org/html/rfc6775#section-6.3 */
         if (!_rtr_sol_on_6lr(netif, icmpv6)) {
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+            /* the fast path may have cached the old link-layer address */
+            if ((nce->l2addr_len != l2addr_len) ||
+                (memcmp(nce->l2addr, sl2ao + 1, l2addr_len) != 0)) {
+                gnrc_netif_fastfwd_flush();
+            }
+#endif /* IS_USED(MODULE_GNRC_NETIF_FASTFWD) */
             nce->l2addr_len = l2addr_len;
             memcpy(nce->l2addr, sl2ao + 1, l2addr_len);
         }
@@ -364,6 +374,10 @@ void _handle_adv_l2(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
         else {
             nce->l2addr_len = 0;
         }
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+        /* the fast path may have cached the old link-layer address */
+        gnrc_netif_fastfwd_flush();
+#endif /* IS_USED(MODULE_GNRC_NETIF_FASTFWD) */
         if (_sflag_set((ndp_nbr_adv_t *)icmpv6)) {
             _set_reachable(netif, nce);
         }
@@ -443,6 +457,12 @@ void _set_nud_state(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
 {
     nce->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
     nce->info |= state;
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+    if (state == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNREACHABLE) {
+        /* the fast path must stop forwarding to the neighbor */
+        gnrc_netif_fastfwd_flush();
+    }
+#endif /* IS_USED(MODULE_GNRC_NETIF_FASTFWD) */
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
     gnrc_netif_acquire(netif);
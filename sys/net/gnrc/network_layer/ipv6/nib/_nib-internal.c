@@ -25,6 +25,9 @@
 #include "net/gnrc/ipv6/nib/nc.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/netif/internal.h"
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+#include "net/gnrc/netif/fastfwd.h"
+#endif /* IS_USED(MODULE_GNRC_NETIF_FASTFWD) */
 #include "random.h"
 
 #include "_nib-internal.h"
@@ -290,6 +293,10 @@ void _nib_nc_remove(_nib_onl_entry_t *node)
     /* remove from cache-out procedure */
     clist_remove(&_next_removable, (clist_node_t *)node);
     _nib_onl_clear(node);
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+    /* the fast path may still forward to the neighbor */
+    gnrc_netif_fastfwd_flush();
+#endif /* IS_USED(MODULE_GNRC_NETIF_FASTFWD) */
 }
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_6LN) || !IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
@@ -379,6 +386,10 @@ void _nib_drl_remove(_nib_dr_entry_t *nib_dr)
         nib_dr->next_hop->mode &= ~(_DRL);
         _nib_onl_clear(nib_dr->next_hop);
         memset(nib_dr, 0, sizeof(_nib_dr_entry_t));
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+        /* the fast path may still forward via the router */
+        gnrc_netif_fastfwd_flush();
+#endif /* IS_USED(MODULE_GNRC_NETIF_FASTFWD) */
     }
     if (nib_dr == _prime_def_router) {
         _prime_def_router = NULL;
@@ -551,6 +562,10 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             _nib_onl_clear(dst->next_hop);
         }
         memset(dst, 0, sizeof(_nib_offl_entry_t));
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+        /* the fast path may still forward along the route */
+        gnrc_netif_fastfwd_flush();
+#endif /* IS_USED(MODULE_GNRC_NETIF_FASTFWD) */
     }
 }
 
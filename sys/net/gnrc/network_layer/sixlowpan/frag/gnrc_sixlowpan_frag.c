@@ -26,6 +26,7 @@
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
 #include "net/gnrc/sixlowpan/internal.h"
+#include "net/gnrc/trace.h"
 #include "net/gnrc/tx_sync.h"
 #include "net/sixlowpan.h"
 #include "utlist.h"
@@ -131,6 +132,16 @@ static uint16_t _copy_pkt_to_frag(uint8_t *data, const gnrc_pktsnip_t *pkt,
     return offset;
 }
 
+static inline void _trace_frag(gnrc_sixlowpan_frag_fb_t *fbuf,
+                               gnrc_pktsnip_t *frag)
+{
+    /* recorded for the datagram, so it can be followed to its fragments */
+    if (IS_USED(MODULE_GNRC_TRACE)) {
+        gnrc_trace_add(GNRC_TRACE_LAYER_SIXLOWPAN, GNRC_TRACE_EVENT_FRAG,
+                       fbuf->pkt, gnrc_pkt_len(frag));
+    }
+}
+
 static uint16_t _send_1st_fragment(gnrc_netif_t *iface,
                                    gnrc_sixlowpan_frag_fb_t *fbuf,
                                    size_t payload_len)
@@ -171,6 +182,7 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *iface,
     DEBUG("6lo frag: send first fragment (datagram size: %u, "
           "datagram tag: %" PRIu16 ", fragment size: %" PRIu16 ")\n",
           fbuf->datagram_size, fbuf->tag, local_offset);
+    _trace_frag(fbuf, frag);
     gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
     return local_offset;
 }
@@ -237,6 +249,7 @@ static uint16_t _send_nth_fragment(gnrc_netif_t *iface,
           "fragment size: %" PRIu16 ")\n",
           fbuf->datagram_size, fbuf->tag, hdr->offset,
           hdr->offset << 3, local_offset);
+    _trace_frag(fbuf, frag);
     gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
     return local_offset;
 }
@@ -28,6 +28,7 @@
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_STATS */
 #include "net/gnrc/sixlowpan/frag/minfwd.h"
 #include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "net/gnrc/trace.h"
 #include "net/sixlowpan.h"
 #include "net/sixlowpan/sfr.h"
 #include "thread.h"
@@ -836,6 +837,8 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
         gnrc_sixlowpan_frag_stats_get()->fragments += _count_frags(rbuf);
         gnrc_sixlowpan_frag_stats_get()->datagrams++;
 #endif
+        gnrc_trace(GNRC_TRACE_LAYER_SIXLOWPAN, GNRC_TRACE_EVENT_REASS,
+                   rbuf->pkt);
         gnrc_sixlowpan_dispatch_recv(rbuf->pkt, NULL, 0);
         _tmp_rm(rbuf);
     }
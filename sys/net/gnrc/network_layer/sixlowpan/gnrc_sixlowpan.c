@@ -28,6 +28,7 @@
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/gnrc/netif.h"
+#include "net/gnrc/trace.h"
 #include "net/sixlowpan.h"
 
 #define ENABLE_DEBUG 0
@@ -95,6 +96,7 @@ void gnrc_sixlowpan_dispatch_send(gnrc_pktsnip_t *pkt, void *context,
     (void)page;
     assert(pkt->type == GNRC_NETTYPE_NETIF);
     gnrc_netif_hdr_t *hdr = pkt->data;
+    gnrc_trace(GNRC_TRACE_LAYER_SIXLOWPAN, GNRC_TRACE_EVENT_OUT, pkt);
     if (gnrc_netif_send(gnrc_netif_get_by_pid(hdr->if_pid), pkt) < 1) {
         DEBUG("6lo: unable to send %p over interface %u\n", (void *)pkt,
               hdr->if_pid);
@@ -410,11 +412,15 @@ static void *_event_loop(void *args)
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
                 DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_RCV received\n");
+                gnrc_trace(GNRC_TRACE_LAYER_SIXLOWPAN, GNRC_TRACE_EVENT_RX,
+                           msg.content.ptr);
                 _receive(msg.content.ptr);
                 break;
 
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
+                gnrc_trace(GNRC_TRACE_LAYER_SIXLOWPAN, GNRC_TRACE_EVENT_TX,
+                           msg.content.ptr);
                 _send(msg.content.ptr);
                 break;
 
@@ -23,10 +23,16 @@
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/hdr.h"
 #include "net/gnrc/netreg.h"
+#include "net/gnrc/trace.h"
 #include "net/gnrc/tx_sync.h"
 #include "net/udp.h"
 #include "utlist.h"
 #include "xtimer.h"
+#if IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+#include "irq.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+#endif
 
 #include "sock_types.h"
 #include "gnrc_sock_internal.h"
@@ -36,7 +42,134 @@ extern gnrc_pktsnip_t *gnrc_pktbuf_fuzzptr;
 gnrc_pktsnip_t *gnrc_sock_prevpkt = NULL;
 #endif
 
-#ifdef MODULE_XTIMER
+#if IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+/* payload of the snip prepended to a queued packet */
+typedef struct {
+    gnrc_pktsnip_t *next;   /* next entry of the queue */
+    uint16_t len;           /* length of the queued packet */
+} _pktqueue_entry_t;
+
+static void _pktqueue_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    gnrc_sock_reg_t *reg = ctx;
+    gnrc_sock_pktqueue_t *q = &reg->pktqueue;
+    gnrc_pktsnip_t *entry;
+    _pktqueue_entry_t *data;
+    thread_t *waiter;
+    size_t len;
+    unsigned state;
+
+    if (cmd != GNRC_NETAPI_MSG_TYPE_RCV) {
+        return;
+    }
+    len = gnrc_pkt_len(pkt);
+    state = irq_disable();
+    /* an empty queue always takes the packet, so no packet is too large to
+     * be received at all */
+    if ((q->head != NULL) && ((q->bytes + len) > q->limit)) {
+        q->stats.dropped_full++;
+        irq_restore(state);
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    irq_restore(state);
+    /* the entry takes over the reference to pkt */
+    entry = gnrc_pktbuf_add(pkt, NULL, sizeof(_pktqueue_entry_t),
+                            GNRC_NETTYPE_UNDEF);
+    if (entry == NULL) {
+        state = irq_disable();
+        q->stats.dropped_nomem++;
+        irq_restore(state);
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    data = entry->data;
+    data->next = NULL;
+    data->len = len;
+    state = irq_disable();
+    if (q->tail == NULL) {
+        q->head = entry;
+    }
+    else {
+        ((_pktqueue_entry_t *)q->tail->data)->next = entry;
+    }
+    q->tail = entry;
+    q->bytes += len;
+    q->stats.received++;
+    waiter = q->waiter;
+    irq_restore(state);
+    if (waiter != NULL) {
+        thread_flags_set(waiter, GNRC_SOCK_PKTQUEUE_THREAD_FLAG);
+    }
+#ifdef SOCK_HAS_ASYNC
+    if (reg->async_cb.generic) {
+        reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
+    }
+#endif
+}
+
+/* must be called with interrupts disabled */
+static gnrc_pktsnip_t *_pktqueue_pop(gnrc_sock_pktqueue_t *q)
+{
+    gnrc_pktsnip_t *entry = q->head;
+
+    if (entry != NULL) {
+        _pktqueue_entry_t *data = entry->data;
+
+        q->head = data->next;
+        if (q->head == NULL) {
+            q->tail = NULL;
+        }
+        q->bytes -= data->len;
+    }
+    return entry;
+}
+
+static int _pktqueue_get(gnrc_sock_pktqueue_t *q, gnrc_pktsnip_t **pkt,
+                         uint32_t timeout)
+{
+    gnrc_pktsnip_t *entry;
+    ztimer_t timer;
+    bool timer_set = false;
+    bool timed_out = false;
+    unsigned state = irq_disable();
+
+    while ((entry = _pktqueue_pop(q)) == NULL) {
+        if ((timeout == 0) || timed_out) {
+            break;
+        }
+        q->waiter = thread_get_active();
+        thread_flags_clear(GNRC_SOCK_PKTQUEUE_THREAD_FLAG);
+        irq_restore(state);
+        /* only arm a timer if there is actually something to wait for */
+        if ((timeout != SOCK_NO_TIMEOUT) && !timer_set) {
+            thread_flags_clear(THREAD_FLAG_TIMEOUT);
+            ztimer_set_timeout_flag(ZTIMER_USEC, &timer, timeout);
+            timer_set = true;
+        }
+        /* wakeups that find the queue empty just wait again */
+        timed_out = thread_flags_wait_any(GNRC_SOCK_PKTQUEUE_THREAD_FLAG |
+                                          (timer_set ? THREAD_FLAG_TIMEOUT
+                                                     : 0)) &
+                    THREAD_FLAG_TIMEOUT;
+        state = irq_disable();
+    }
+    q->waiter = NULL;
+    irq_restore(state);
+    if (timer_set) {
+        ztimer_remove(ZTIMER_USEC, &timer);
+        /* the timer may have fired after a packet woke us up */
+        thread_flags_clear(THREAD_FLAG_TIMEOUT);
+    }
+    if (entry == NULL) {
+        return (timed_out) ? -ETIMEDOUT : -EAGAIN;
+    }
+    *pkt = entry->next;
+    entry->next = NULL;
+    gnrc_pktbuf_release(entry);
+    return 0;
+}
+#elif defined(MODULE_XTIMER)
 #define _TIMEOUT_MAGIC      (0xF38A0B63U)
 #define _TIMEOUT_MSG_TYPE   (0x8474)
 
@@ -53,7 +186,7 @@ static void _callback_put(void *arg)
 }
 #endif
 
-#ifdef SOCK_HAS_ASYNC
+#if defined(SOCK_HAS_ASYNC) && !IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
 static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
 {
     if (cmd == GNRC_NETAPI_MSG_TYPE_RCV) {
@@ -77,18 +210,53 @@ static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
 
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx)
 {
-    mbox_init(&reg->mbox, reg->mbox_queue, GNRC_SOCK_MBOX_SIZE);
 #ifdef SOCK_HAS_ASYNC
     reg->async_cb.generic = NULL;
+#endif
+#if IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+    memset(&reg->pktqueue, 0, sizeof(reg->pktqueue));
+    reg->pktqueue.limit = CONFIG_GNRC_SOCK_PKTQUEUE_LIMIT;
+    reg->netreg_cb.cb = _pktqueue_cb;
+    reg->netreg_cb.ctx = reg;
+    gnrc_netreg_entry_init_cb(&reg->entry, demux_ctx, &reg->netreg_cb);
+#else
+    mbox_init(&reg->mbox, reg->mbox_queue, GNRC_SOCK_MBOX_SIZE);
+#ifdef SOCK_HAS_ASYNC
     reg->netreg_cb.cb = _netapi_cb;
     reg->netreg_cb.ctx = reg;
     gnrc_netreg_entry_init_cb(&reg->entry, demux_ctx, &reg->netreg_cb);
 #else   /* SOCK_HAS_ASYNC */
     gnrc_netreg_entry_init_mbox(&reg->entry, demux_ctx, &reg->mbox);
 #endif  /* SOCK_HAS_ASYNC */
+#endif  /* MODULE_GNRC_SOCK_PKTQUEUE */
     gnrc_netreg_register(type, &reg->entry);
 }
 
+void gnrc_sock_close(gnrc_sock_reg_t *reg, gnrc_nettype_t type)
+{
+    gnrc_netreg_unregister(type, &reg->entry);
+    /* release what was received but never read */
+#if IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+    gnrc_pktsnip_t *entry;
+    unsigned state = irq_disable();
+
+    while ((entry = _pktqueue_pop(&reg->pktqueue)) != NULL) {
+        irq_restore(state);
+        gnrc_pktbuf_release(entry);
+        state = irq_disable();
+    }
+    irq_restore(state);
+#else
+    msg_t msg;
+
+    while (mbox_try_get(&reg->mbox, &msg)) {
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+#endif
+}
+
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
                        uint32_t timeout, sock_ip_ep_t *remote,
                        gnrc_sock_recv_aux_t *aux)
@@ -96,7 +264,6 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     /* only used when some sock_aux_% module is used */
     (void)aux;
     gnrc_pktsnip_t *pkt, *netif;
-    msg_t msg;
 
     /* The fuzzing module is only enabled when building a fuzzing
      * application from the fuzzing/ subdirectory. When using gnrc_sock
@@ -111,6 +278,15 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     }
 #endif
 
+#if IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+    int res = _pktqueue_get(&reg->pktqueue, &pkt, timeout);
+
+    if (res < 0) {
+        return res;
+    }
+#else   /* MODULE_GNRC_SOCK_PKTQUEUE */
+    msg_t msg;
+
     if (mbox_size(&reg->mbox) != GNRC_SOCK_MBOX_SIZE) {
         return -EINVAL;
     }
@@ -154,6 +330,8 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
         default:
             return -EINVAL;
     }
+#endif  /* MODULE_GNRC_SOCK_PKTQUEUE */
+    gnrc_trace(GNRC_TRACE_LAYER_SOCK, GNRC_TRACE_EVENT_DELIVER, pkt);
     /* TODO: discern NETTYPE from remote->family (set in caller), when IPv4
      * was implemented */
     ipv6_hdr_t *ipv6_hdr = gnrc_ipv6_get_header(pkt);
@@ -191,7 +369,11 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     *pkt_out = pkt; /* set out parameter */
 
 #if IS_ACTIVE(SOCK_HAS_ASYNC)
+#if IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+    if (reg->async_cb.generic && (reg->pktqueue.head != NULL)) {
+#else
     if (reg->async_cb.generic && mbox_avail(&reg->mbox)) {
+#endif
         reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
     }
 #endif
@@ -202,8 +384,9 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     return 0;
 }
 
-ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh)
+ssize_t gnrc_sock_send_flags(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                             const sock_ip_ep_t *remote, uint8_t nh,
+                             unsigned flags)
 {
     gnrc_pktsnip_t *pkt;
     kernel_pid_t iface = KERNEL_PID_UNDEF;
@@ -214,6 +397,10 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
 #endif
 #if IS_USED(MODULE_GNRC_TX_SYNC)
     gnrc_tx_sync_t tx_sync;
+    /* only wait for the last packet of a batch */
+    bool sync = !(flags & GNRC_SOCK_SEND_MORE);
+#else
+    (void)flags;
 #endif
 
     if (local->family != remote->family) {
@@ -222,7 +409,7 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     }
 
 #if IS_USED(MODULE_GNRC_TX_SYNC)
-    if (gnrc_tx_sync_append(payload, &tx_sync)) {
+    if (sync && gnrc_tx_sync_append(payload, &tx_sync)) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
@@ -291,7 +478,9 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     }
 
 #if IS_USED(MODULE_GNRC_TX_SYNC)
-    gnrc_tx_sync(&tx_sync);
+    if (sync) {
+        gnrc_tx_sync(&tx_sync);
+    }
 #endif
 
 #ifdef MODULE_GNRC_NETERR
@@ -141,6 +141,12 @@ static inline void gnrc_ep_set(sock_ip_ep_t *out, const sock_ip_ep_t *in,
  */
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx);
 
+/**
+ * @brief   Close a sock internally and release the packets not received yet
+ * @internal
+ */
+void gnrc_sock_close(gnrc_sock_reg_t *reg, gnrc_nettype_t type);
+
 /**
  * @brief   Receive a packet internally
  * @internal
@@ -148,12 +154,31 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t timeout,
                        sock_ip_ep_t *remote, gnrc_sock_recv_aux_t *aux);
 
+/**
+ * @brief   Flag for @ref gnrc_sock_send_flags(): more packets of the same
+ *          batch follow, so do not wait for the transmission of this one
+ * @internal
+ */
+#define GNRC_SOCK_SEND_MORE         (0x01U)
+
 /**
  * @brief   Send a packet internally
  * @internal
  */
-ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh);
+ssize_t gnrc_sock_send_flags(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                             const sock_ip_ep_t *remote, uint8_t nh,
+                             unsigned flags);
+
+/**
+ * @brief   Send a single packet internally
+ * @internal
+ */
+static inline ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload,
+                                     sock_ip_ep_t *local,
+                                     const sock_ip_ep_t *remote, uint8_t nh)
+{
+    return gnrc_sock_send_flags(payload, local, remote, nh, 0);
+}
 /**
  * @}
  */
@@ -12,6 +12,15 @@
  * @brief       Provides an implementation of the @ref net_sock by the
  *              @ref net_gnrc
  *
+ * By default, received packets are handed to a sock through a @ref core_mbox
+ * of @ref GNRC_SOCK_MBOX_SIZE messages. With module `gnrc_sock_pktqueue`, they
+ * are linked into a queue limited by @ref CONFIG_GNRC_SOCK_PKTQUEUE_LIMIT bytes
+ * instead, which fits flows of many small packets better and drops large
+ * bursts earlier. A blocking receive then waits on a thread flag and only
+ * arms a timer if there is nothing to receive yet. Dropped packets are
+ * counted, see @ref gnrc_sock_pktqueue_stats(). Only one thread may block
+ * in a receive function on a sock at a time.
+ *
  * @{
  *
  * @file
@@ -25,6 +34,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "kernel_defines.h"
 #include "mbox.h"
 #include "net/af.h"
 #include "net/gnrc.h"
@@ -36,6 +46,7 @@
 #include "net/sock/ip.h"
 #include "net/sock/udp.h"
 #include "net/sock/tcp.h"
+#include "thread.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -56,6 +67,18 @@ extern "C" {
 #ifndef CONFIG_GNRC_SOCK_MBOX_SIZE_EXP
 #define CONFIG_GNRC_SOCK_MBOX_SIZE_EXP      (3)
 #endif
+
+/**
+ * @brief   Default limit for the bytes in gnrc_sock_reg_t::pktqueue
+ *
+ *          Only used with module `gnrc_sock_pktqueue`. The limit covers the
+ *          whole received packets, including their headers. A packet is
+ *          always accepted when the queue is empty, so a single packet
+ *          larger than the limit can still be received.
+ */
+#ifndef CONFIG_GNRC_SOCK_PKTQUEUE_LIMIT
+#define CONFIG_GNRC_SOCK_PKTQUEUE_LIMIT     (1536U)
+#endif
 /** @} */
 
 /**
@@ -65,6 +88,43 @@ extern "C" {
 #define GNRC_SOCK_MBOX_SIZE  (1 << CONFIG_GNRC_SOCK_MBOX_SIZE_EXP)
 #endif
 
+#if IS_USED(MODULE_GNRC_SOCK_PKTQUEUE) || defined(DOXYGEN)
+/**
+ * @brief   Thread flag a thread blocking in a receive function waits on
+ *
+ *          Only used with module `gnrc_sock_pktqueue`.
+ */
+#ifndef GNRC_SOCK_PKTQUEUE_THREAD_FLAG
+#define GNRC_SOCK_PKTQUEUE_THREAD_FLAG      (1U << 4)
+#endif
+
+/**
+ * @brief   Receive statistics of a gnrc_sock_reg_t::pktqueue
+ */
+typedef struct {
+    uint32_t received;      /**< packets put into the queue */
+    uint32_t dropped_full;  /**< packets dropped because of the byte limit */
+    uint32_t dropped_nomem; /**< packets dropped because there was no space
+                             *   for the queue entry in the packet buffer */
+} gnrc_sock_pktqueue_stats_t;
+
+/**
+ * @brief   Receive queue of a sock, bounded by bytes instead of packets
+ * @internal
+ *
+ * Each entry is a snip in the packet buffer that is prepended to the
+ * received packet, so the queue takes no memory while it is empty.
+ */
+typedef struct {
+    gnrc_pktsnip_t *head;                  /**< oldest entry */
+    gnrc_pktsnip_t *tail;                  /**< newest entry */
+    thread_t *waiter;                      /**< thread blocking on the queue */
+    uint16_t bytes;                        /**< bytes of the queued packets */
+    uint16_t limit;                        /**< limit for gnrc_sock_pktqueue_t::bytes */
+    gnrc_sock_pktqueue_stats_t stats;      /**< receive statistics */
+} gnrc_sock_pktqueue_t;
+#endif  /* MODULE_GNRC_SOCK_PKTQUEUE */
+
 /**
  * @brief   Forward declaration
  * @internal
@@ -90,10 +150,16 @@ struct gnrc_sock_reg {
     struct gnrc_sock_reg *next;            /**< list-like for internal storage */
 #endif
     gnrc_netreg_entry_t entry;             /**< @ref net_gnrc_netreg entry for mbox */
+#if IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+    gnrc_sock_pktqueue_t pktqueue;         /**< receive queue for the sock */
+#else
     mbox_t mbox;                           /**< @ref core_mbox target for the sock */
     msg_t mbox_queue[GNRC_SOCK_MBOX_SIZE]; /**< queue for gnrc_sock_reg_t::mbox */
-#ifdef SOCK_HAS_ASYNC
+#endif
+#if defined(SOCK_HAS_ASYNC) || IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
     gnrc_netreg_entry_cbd_t netreg_cb;     /**< netreg callback */
+#endif
+#ifdef SOCK_HAS_ASYNC
     /**
      * @brief   asynchronous upper layer callback
      *
@@ -138,6 +204,39 @@ struct sock_udp {
     uint16_t flags;                        /**< option flags */
 };
 
+#if IS_USED(MODULE_GNRC_SOCK_PKTQUEUE) || defined(DOXYGEN)
+/**
+ * @brief   Get the receive statistics of a sock
+ *
+ * @note    Only available with module `gnrc_sock_pktqueue`.
+ *
+ * @param[in] reg   the netreg info of a sock, e.g. `&sock_udp->reg`
+ *
+ * @return  the receive statistics of the sock
+ */
+static inline const gnrc_sock_pktqueue_stats_t *gnrc_sock_pktqueue_stats(
+                                                const gnrc_sock_reg_t *reg)
+{
+    return &reg->pktqueue.stats;
+}
+
+/**
+ * @brief   Set the limit for the bytes queued for a sock
+ *
+ * Packets already queued are kept, even if they exceed the new limit.
+ *
+ * @note    Only available with module `gnrc_sock_pktqueue`.
+ *
+ * @param[in] reg   the netreg info of a sock, e.g. `&sock_udp->reg`
+ * @param[in] limit the new limit in bytes
+ */
+static inline void gnrc_sock_pktqueue_set_limit(gnrc_sock_reg_t *reg,
+                                                uint16_t limit)
+{
+    reg->pktqueue.limit = limit;
+}
+#endif  /* MODULE_GNRC_SOCK_PKTQUEUE */
+
 #ifdef __cplusplus
 }
 #endif
@@ -23,6 +23,7 @@
 #include "net/af.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
+#include "net/gnrc/portmap.h"
 #include "net/gnrc/udp.h"
 #include "net/sock/udp.h"
 #include "net/udp.h"
@@ -32,35 +33,51 @@
 
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
 static sock_udp_t *_udp_socks = NULL;
-#endif
+static gnrc_portmap_t _udp_ports = GNRC_PORTMAP_INIT;
 
 /**
- * @brief   Checks if a given UDP port is already used by another sock
+ * @brief   Adds a bound sock to the socks checked for reuse
  */
-static bool _dyn_port_used(uint16_t port)
+static void _socks_add(sock_udp_t *sock)
 {
-#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+    /* prepend to current socks */
+    sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
+    _udp_socks = sock;
+    gnrc_portmap_add(&_udp_ports, sock->local.port);
+}
+
+/**
+ * @brief   Checks if a bound sock uses a given UDP port by searching the
+ *          socks, if the port-in-use index can't tell
+ */
+static bool _port_used(uint16_t port)
+{
+    int users = gnrc_portmap_lookup(&_udp_ports, port);
+
+    if (users >= 0) {
+        return users > 0;
+    }
     for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
          ptr = (sock_udp_t *)ptr->reg.next) {
-        bool spec_addr = false;
-        for (unsigned i = 0; i < sizeof(ptr->local.addr); i++) {
-            const uint8_t *const p = (uint8_t *)&ptr->local.addr;
-            if (p[i] != 0) {
-                spec_addr = true;
-            }
-        }
-        if (spec_addr) {
-            continue;
-        }
         if (ptr->local.port == port) {
-            /* port already in use by another sock */
             return true;
         }
     }
+    return false;
+}
+#endif
+
+/**
+ * @brief   Checks if a given UDP port is already used by another sock
+ */
+static bool _dyn_port_used(uint16_t port)
+{
+#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+    return _port_used(port);
 #else
     (void) port;
-#endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
     return false;
+#endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
 }
 
 /**
@@ -108,7 +125,9 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
             }
         }
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-        else if (!(flags & SOCK_FLAGS_REUSE_EP)) {
+        /* only search the socks for the same endpoint, if the port is in
+         * use at all */
+        else if (!(flags & SOCK_FLAGS_REUSE_EP) && _port_used(port)) {
             for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
                  ptr = (sock_udp_t *)ptr->reg.next) {
                 if (memcmp(&ptr->local, local, sizeof(sock_udp_ep_t)) == 0) {
@@ -116,12 +135,12 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
                 }
             }
         }
-        /* prepend to current socks */
-        sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
-        _udp_socks = sock;
 #endif
         memcpy(&sock->local, local, sizeof(sock_udp_ep_t));
         sock->local.port = port;
+#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+        _socks_add(sock);
+#endif
     }
     memset(&sock->remote, 0, sizeof(sock_udp_ep_t));
     if (remote != NULL) {
@@ -145,11 +164,15 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
 void sock_udp_close(sock_udp_t *sock)
 {
     assert(sock != NULL);
-    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &sock->reg.entry);
+    gnrc_sock_close(&sock->reg, GNRC_NETTYPE_UDP);
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-    if (_udp_socks != NULL) {
-        gnrc_sock_reg_t *head = (gnrc_sock_reg_t *)_udp_socks;
-        LL_DELETE(head, (gnrc_sock_reg_t *)sock);
+    for (sock_udp_t **ptr = &_udp_socks; *ptr != NULL;
+         ptr = (sock_udp_t **)&(*ptr)->reg.next) {
+        if (*ptr == sock) {
+            *ptr = (sock_udp_t *)sock->reg.next;
+            gnrc_portmap_remove(&_udp_ports, sock->local.port);
+            break;
+        }
     }
 #endif
 }
@@ -278,20 +301,38 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
-                          const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_rx_msg_t *msgs,
+                       unsigned numof, uint32_t timeout)
 {
-    (void)aux;
-    int res;
-    gnrc_pktsnip_t *payload, *pkt;
-    uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_udp_ep_t remote_cpy;
-    sock_ip_ep_t *rem;
+    unsigned received = 0;
 
-    assert((sock != NULL) || (remote != NULL));
-    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
+    assert((sock != NULL) && (msgs != NULL) && (numof > 0));
+    while (received < numof) {
+        sock_udp_rx_msg_t *msg = &msgs[received];
+        ssize_t res = sock_udp_recv_aux(sock, msg->data, msg->max_len,
+                                        timeout, &msg->remote, msg->aux);
+
+        if (res < 0) {
+            if (received == 0) {
+                return res;
+            }
+            if ((res == -ENOBUFS) || (res == -EPROTO)) {
+                /* datagram was dropped, try the next one */
+                continue;
+            }
+            break;
+        }
+        msg->len = res;
+        received++;
+        /* only take what is already queued after the first datagram, so no
+         * timer is set for them */
+        timeout = 0;
+    }
+    return received;
+}
 
+static int _check_remote(const sock_udp_t *sock, const sock_udp_ep_t *remote)
+{
     if (remote != NULL) {
         if (remote->port == 0) {
             return -EINVAL;
@@ -312,13 +353,20 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
     else if (sock->remote.family == AF_UNSPEC) {
         return -ENOTCONN;
     }
+    return 0;
+}
+
+/* resolves the local end point and binds an unbound sock implicitly */
+static int _get_local(sock_udp_t *sock, const sock_udp_ep_t *remote,
+                      sock_ip_ep_t *local, uint16_t *src_port)
+{
     /* cppcheck-suppress nullPointerRedundantCheck
      * (reason: compiler evaluates lazily so this isn't a redundundant check and
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
-        if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
+        memset(local, 0, sizeof(*local));
+        if ((*src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EADDRINUSE;
         }
         /* cppcheck-suppress nullPointer
@@ -326,25 +374,38 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
          * well, see above) */
         if (sock != NULL) {
             /* bind sock object implicitly */
-            sock->local.port = src_port;
+            sock->local.port = *src_port;
             if (remote == NULL) {
                 sock->local.family = sock->remote.family;
             }
             else {
                 sock->local.family = remote->family;
             }
-            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, src_port);
+            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, *src_port);
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-            /* prepend to current socks */
-            sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
-            _udp_socks = sock;
+            _socks_add(sock);
 #endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
         }
     }
     else {
-        src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        *src_port = sock->local.port;
+        memcpy(local, &sock->local, sizeof(*local));
     }
+    return 0;
+}
+
+/* sends a datagram from a local end point resolved by _get_local() */
+static ssize_t _send_from(const sock_udp_t *sock, const sock_ip_ep_t *local,
+                          uint16_t src_port, const void *data, size_t len,
+                          const sock_udp_ep_t *remote, unsigned flags)
+{
+    int res;
+    gnrc_pktsnip_t *payload, *pkt;
+    uint16_t dst_port;
+    sock_ip_ep_t local_cpy;
+    sock_udp_ep_t remote_cpy;
+    sock_ip_ep_t *rem;
+
     /* sock can't be NULL at this point */
     if (remote == NULL) {
         rem = (sock_ip_ep_t *)&sock->remote;
@@ -356,10 +417,11 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
         dst_port = remote->port;
     }
     /* check for matching address families in local and remote */
-    if (local.family == AF_UNSPEC) {
-        local.family = rem->family;
+    memcpy(&local_cpy, local, sizeof(local_cpy));
+    if (local_cpy.family == AF_UNSPEC) {
+        local_cpy.family = rem->family;
     }
-    else if (local.family != rem->family) {
+    else if (local_cpy.family != rem->family) {
         return -EINVAL;
     }
     /* generate payload and header snips */
@@ -372,10 +434,36 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    res = gnrc_sock_send_flags(pkt, &local_cpy, rem, PROTNUM_UDP, flags);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
+    return res;
+}
+
+static ssize_t _send(sock_udp_t *sock, const void *data, size_t len,
+                     const sock_udp_ep_t *remote, unsigned flags)
+{
+    sock_ip_ep_t local;
+    uint16_t src_port;
+    int res;
+
+    assert((sock != NULL) || (remote != NULL));
+    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
+
+    if (((res = _check_remote(sock, remote)) < 0) ||
+        ((res = _get_local(sock, remote, &local, &src_port)) < 0)) {
+        return res;
+    }
+    return _send_from(sock, &local, src_port, data, len, remote, flags);
+}
+
+ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
+                          const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    (void)aux;
+    ssize_t res = _send(sock, data, len, remote, 0);
+
 #ifdef SOCK_HAS_ASYNC
     if ((sock != NULL) && (sock->reg.async_cb.udp)) {
         sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
@@ -385,6 +473,47 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
     return res;
 }
 
+int sock_udp_send_many(sock_udp_t *sock, const sock_udp_tx_msg_t *msgs,
+                       unsigned numof)
+{
+    sock_ip_ep_t local;
+    uint16_t src_port;
+    unsigned sent;
+
+    assert((msgs != NULL) && (numof > 0));
+    for (sent = 0; sent < numof; sent++) {
+        const sock_udp_tx_msg_t *msg = &msgs[sent];
+        ssize_t res;
+
+        assert((sock != NULL) || (msg->remote != NULL));
+        assert((msg->len == 0) || (msg->data != NULL));
+        res = _check_remote(sock, msg->remote);
+        /* the local end point, and with it the source port, is resolved
+         * once for the whole batch, binding sock implicitly if needed */
+        if ((res == 0) && (sent == 0)) {
+            res = _get_local(sock, msg->remote, &local, &src_port);
+        }
+        if (res == 0) {
+            res = _send_from(sock, &local, src_port, msg->data, msg->len,
+                             msg->remote,
+                             (sent + 1 < numof) ? GNRC_SOCK_SEND_MORE : 0);
+        }
+        if (res < 0) {
+            if (sent == 0) {
+                return res;
+            }
+            break;
+        }
+    }
+#ifdef SOCK_HAS_ASYNC
+    if ((sock != NULL) && (sock->reg.async_cb.udp)) {
+        sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
+                               sock->reg.async_cb_arg);
+    }
+#endif  /* SOCK_HAS_ASYNC */
+    return sent;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_trace
+ * @{
+ *
+ * @file
+ * @brief   GNRC packet path tracing implementation
+ *
+ * The writer reserves a slot by incrementing the global sequence number,
+ * invalidates the slot, fills it and only then publishes the sequence
+ * number in the slot. A reader copies a slot and accepts the copy only if
+ * the slot carried the expected sequence number before and after copying.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "atomic_utils.h"
+#include "irq.h"
+#include "ztimer.h"
+
+#include "net/gnrc/trace.h"
+
+#define BUF_MASK    (GNRC_TRACE_BUF_SIZE - 1)
+
+/* keeps the compiler from moving the accesses to an entry across the
+ * accesses to its sequence number */
+#define _barrier()  __asm__ volatile ("" : : : "memory")
+
+static gnrc_trace_entry_t _buf[GNRC_TRACE_BUF_SIZE];
+/* sequence number of the next entry, 0 marks an invalid entry */
+static uint32_t _next = 1;
+static uint8_t _enabled = 1;
+
+static const char *_layer_str[] = {
+    [GNRC_TRACE_LAYER_NETIF] = "netif",
+    [GNRC_TRACE_LAYER_SIXLOWPAN] = "6lo",
+    [GNRC_TRACE_LAYER_IPV6] = "ipv6",
+    [GNRC_TRACE_LAYER_UDP] = "udp",
+    [GNRC_TRACE_LAYER_TCP] = "tcp",
+    [GNRC_TRACE_LAYER_SOCK] = "sock",
+};
+
+static const char *_event_str[] = {
+    [GNRC_TRACE_EVENT_RX] = "rx",
+    [GNRC_TRACE_EVENT_TX] = "tx",
+    [GNRC_TRACE_EVENT_OUT] = "out",
+    [GNRC_TRACE_EVENT_FWD] = "fwd",
+    [GNRC_TRACE_EVENT_FRAG] = "frag",
+    [GNRC_TRACE_EVENT_REASS] = "reass",
+    [GNRC_TRACE_EVENT_DEMUX] = "demux",
+    [GNRC_TRACE_EVENT_DELIVER] = "deliver",
+};
+
+void gnrc_trace_add(gnrc_trace_layer_t layer, gnrc_trace_event_t event,
+                    const void *pkt, size_t len)
+{
+    if (!atomic_load_u8(&_enabled)) {
+        return;
+    }
+
+    uint32_t seq = atomic_fetch_add_u32(&_next, 1);
+    gnrc_trace_entry_t *e = &_buf[seq & BUF_MASK];
+
+    atomic_store_u32(&e->seq, 0);
+    _barrier();
+    e->time = ztimer_now(ZTIMER_USEC);
+    e->pkt = pkt;
+    e->len = (len > UINT16_MAX) ? UINT16_MAX : len;
+    e->layer = layer;
+    e->event = event;
+    _barrier();
+    atomic_store_u32(&e->seq, seq);
+}
+
+unsigned gnrc_trace_read(uint32_t *seq, gnrc_trace_entry_t *entries,
+                         unsigned max)
+{
+    uint32_t next = atomic_load_u32(&_next);
+    uint32_t pos = *seq;
+    unsigned res = 0;
+
+    if ((int32_t)(next - pos) > (int32_t)GNRC_TRACE_BUF_SIZE) {
+        /* skip the entries already overwritten */
+        pos = next - GNRC_TRACE_BUF_SIZE;
+    }
+    else if ((int32_t)(next - pos) < 0) {
+        pos = next;
+    }
+    for (; (pos != next) && (res < max); pos++) {
+        const gnrc_trace_entry_t *e = &_buf[pos & BUF_MASK];
+
+        if ((pos == 0) || (atomic_load_u32(&e->seq) != pos)) {
+            /* never written, being written or already overwritten */
+            continue;
+        }
+        _barrier();
+        memcpy(&entries[res], e, sizeof(*e));
+        _barrier();
+        if (atomic_load_u32(&e->seq) == pos) {
+            entries[res].seq = pos;
+            res++;
+        }
+    }
+    *seq = pos;
+    return res;
+}
+
+void gnrc_trace_dump(void)
+{
+    gnrc_trace_entry_t e;
+    /* a shell on a network stdio would overwrite the entries being printed */
+    uint8_t enabled = atomic_load_u8(&_enabled);
+    uint32_t seq = atomic_load_u32(&_next) - GNRC_TRACE_BUF_SIZE;
+
+    gnrc_trace_enable(false);
+    while (gnrc_trace_read(&seq, &e, 1) > 0) {
+        printf("trace %" PRIu32 " %" PRIu32 " %s %s 0x%08" PRIxPTR " %u\n",
+               e.seq, e.time, gnrc_trace_layer_str(e.layer),
+               gnrc_trace_event_str(e.event), (uintptr_t)e.pkt,
+               (unsigned)e.len);
+    }
+    gnrc_trace_enable(enabled);
+}
+
+void gnrc_trace_reset(void)
+{
+    unsigned state = irq_disable();
+
+    /* entries are only valid with their own sequence number */
+    memset(_buf, 0, sizeof(_buf));
+    irq_restore(state);
+}
+
+void gnrc_trace_enable(bool enable)
+{
+    atomic_store_u8(&_enabled, enable);
+}
+
+const char *gnrc_trace_layer_str(gnrc_trace_layer_t layer)
+{
+    if ((unsigned)layer >= GNRC_TRACE_LAYER_NUMOF) {
+        return "?";
+    }
+    return _layer_str[layer];
+}
+
+const char *gnrc_trace_event_str(gnrc_trace_event_t event)
+{
+    if ((unsigned)event >= GNRC_TRACE_EVENT_NUMOF) {
+        return "?";
+    }
+    return _event_str[event];
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Port-in-use index implementation using linear probing
+ */
+
+#include <assert.h>
+
+#include "net/gnrc/portmap.h"
+
+#define SLOT_MASK   (GNRC_PORTMAP_SIZE - 1)
+
+static inline unsigned _hash(uint16_t port)
+{
+    /* Fibonacci hashing, the ports in use are often consecutive */
+    return (((uint32_t)port * 0x9e3779b1U) >> 16) & SLOT_MASK;
+}
+
+/* returns the slot of port or the free slot ending its probe sequence,
+ * -1 if the table is full and port is not in it */
+static int _find(const gnrc_portmap_t *map, uint16_t port)
+{
+    unsigned idx = _hash(port);
+
+    for (unsigned i = 0; i < GNRC_PORTMAP_SIZE; i++) {
+        const gnrc_portmap_slot_t *slot = &map->slots[idx];
+        if ((slot->port == port) || (slot->port == 0)) {
+            return idx;
+        }
+        idx = (idx + 1) & SLOT_MASK;
+    }
+    return -1;
+}
+
+void gnrc_portmap_add(gnrc_portmap_t *map, uint16_t port)
+{
+    int idx;
+
+    assert(port != 0);
+    if ((idx = _find(map, port)) < 0) {
+        map->overflow++;
+        return;
+    }
+    map->slots[idx].port = port;
+    map->slots[idx].users++;
+}
+
+void gnrc_portmap_remove(gnrc_portmap_t *map, uint16_t port)
+{
+    int idx;
+
+    assert(port != 0);
+    idx = _find(map, port);
+    if ((idx < 0) || (map->slots[idx].port == 0)) {
+        assert(map->overflow > 0);
+        map->overflow--;
+        return;
+    }
+    if (--map->slots[idx].users > 0) {
+        return;
+    }
+    /* shift back the following entries of the cluster, so their probe
+     * sequences don't end at the hole */
+    unsigned hole = idx;
+    unsigned next = (hole + 1) & SLOT_MASK;
+
+    while (map->slots[next].port != 0) {
+        unsigned home = _hash(map->slots[next].port);
+        /* move the entry, if its home is not between the hole and it */
+        if (((next - home) & SLOT_MASK) >= ((next - hole) & SLOT_MASK)) {
+            map->slots[hole] = map->slots[next];
+            hole = next;
+        }
+        next = (next + 1) & SLOT_MASK;
+        if (next == (unsigned)idx) {
+            break;
+        }
+    }
+    map->slots[hole].port = 0;
+    map->slots[hole].users = 0;
+}
+
+int gnrc_portmap_lookup(const gnrc_portmap_t *map, uint16_t port)
+{
+    int idx = _find(map, port);
+
+    if ((idx >= 0) && (map->slots[idx].port == port) && (port != 0)) {
+        return map->slots[idx].users;
+    }
+    return (map->overflow > 0) ? -1 : 0;
+}
+
+/** @} */
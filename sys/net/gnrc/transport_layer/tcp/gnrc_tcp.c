@@ -705,8 +705,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was sent and all sent data was acked */
+    while (ret == 0 || tcb->pkt_retransmit_len != 0) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
@@ -729,9 +729,14 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                         MSG_TYPE_PROBE_TIMEOUT, &mbox);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Try to send remaining data in case we are not probing. Acknowledgments
+         * received meanwhile might have made room for further segments. */
+        if (ret >= 0 && (size_t)ret < len && !probing_mode) {
+            ssize_t sent = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL,
+                                         (uint8_t *) data + ret, len - ret);
+            if (sent > 0 || ret == 0) {
+                ret += sent;
+            }
         }
 
         /* Wait for responses */
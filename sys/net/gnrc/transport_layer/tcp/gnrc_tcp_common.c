@@ -19,7 +19,7 @@
 
 #include "include/gnrc_tcp_common.h"
 
-static _gnrc_tcp_common_tcb_list_t _list = {NULL, MUTEX_INIT};
+static _gnrc_tcp_common_tcb_list_t _list = {NULL, MUTEX_INIT, GNRC_PORTMAP_INIT};
 
 _gnrc_tcp_common_tcb_list_t *_gnrc_tcp_common_get_tcb_list(void)
 {
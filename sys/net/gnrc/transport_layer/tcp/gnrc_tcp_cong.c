@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of include/gnrc_tcp_cong.h
+ */
+
+#ifdef MODULE_GNRC_TCP_CONGURE_RENO
+
+#include <assert.h>
+
+#include "clist.h"
+#include "net/gnrc/pktbuf.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_cong.h"
+#include "include/gnrc_tcp_pkt.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* the retransmit queue bounds the segments in flight, and with them the
+ * duplicate ACKs a single loss can cause */
+static_assert(CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE > 3,
+              "Fast retransmit needs CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE > 3");
+
+static void _fast_retransmit(congure_reno_snd_t *c);
+
+static const congure_reno_snd_consts_t _consts =
+    CONGURE_RENO_SND_CONSTS_INIT(_fast_retransmit, CONFIG_GNRC_TCP_MSS);
+
+/**
+ * @brief Retransmits the oldest unacknowledged segment without waiting for
+ *        the retransmission timer.
+ *
+ * @param[in] c   Congestion control state of the connection.
+ */
+static void _fast_retransmit(congure_reno_snd_t *c)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_tcb_t *tcb = c->super.ctx;
+
+    if (tcb->pkt_retransmit_len > 0) {
+        TCP_DEBUG_INFO("Fast retransmit.");
+        /* Do not take samples across retransmissions (Karns Algorithm) */
+        tcb->status &= ~STATUS_RTT_MEASURING;
+        /* Every send attempt consumes a user */
+        gnrc_pktbuf_hold(tcb->pkt_retransmit[0], 1);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_cong_init(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    congure_wnd_size_t mss = CONFIG_GNRC_TCP_MSS;
+
+    /* Segments are limited by our and the peers MSS */
+    if (tcb->mss > 0 && tcb->mss < mss) {
+        mss = tcb->mss;
+    }
+    congure_reno_snd_setup(&tcb->cong, &_consts);
+    tcb->cong.super.driver->init(&tcb->cong.super, tcb);
+    congure_reno_snd_set_mss(&tcb->cong, mss);
+    TCP_DEBUG_LEAVE;
+}
+
+uint32_t _gnrc_tcp_cong_wnd(gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->cong.super.cwnd < tcb->snd_wnd) ? tcb->cong.super.cwnd
+                                                 : tcb->snd_wnd;
+}
+
+void _gnrc_tcp_cong_sent(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    tcb->cong.super.driver->report_msg_sent(&tcb->cong.super, len);
+}
+
+void _gnrc_tcp_cong_ack(gnrc_tcp_tcb_t *tcb, uint32_t ack, uint32_t acked)
+{
+    congure_snd_msg_t msg = { .size = acked };
+    congure_snd_ack_t ack_info = { .id = ack, .clean = true };
+
+    tcb->cong.super.driver->report_msg_acked(&tcb->cong.super, &msg, &ack_info);
+}
+
+void _gnrc_tcp_cong_dup_ack(gnrc_tcp_tcb_t *tcb, uint32_t ack, uint32_t pay_len,
+                            bool clean)
+{
+    congure_snd_msg_t msg = { .size = 0 };
+    congure_snd_ack_t ack_info = { .id = ack, .size = pay_len, .clean = clean };
+
+    tcb->cong.super.driver->report_msg_acked(&tcb->cong.super, &msg, &ack_info);
+}
+
+void _gnrc_tcp_cong_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    clist_node_t msgs = { .next = NULL };
+    congure_snd_msg_t msg = { .size = tcb->cong.in_flight };
+
+    /* All data in flight is considered lost */
+    clist_rpush(&msgs, &msg.super);
+    tcb->cong.super.driver->report_msgs_timeout(&tcb->cong.super,
+                                                (congure_snd_msg_t *)msgs.next);
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_GNRC_TCP_CONGURE_RENO */
+/** @} */
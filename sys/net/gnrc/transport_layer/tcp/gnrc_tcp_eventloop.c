@@ -23,6 +23,7 @@
 #include "net/af.h"
 #include "net/tcp.h"
 #include "net/gnrc.h"
+#include "net/gnrc/trace.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_fsm.h"
@@ -252,6 +253,7 @@ static int _receive(gnrc_pktsnip_t *pkt)
      * (reason: tcb can be NULL at runtime)
      */
     if (tcb != NULL) {
+        gnrc_trace(GNRC_TRACE_LAYER_TCP, GNRC_TRACE_EVENT_DEMUX, pkt);
         _gnrc_tcp_fsm(tcb, FSM_EVENT_RCVD_PKT, pkt, NULL, 0);
     }
     /* No fitting TCB has been found. Respond with reset */
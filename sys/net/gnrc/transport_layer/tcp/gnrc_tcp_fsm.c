@@ -25,6 +25,7 @@
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_cong.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
@@ -58,6 +59,13 @@ static int _is_local_port_in_use(const uint16_t port_number)
     TCP_DEBUG_ENTER;
     gnrc_tcp_tcb_t *iter = NULL;
     _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
+    int users = gnrc_portmap_lookup(&list->ports, port_number);
+
+    if (users >= 0) {
+        TCP_DEBUG_LEAVE;
+        return (users > 0);
+    }
+    /* The index overflowed: Search the TCBs */
     LL_SEARCH_SCALAR(list->head, iter, local_port, port_number);
     TCP_DEBUG_LEAVE;
     return (iter != NULL);
@@ -92,11 +100,12 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    for (uint8_t i = 0; i < tcb->pkt_retransmit_len; i++) {
+        gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
     }
+    tcb->pkt_retransmit_len = 0;
+    tcb->status &= ~STATUS_RTT_MEASURING;
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -156,7 +165,11 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             {
                 /* Remove connection from active connections */
                 mutex_lock(&list->lock);
-                LL_DELETE(list->head, tcb);
+                LL_SEARCH(list->head, iter, tcb, TCB_EQUAL);
+                if (iter != NULL) {
+                    LL_DELETE(list->head, tcb);
+                    gnrc_portmap_remove(&list->ports, tcb->local_port);
+                }
                 mutex_unlock(&list->lock);
 
                 /* Free potentially allocated receive buffer */
@@ -177,6 +190,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             /* Clear Accepted Status */
             tcb->status &= ~(STATUS_ACCEPTED);
 
+            /* Forget out-of-order data of a previous connection */
+            _gnrc_tcp_rcvbuf_clear_ooo(tcb);
+
             /* Clear address info */
 #ifdef MODULE_GNRC_IPV6
             if (tcb->address_family == AF_INET6) {
@@ -193,6 +209,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             LL_SEARCH(list->head, iter, tcb, TCB_EQUAL);
             if (iter == NULL) {
                 LL_PREPEND(list->head, tcb);
+                gnrc_portmap_add(&list->ports, tcb->local_port);
             }
             mutex_unlock(&list->lock);
             break;
@@ -218,6 +235,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                     tcb->local_port = _get_random_local_port();
                 }
                 LL_PREPEND(list->head, tcb);
+                gnrc_portmap_add(&list->ports, tcb->local_port);
             }
             mutex_unlock(&list->lock);
             break;
@@ -232,6 +250,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             break;
 
         case FSM_STATE_ESTABLISHED:
+            /* The MSS of the peer is known now: Setup congestion control */
+            _gnrc_tcp_cong_init(tcb);
+            /* Fall through */
         case FSM_STATE_CLOSE_WAIT:
             /* Stop timeout for listening TCBs */
             if (tcb->status & STATUS_LISTENING) {
@@ -308,6 +329,8 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 /**
  * @brief FSM Handling function for sending data.
  *
+ * Sends as many segments as the send window and the retransmit queue allow.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in,out] buf   Buffer containing data to send.
  * @param[in]     len   Maximum Number of Bytes to send from @p buf.
@@ -317,27 +340,37 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+
+    while (sent < len && tcb->pkt_retransmit_len < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+        uint32_t wnd = _gnrc_tcp_cong_wnd(tcb);
+        size_t payload = (tcb->snd_una + wnd) - tcb->snd_nxt;
+
+        /* Check if window is open */
+        if (wnd == 0 || payload == 0 || payload > wnd) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
         payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
         payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        payload = (payload < (len - sent)) ? payload : (len - sent);
 
         /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
+                                tcb->snd_nxt, tcb->rcv_nxt,
+                                (uint8_t *)buf + sent, payload) < 0) {
+            break;
+        }
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        _gnrc_tcp_cong_sent(tcb, payload);
+        sent += payload;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
 }
 
 /**
@@ -712,8 +745,16 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
                     tcb->snd_una = seg_ack;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    _gnrc_tcp_cong_ack(tcb, seg_ack, acked);
+                }
+                /* Possibly a duplicate ACK, signaling a lost segment */
+                else if (seg_ack == tcb->snd_una && tcb->pkt_retransmit_len > 0) {
+                    _gnrc_tcp_cong_dup_ack(tcb, seg_ack, pay_len,
+                                           !(ctl & (MSK_SYN | MSK_FIN)) &&
+                                           seg_wnd == tcb->snd_wnd);
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -738,25 +779,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -775,18 +816,31 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Search for begin of payload */
                 snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
 
-                /* Accept only data that is expected, to be received */
+                /* Data that is expected next goes straight into the receive buffer */
                 if (tcb->rcv_nxt == seg_seq) {
                     /* Copy contents into receive buffer */
                     while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
                         tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
                         snp = snp->next;
                     }
+                    /* Append data that was received out of order before */
+                    tcb->rcv_nxt += _gnrc_tcp_rcvbuf_merge_ooo(tcb);
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
+                /* Data following a gap is buffered until the gap is filled */
+                else if (LSS_32_BIT(tcb->rcv_nxt, seg_seq)) {
+                    uint32_t seq = seg_seq;
+                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+                        if (_gnrc_tcp_rcvbuf_add_ooo(tcb, seq, snp->data, snp->size) < 0) {
+                            break;
+                        }
+                        seq += snp->size;
+                        snp = snp->next;
+                    }
+                }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
                 if (!(ctl & MSK_FIN)) {
@@ -803,6 +857,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 TCP_DEBUG_LEAVE;
                 return 0;
             }
+            /* Ignore a FIN that arrived before all preceding data, it is retransmitted */
+            if (tcb->state != FSM_STATE_TIME_WAIT && seg_seq + pay_len != tcb->rcv_nxt) {
+                _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                                    tcb->rcv_nxt, NULL, 0);
+                _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                TCP_DEBUG_LEAVE;
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
@@ -813,7 +875,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->pkt_retransmit_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +919,11 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->pkt_retransmit_len > 0) {
+        _gnrc_tcp_cong_timeout(tcb);
+        /* Only the oldest segment is retransmitted (RFC 6298, 5.4) */
+        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit[0], true);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -285,11 +285,9 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
     }
     else {
         tcb->retries += 1;
@@ -375,6 +373,59 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+/**
+ * @brief Calculates the sequence number acknowledging a whole packet.
+ *
+ * @param[in] pkt   Packet to calculate the end of.
+ *
+ * @returns   Sequence number following the last sequence number of @p pkt.
+ */
+static uint32_t _seg_end(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    tcp_hdr_t *hdr = (tcp_hdr_t *) snp->data;
+
+    return byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(pkt);
+}
+
+/**
+ * @brief Calculates the current RTO from the RTT estimation (see RFC 6298).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _calc_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* Without a measurement, rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+}
+
+/**
+ * @brief Performs boundary checks on the current RTO and (re)starts the
+ *        retransmission timer for the oldest unacknowledged segment.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _restart_retransmit_timer(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit)
 {
@@ -390,8 +441,15 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
+    /* Only the oldest segment is ever retransmitted */
+    if (retransmit && (tcb->pkt_retransmit_len == 0 || tcb->pkt_retransmit[0] != pkt)) {
+        TCP_DEBUG_ERROR("-EINVAL: pkt is not the oldest segment in flight.");
+        TCP_DEBUG_LEAVE;
+        return -EINVAL;
+    }
+
+    /* Check if retransmit queue is full */
+    if (!retransmit && tcb->pkt_retransmit_len >= CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
         TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
         TCP_DEBUG_LEAVE;
         return -ENOMEM;
@@ -408,22 +466,29 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    /* Increase users: every send attempt consumes a user */
     gnrc_pktbuf_hold(pkt, 1);
 
-    /* RTO adjustment */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+        tcb->pkt_retransmit[tcb->pkt_retransmit_len++] = pkt;
+
+        /* Time one segment at a time for the RTT estimation */
+        if (!(tcb->status & STATUS_RTT_MEASURING)) {
+            tcb->status |= STATUS_RTT_MEASURING;
+            tcb->rtt_start = evtimer_now_msec();
+            tcb->rtt_seq = _seg_end(pkt);
         }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+
+        /* The timer is already running if other segments are in flight */
+        if (tcb->pkt_retransmit_len == 1) {
+            _calc_rto(tcb);
+            _restart_retransmit_timer(tcb);
         }
     }
     else {
+        /* Do not take samples across retransmissions (Karns Algorithm) */
+        tcb->status &= ~STATUS_RTT_MEASURING;
+
         /* If this is a retransmission: Double the rto (Timer Backoff) */
         tcb->rto *= 2;
 
@@ -433,19 +498,9 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
             tcb->srtt = RTO_UNINITIALIZED;
             tcb->rtt_var = RTO_UNINITIALIZED;
         }
+        _restart_retransmit_timer(tcb);
     }
 
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
-    }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -453,35 +508,39 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    uint8_t acked = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->pkt_retransmit_len == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
+    /* Release all segments that are acknowledged completely */
+    while (acked < tcb->pkt_retransmit_len &&
+           LEQ_32_BIT(_seg_end(tcb->pkt_retransmit[acked]), ack)) {
+        gnrc_pktbuf_release(tcb->pkt_retransmit[acked]);
+        acked++;
+    }
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+    if (acked == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+    tcb->pkt_retransmit_len -= acked;
+    memmove(tcb->pkt_retransmit, &tcb->pkt_retransmit[acked],
+            tcb->pkt_retransmit_len * sizeof(tcb->pkt_retransmit[0]));
+    tcb->retries = 0;
 
-        /* Measure round trip time */
+    /* Measure round trip time if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_MEASURING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
+        tcb->status &= ~STATUS_RTT_MEASURING;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -496,6 +555,15 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+
+    /* Stop the timer if everything was acknowledged, restart it otherwise (RFC 6298, 5.3) */
+    if (tcb->pkt_retransmit_len == 0) {
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    }
+    else {
+        _calc_rto(tcb);
+        _restart_retransmit_timer(tcb);
+    }
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -18,6 +18,8 @@
 #include <errno.h>
 #include <mutex.h>
 #include <stdint.h>
+#include <string.h>
+#include "kernel_defines.h"
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_rcvbuf.h"
@@ -25,11 +27,23 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/**
+ * @brief Sequence number range of data received out of order.
+ */
+typedef struct {
+    uint32_t start;     /**< First sequence number of the range */
+    uint32_t end;       /**< Sequence number following the range */
+} _rcvbuf_ooo_t;
+
 /**
  * @brief Receive buffer entry.
  */
 typedef struct {
     uint8_t used;                          /**< Flag: Is buffer in use? */
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+    uint8_t ooo_len;                       /**< Number of out-of-order ranges */
+    _rcvbuf_ooo_t ooo[CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS]; /**< Out-of-order ranges */
+#endif
     uint8_t buffer[GNRC_TCP_RCV_BUF_SIZE]; /**< Receive buffer storage */
 } _rcvbuf_entry_t;
 
@@ -111,6 +125,7 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
             ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, GNRC_TCP_RCV_BUF_SIZE);
         }
     }
+    _gnrc_tcp_rcvbuf_clear_ooo(tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -124,3 +139,138 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     }
     TCP_DEBUG_LEAVE;
 }
+
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+/**
+ * @brief Get the receive buffer entry of a TCB.
+ *
+ * @param[in] tcb   TCB holding the receive buffer.
+ *
+ * @returns   Receive buffer entry.
+ */
+static _rcvbuf_entry_t *_entry(gnrc_tcp_tcb_t *tcb)
+{
+    return container_of(tcb->rcv_buf_raw, _rcvbuf_entry_t, buffer[0]);
+}
+
+/**
+ * @brief Remove an out-of-order range.
+ *
+ * @param[in,out] entry   Receive buffer entry holding the range.
+ * @param[in]     idx     Index of the range to remove.
+ */
+static void _ooo_remove(_rcvbuf_entry_t *entry, unsigned idx)
+{
+    entry->ooo[idx] = entry->ooo[--entry->ooo_len];
+}
+#endif
+
+void _gnrc_tcp_rcvbuf_clear_ooo(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+    if (tcb->rcv_buf_raw != NULL) {
+        _entry(tcb)->ooo_len = 0;
+    }
+#else
+    (void)tcb;
+#endif
+    TCP_DEBUG_LEAVE;
+}
+
+int _gnrc_tcp_rcvbuf_add_ooo(gnrc_tcp_tcb_t *tcb, uint32_t seq,
+                             const void *data, size_t len)
+{
+    TCP_DEBUG_ENTER;
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+    _rcvbuf_entry_t *entry = _entry(tcb);
+    ringbuffer_t *rb = &tcb->rcv_buf;
+    uint32_t offset = seq - tcb->rcv_nxt;
+    size_t free = rb->size - rb->avail;
+
+    /* Only data inside the free part of the buffer can be stored */
+    if (offset >= free) {
+        TCP_DEBUG_ERROR("-ENOSPC: Data is outside of the receive buffer.");
+        TCP_DEBUG_LEAVE;
+        return -ENOSPC;
+    }
+    if (len > free - offset) {
+        len = free - offset;
+    }
+
+    /* Merge with all overlapping or adjacent ranges */
+    uint32_t start = seq;
+    uint32_t end = seq + len;
+    for (unsigned i = 0; i < entry->ooo_len;) {
+        _rcvbuf_ooo_t *r = &entry->ooo[i];
+        if (LEQ_32_BIT(r->start, end) && LEQ_32_BIT(start, r->end)) {
+            start = LSS_32_BIT(r->start, start) ? r->start : start;
+            end = LSS_32_BIT(end, r->end) ? r->end : end;
+            _ooo_remove(entry, i);
+        }
+        else {
+            i++;
+        }
+    }
+    if (entry->ooo_len >= CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS) {
+        TCP_DEBUG_ERROR("-ENOMEM: No space left to track out-of-order data.");
+        TCP_DEBUG_LEAVE;
+        return -ENOMEM;
+    }
+    entry->ooo[entry->ooo_len].start = start;
+    entry->ooo[entry->ooo_len].end = end;
+    entry->ooo_len++;
+
+    /* Copy data behind the in-order data. The position of a sequence number in
+     * the buffer does not change when in-order data is added or read. */
+    size_t pos = (rb->start + rb->avail + offset) % rb->size;
+    size_t chunk = (len < rb->size - pos) ? len : rb->size - pos;
+    memcpy(&rb->buf[pos], data, chunk);
+    memcpy(rb->buf, (const uint8_t *)data + chunk, len - chunk);
+    TCP_DEBUG_LEAVE;
+    return 0;
+#else
+    (void)tcb;
+    (void)seq;
+    (void)data;
+    (void)len;
+    TCP_DEBUG_LEAVE;
+    return -ENOTSUP;
+#endif
+}
+
+size_t _gnrc_tcp_rcvbuf_merge_ooo(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    size_t merged = 0;
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+    _rcvbuf_entry_t *entry = _entry(tcb);
+    uint32_t nxt = tcb->rcv_nxt;
+
+    for (unsigned i = 0; i < entry->ooo_len;) {
+        _rcvbuf_ooo_t *r = &entry->ooo[i];
+        if (LEQ_32_BIT(r->end, nxt)) {
+            /* Range was received in order meanwhile */
+            _ooo_remove(entry, i);
+        }
+        else if (LEQ_32_BIT(r->start, nxt)) {
+            /* Range continues the in-order data: the data is in place already,
+             * only make it available for reading */
+            uint32_t n = r->end - nxt;
+            tcb->rcv_buf.avail += n;
+            nxt += n;
+            merged += n;
+            _ooo_remove(entry, i);
+            /* Start over, other ranges might continue this one */
+            i = 0;
+        }
+        else {
+            i++;
+        }
+    }
+#else
+    (void)tcb;
+#endif
+    TCP_DEBUG_LEAVE;
+    return merged;
+}
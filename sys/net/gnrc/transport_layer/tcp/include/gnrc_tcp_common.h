@@ -25,6 +25,7 @@
 #include "mutex.h"
 #include "evtimer.h"
 #include "net/gnrc/netapi.h"
+#include "net/gnrc/portmap.h"
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
@@ -47,6 +48,7 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_RTT_MEASURING  (1 << 5) /**< Internal: Status bitmask RTT_MEASURING */
 /** @} */
 
 /**
@@ -152,6 +154,7 @@ extern "C" {
 typedef struct {
     gnrc_tcp_tcb_t *head; /**< Head of TCB list */
     mutex_t lock;         /**< Lock of TCB list */
+    gnrc_portmap_t ports; /**< Local ports of the TCBs in the list */
 } _gnrc_tcp_common_tcb_list_t;
 
 /**
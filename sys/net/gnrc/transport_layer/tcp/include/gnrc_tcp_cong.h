@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Congestion control of GNRC TCP using @ref sys_congure_reno.
+ *
+ * Without the module `gnrc_tcp_congure_reno` all functions are no-ops and
+ * the sender is only limited by the receive window of the peer.
+ */
+
+#ifndef GNRC_TCP_CONG_H
+#define GNRC_TCP_CONG_H
+
+#include <stdint.h>
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MODULE_GNRC_TCP_CONGURE_RENO) || defined(DOXYGEN)
+/**
+ * @brief Initializes congestion control once a connection is established.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_cong_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Get the window that limits the data in flight.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Minimum of the send window and the congestion window.
+ */
+uint32_t _gnrc_tcp_cong_wnd(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Reports a segment carrying new data to congestion control.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     len   Number of payload bytes in the segment.
+ */
+void _gnrc_tcp_cong_sent(gnrc_tcp_tcb_t *tcb, uint32_t len);
+
+/**
+ * @brief Reports an ACK acknowledging new data to congestion control.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     ack     Acknowledgment number of the ACK.
+ * @param[in]     acked   Number of newly acknowledged sequence numbers.
+ */
+void _gnrc_tcp_cong_ack(gnrc_tcp_tcb_t *tcb, uint32_t ack, uint32_t acked);
+
+/**
+ * @brief Reports an ACK not acknowledging new data to congestion control.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     ack       Acknowledgment number of the ACK.
+ * @param[in]     pay_len   Payload length of the segment carrying the ACK.
+ * @param[in]     clean     True, if SYN and FIN are cleared and the
+ *                          advertised window did not change.
+ */
+void _gnrc_tcp_cong_dup_ack(gnrc_tcp_tcb_t *tcb, uint32_t ack, uint32_t pay_len,
+                            bool clean);
+
+/**
+ * @brief Reports a retransmission timeout to congestion control.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_cong_timeout(gnrc_tcp_tcb_t *tcb);
+#else
+static inline void _gnrc_tcp_cong_init(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline uint32_t _gnrc_tcp_cong_wnd(gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->snd_wnd;
+}
+
+static inline void _gnrc_tcp_cong_sent(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    (void)tcb;
+    (void)len;
+}
+
+static inline void _gnrc_tcp_cong_ack(gnrc_tcp_tcb_t *tcb, uint32_t ack,
+                                      uint32_t acked)
+{
+    (void)tcb;
+    (void)ack;
+    (void)acked;
+}
+
+static inline void _gnrc_tcp_cong_dup_ack(gnrc_tcp_tcb_t *tcb, uint32_t ack,
+                                          uint32_t pay_len, bool clean)
+{
+    (void)tcb;
+    (void)ack;
+    (void)pay_len;
+    (void)clean;
+}
+
+static inline void _gnrc_tcp_cong_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_CONG_H */
+/** @} */
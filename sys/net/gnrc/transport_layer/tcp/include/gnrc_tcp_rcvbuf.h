@@ -48,6 +48,43 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Forget all data received out of order.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ */
+void _gnrc_tcp_rcvbuf_clear_ooo(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Store data that was received out of order.
+ *
+ * The data is placed in the free part of the receive buffer at the position
+ * it will have once all preceding data was received.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[in]     seq    Sequence number of the first byte in @p data.
+ *                       Must be larger than tcb->rcv_nxt.
+ * @param[in]     data   Data to store.
+ * @param[in]     len    Number of bytes in @p data.
+ *
+ * @returns   Zero on success.
+ *            -ENOSPC if @p seq is outside of the receive buffer.
+ *            -ENOMEM if no more out-of-order ranges can be tracked.
+ *            -ENOTSUP if out-of-order buffering is disabled.
+ */
+int _gnrc_tcp_rcvbuf_add_ooo(gnrc_tcp_tcb_t *tcb, uint32_t seq,
+                             const void *data, size_t len);
+
+/**
+ * @brief Make out-of-order data available that now follows the in-order data.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ *
+ * @returns   Number of bytes appended to the in-order data. The caller must
+ *            advance tcb->rcv_nxt accordingly.
+ */
+size_t _gnrc_tcp_rcvbuf_merge_ooo(gnrc_tcp_tcb_t *tcb);
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,6 +29,7 @@
 #include "net/gnrc/udp.h"
 #include "net/gnrc.h"
 #include "net/gnrc/icmpv6/error.h"
+#include "net/gnrc/trace.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG 0
@@ -152,6 +153,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
     port = (uint32_t)byteorder_ntohs(hdr->dst_port);
 
     /* send payload to receivers */
+    gnrc_trace(GNRC_TRACE_LAYER_UDP, GNRC_TRACE_EVENT_DEMUX, pkt);
     if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UDP, port, pkt)) {
         DEBUG("udp: unable to forward packet as no one is interested in it\n");
         /* TODO determine if IPv6 packet, when IPv4 is implemented */
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup posix_poll     POSIX poll
+ * @ingroup  posix
+ * @brief   Poll implementation for RIOT
+ *
+ * Works on all file descriptors of the @ref sys_vfs "VFS", including
+ * [sockets](@ref posix_sockets). Files that can't block, like regular files,
+ * are always ready for reading and writing.
+ *
+ * Instead of checking all file descriptors again on every wakeup, `poll()`
+ * registers a waiter with each of them that is notified by the file when it
+ * becomes ready. For large and mostly idle sets of file descriptors, use the
+ * interest list of @ref posix_epoll, which only visits ready ones.
+ *
+ * @see     [The Open Group Base Specification Issue 7]
+ *          (https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/)
+ * @{
+ *
+ * @file
+ * @brief   Poll types
+ * @see     [The Open Group Base Specification Issue 7, 2018 edition,
+ *          <poll.h>](https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/basedefs/poll.h.html)
+ */
+
+#ifndef POLL_H
+#define POLL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   @ref core_thread_flags for POSIX poll
+ *
+ * Same as POSIX_SELECT_THREAD_FLAG, since `select()` is based on `poll()`
+ */
+#define POSIX_POLL_THREAD_FLAG      (1U << 3)
+
+/**
+ * @name    Events
+ *
+ * Have the same values as the respective VFS_POLL* events of
+ * @ref vfs_poll().
+ * @{
+ */
+#define POLLIN      (0x0001)    /**< Data other than high-priority data may
+                                 *   be read without blocking */
+#define POLLPRI     (0x0002)    /**< High-priority data may be read without
+                                 *   blocking, never reported */
+#define POLLOUT     (0x0004)    /**< Normal data may be written without
+                                 *   blocking */
+#define POLLERR     (0x0008)    /**< An error has occurred, only valid in
+                                 *   `revents` */
+#define POLLHUP     (0x0010)    /**< Device has been disconnected, only valid
+                                 *   in `revents` */
+#define POLLNVAL    (0x0020)    /**< Invalid `fd` member, only valid in
+                                 *   `revents` */
+#define POLLRDNORM  POLLIN      /**< Normal data may be read without
+                                 *   blocking */
+#define POLLWRNORM  POLLOUT     /**< Equivalent to POLLOUT */
+/** @} */
+
+/**
+ * @brief   Type used for the number of file descriptors
+ */
+typedef unsigned int nfds_t;
+
+/**
+ * @brief   File descriptor to be polled
+ */
+struct pollfd {
+    int fd;                     /**< The file descriptor being polled, ignored
+                                 *   if negative */
+    short events;               /**< The input event flags */
+    short revents;              /**< The output event flags */
+};
+
+/**
+ * @brief   Waits for file descriptors to become ready
+ *
+ * @param[in,out] fds   The file descriptors to examine, `revents` is set on
+ *                      output to the events that are ready.
+ * @param[in] nfds      Number of elements in @p fds. Must not be larger than
+ *                      @ref VFS_MAX_OPEN_FILES.
+ * @param[in] timeout   Timeout in milliseconds. 0 to return immediately, -1
+ *                      to block indefinitely.
+ *
+ * @return  number of elements in @p fds with a non-zero `revents` on success.
+ * @return  0, if the timeout expired.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int poll(struct pollfd fds[], nfds_t nfds, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POLL_H */
+/** @} */
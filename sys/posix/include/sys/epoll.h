@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup posix_epoll    Epoll-like interest list
+ * @ingroup  posix
+ * @brief   Interest list API modeled after Linux' epoll for RIOT
+ *
+ * An epoll instance keeps a waiter registered with every file descriptor of
+ * its interest list. A file descriptor becoming ready puts its entry on the
+ * ready list of the instance, and `epoll_wait()` only visits the entries on
+ * that list. The cost of a wakeup thus only depends on the number of ready
+ * file descriptors, not on the number of watched ones.
+ *
+ * Only level-triggered operation is supported and only one thread may wait
+ * on an epoll instance at a time. Like on Linux, a file descriptor is removed
+ * from all interest lists when it is closed.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Epoll types
+ */
+
+#ifndef SYS_EPOLL_H
+#define SYS_EPOLL_H
+
+#include <stdint.h>
+
+#include <poll.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup  config_posix
+ * @{
+ */
+/**
+ * @brief   Maximum number of epoll instances
+ */
+#ifndef CONFIG_POSIX_EPOLL_NUMOF
+#define CONFIG_POSIX_EPOLL_NUMOF    (1U)
+#endif
+
+/**
+ * @brief   Maximum number of file descriptors in the interest list of an
+ *          epoll instance
+ */
+#ifndef CONFIG_POSIX_EPOLL_MAX_FDS
+#define CONFIG_POSIX_EPOLL_MAX_FDS  (8U)
+#endif
+/** @} */
+
+/**
+ * @name    Events
+ * @{
+ */
+#define EPOLLIN     POLLIN      /**< Ready for reading */
+#define EPOLLOUT    POLLOUT     /**< Ready for writing */
+#define EPOLLERR    POLLERR     /**< An error has occurred, always reported */
+#define EPOLLHUP    POLLHUP     /**< Peer hung up, always reported */
+/** @} */
+
+/**
+ * @name    Operations for epoll_ctl()
+ * @{
+ */
+#define EPOLL_CTL_ADD   (1)     /**< Add a file descriptor */
+#define EPOLL_CTL_DEL   (2)     /**< Remove a file descriptor */
+#define EPOLL_CTL_MOD   (3)     /**< Change the events of a file descriptor */
+/** @} */
+
+/**
+ * @brief   User data of an event
+ */
+typedef union epoll_data {
+    void *ptr;                  /**< pointer */
+    int fd;                     /**< file descriptor */
+    uint32_t u32;               /**< 32-bit integer */
+    uint64_t u64;               /**< 64-bit integer */
+} epoll_data_t;
+
+/**
+ * @brief   Event of a file descriptor
+ */
+struct epoll_event {
+    uint32_t events;            /**< EPOLL* events */
+    epoll_data_t data;          /**< user data */
+};
+
+/**
+ * @brief   Creates an epoll instance
+ *
+ * @param[in] flags     Must be 0.
+ *
+ * @return  file descriptor of the new instance on success.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int epoll_create1(int flags);
+
+/**
+ * @brief   Creates an epoll instance
+ *
+ * @param[in] size      Ignored, but must be greater than zero.
+ *
+ * @return  file descriptor of the new instance on success.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int epoll_create(int size);
+
+/**
+ * @brief   Changes the interest list of an epoll instance
+ *
+ * @param[in] epfd      File descriptor of the epoll instance.
+ * @param[in] op        EPOLL_CTL_ADD, EPOLL_CTL_MOD or EPOLL_CTL_DEL.
+ * @param[in] fd        The file descriptor to add, change or remove.
+ * @param[in] event     Events of interest and user data for @p fd. Ignored
+ *                      for EPOLL_CTL_DEL.
+ *
+ * @return  0 on success.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event);
+
+/**
+ * @brief   Waits for file descriptors in the interest list to become ready
+ *
+ * @param[in] epfd      File descriptor of the epoll instance.
+ * @param[out] events   The ready file descriptors.
+ * @param[in] maxevents Maximum number of elements in @p events.
+ * @param[in] timeout   Timeout in milliseconds. 0 to return immediately, -1
+ *                      to block indefinitely.
+ *
+ * @return  number of elements in @p events on success.
+ * @return  0, if the timeout expired.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+               int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYS_EPOLL_H */
+/** @} */
@@ -12,12 +12,14 @@
  * @brief   Select implementation for RIOT
  * @see     [The Open Group Base Specification Issue 7]
  *          (https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/)
+ *
+ * Based on @ref posix_poll, so it works on all file descriptors of the
+ * @ref sys_vfs "VFS", including [sockets](@ref posix_sockets).
+ *
  * @todo    Omitted from original specification for now:
  *          - Inclusion of `<signal.h>`; no POSIX signal handling implemented
  *            in RIOT yet
  *          - `pselect()` as it uses `sigset_t` from `<signal.h>`
- *          - handling of the `writefds` and `errorfds` parameters of `select()`
- * @todo    Currently, only [sockets](@ref posix_sockets) are supported
  * @{
  *
  * @file
@@ -62,6 +64,8 @@ extern "C" {
 
 /**
  * @brief   @ref core_thread_flags for POSIX select
+ *
+ * Same as POSIX_POLL_THREAD_FLAG
  */
 #define POSIX_SELECT_THREAD_FLAG    (1U << 3)
 
@@ -146,20 +150,17 @@ static inline void FD_ZERO(fd_set *fdsetp)
  *                          ready to write. Indicates on output which file
  *                          descriptors are ready to write. May be NULL to check
  *                          no file descriptors.
- *                          **As only sockets are supported for now, these will
- *                          be ignored**
  * @param[in,out] errorfds  The set of file descriptors to be checked for being
  *                          error conditions pending. Indicates on output which
  *                          file descriptors have error conditions pending. May
  *                          be NULL to check no file descriptors.
- *                          **As only sockets are supported for now, these will
- *                          be ignored**
  * @param[in] timeout       Timeout for select to block until one or more of the
  *                          checked file descriptors is ready. Set timeout
  *                          to all-zero to return immediately without blocking.
  *                          May be NULL to block indefinitely.
  *
  * @return  number of members added to the file descriptor sets on success.
+ * @return  0, if the timeout expired.
  * @return  -1 on error, `errno` is set to indicate the error.
  */
 int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds,
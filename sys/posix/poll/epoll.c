@@ -0,0 +1,395 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ * @file
+ * @brief   Epoll-like interest list on top of the readiness notification of
+ *          VFS
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/epoll.h>
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_POSIX_EPOLL)
+#include "irq.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "vfs.h"
+#include "ztimer.h"
+
+typedef struct epoll epoll_t;
+
+typedef struct epoll_entry {
+    vfs_poll_waiter_t super;
+    struct epoll_entry *next_ready; /* next entry on the ready list */
+    epoll_t *ep;
+    epoll_data_t data;
+    int fd;                         /* -1 if unused */
+    unsigned ready;                 /* events notified since last visit */
+    bool queued;                    /* on the ready list */
+} epoll_entry_t;
+
+struct epoll {
+    epoll_entry_t entries[CONFIG_POSIX_EPOLL_MAX_FDS];
+    epoll_entry_t *ready_head;
+    epoll_entry_t *ready_tail;
+    thread_t *waiting;              /* thread in epoll_wait() */
+    mutex_t lock;
+    int fd;
+    bool used;
+};
+
+static epoll_t _epolls[CONFIG_POSIX_EPOLL_NUMOF];
+static mutex_t _epolls_lock = MUTEX_INIT;
+
+/* must be called with interrupts disabled */
+static void _enqueue(epoll_t *ep, epoll_entry_t *e)
+{
+    if (e->queued) {
+        return;
+    }
+    e->queued = true;
+    e->next_ready = NULL;
+    if (ep->ready_tail == NULL) {
+        ep->ready_head = e;
+    }
+    else {
+        ep->ready_tail->next_ready = e;
+    }
+    ep->ready_tail = e;
+}
+
+/* must be called with interrupts disabled */
+static void _dequeue(epoll_t *ep, epoll_entry_t *e)
+{
+    epoll_entry_t **prev = &ep->ready_head;
+    epoll_entry_t *last = NULL;
+
+    if (!e->queued) {
+        return;
+    }
+    for (; *prev != NULL; last = *prev, prev = &(*prev)->next_ready) {
+        if (*prev == e) {
+            *prev = e->next_ready;
+            if (ep->ready_tail == e) {
+                ep->ready_tail = last;
+            }
+            break;
+        }
+    }
+    e->queued = false;
+}
+
+static void _notify(vfs_poll_waiter_t *waiter, unsigned events)
+{
+    epoll_entry_t *e = container_of(waiter, epoll_entry_t, super);
+    epoll_t *ep = e->ep;
+
+    e->ready |= events;
+    _enqueue(ep, e);
+    if (ep->waiting != NULL) {
+        thread_flags_set(ep->waiting, POSIX_POLL_THREAD_FLAG);
+    }
+}
+
+static void _entry_free(epoll_t *ep, epoll_entry_t *e)
+{
+    unsigned state;
+
+    vfs_poll_del(e->fd, &e->super);
+    state = irq_disable();
+    _dequeue(ep, e);
+    irq_restore(state);
+    e->fd = -1;
+}
+
+static int _epoll_close(vfs_file_t *filp)
+{
+    epoll_t *ep = filp->private_data.ptr;
+
+    mutex_lock(&ep->lock);
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_MAX_FDS; i++) {
+        if (ep->entries[i].fd >= 0) {
+            _entry_free(ep, &ep->entries[i]);
+        }
+    }
+    mutex_unlock(&ep->lock);
+    mutex_lock(&_epolls_lock);
+    ep->used = false;
+    mutex_unlock(&_epolls_lock);
+    return 0;
+}
+
+static const vfs_file_ops_t _epoll_ops = {
+    .close = _epoll_close,
+};
+
+static epoll_t *_get_epoll(int epfd)
+{
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_NUMOF; i++) {
+        epoll_t *ep = &_epolls[i];
+        if (ep->used && (ep->fd == epfd)) {
+            return ep;
+        }
+    }
+    return NULL;
+}
+
+static epoll_entry_t *_find(epoll_t *ep, int fd)
+{
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_MAX_FDS; i++) {
+        if (ep->entries[i].fd == fd) {
+            return &ep->entries[i];
+        }
+    }
+    return NULL;
+}
+
+/* (re-)registers the entry and queues it, if it is ready already */
+static int _entry_watch(epoll_t *ep, epoll_entry_t *e, uint32_t events)
+{
+    unsigned state;
+    int res;
+
+    e->ready = 0;
+    res = vfs_poll(e->fd, events, &e->super);
+    if (res < 0) {
+        return res;
+    }
+    state = irq_disable();
+    if (res) {
+        e->ready |= res;
+        _enqueue(ep, e);
+    }
+    irq_restore(state);
+    return 0;
+}
+
+int epoll_create1(int flags)
+{
+    epoll_t *ep = NULL;
+    int fd;
+
+    if (flags != 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    mutex_lock(&_epolls_lock);
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_NUMOF; i++) {
+        if (!_epolls[i].used) {
+            ep = &_epolls[i];
+            break;
+        }
+    }
+    if (ep == NULL) {
+        mutex_unlock(&_epolls_lock);
+        errno = ENFILE;
+        return -1;
+    }
+    fd = vfs_bind(VFS_ANY_FD, O_RDWR, &_epoll_ops, ep);
+    if (fd < 0) {
+        mutex_unlock(&_epolls_lock);
+        errno = -fd;
+        return -1;
+    }
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_MAX_FDS; i++) {
+        ep->entries[i].fd = -1;
+        ep->entries[i].ep = ep;
+        ep->entries[i].queued = false;
+    }
+    ep->ready_head = NULL;
+    ep->ready_tail = NULL;
+    ep->waiting = NULL;
+    mutex_init(&ep->lock);
+    ep->fd = fd;
+    ep->used = true;
+    mutex_unlock(&_epolls_lock);
+    return fd;
+}
+
+int epoll_create(int size)
+{
+    if (size <= 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    return epoll_create1(0);
+}
+
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event)
+{
+    epoll_t *ep = _get_epoll(epfd);
+    epoll_entry_t *e;
+    int res = 0;
+
+    if (ep == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    if ((fd < 0) || (fd == epfd) ||
+        ((op != EPOLL_CTL_DEL) && (event == NULL))) {
+        errno = EINVAL;
+        return -1;
+    }
+    mutex_lock(&ep->lock);
+    e = _find(ep, fd);
+    switch (op) {
+    case EPOLL_CTL_ADD:
+        if (e != NULL) {
+            res = -EEXIST;
+            break;
+        }
+        if ((e = _find(ep, -1)) == NULL) {
+            res = -ENOSPC;
+            break;
+        }
+        e->fd = fd;
+        e->data = event->data;
+        e->super.notify = _notify;
+        if ((res = _entry_watch(ep, e, event->events)) < 0) {
+            e->fd = -1;
+        }
+        break;
+    case EPOLL_CTL_MOD:
+        if (e == NULL) {
+            res = -ENOENT;
+            break;
+        }
+        _entry_free(ep, e);
+        e->fd = fd;
+        e->data = event->data;
+        if ((res = _entry_watch(ep, e, event->events)) < 0) {
+            e->fd = -1;
+        }
+        break;
+    case EPOLL_CTL_DEL:
+        if (e == NULL) {
+            res = -ENOENT;
+            break;
+        }
+        _entry_free(ep, e);
+        break;
+    default:
+        res = -EINVAL;
+        break;
+    }
+    mutex_unlock(&ep->lock);
+    if (res < 0) {
+        errno = -res;
+        return -1;
+    }
+    return 0;
+}
+
+/* visits the entries on the ready list once and reports those still ready */
+static int _collect(epoll_t *ep, struct epoll_event *events, int maxevents)
+{
+    unsigned state = irq_disable();
+    epoll_entry_t *e = ep->ready_head;
+    int n = 0;
+
+    /* take the whole list, entries still ready are queued again below */
+    ep->ready_head = NULL;
+    ep->ready_tail = NULL;
+    irq_restore(state);
+
+    while (e != NULL) {
+        epoll_entry_t *next = e->next_ready;
+        unsigned ready;
+
+        state = irq_disable();
+        e->queued = false;
+        ready = e->ready;
+        e->ready = 0;
+        irq_restore(state);
+
+        if (ready & VFS_POLLNVAL) {
+            /* the file was closed and dropped its waiters */
+            e->fd = -1;
+        }
+        else {
+            /* level-triggered: check if it is still ready */
+            int res = vfs_poll(e->fd, e->super.events, NULL);
+            if (res < 0) {
+                e->fd = -1;
+            }
+            else if (res) {
+                state = irq_disable();
+                _enqueue(ep, e);
+                irq_restore(state);
+                if (n < maxevents) {
+                    events[n].events = res;
+                    events[n].data = e->data;
+                    n++;
+                }
+            }
+        }
+        e = next;
+    }
+    return n;
+}
+
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+               int timeout)
+{
+    epoll_t *ep = _get_epoll(epfd);
+    int n;
+
+    if (ep == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    if ((events == NULL) || (maxevents <= 0)) {
+        errno = EINVAL;
+        return -1;
+    }
+    mutex_lock(&ep->lock);
+    ep->waiting = thread_get_active();
+    thread_flags_clear(POSIX_POLL_THREAD_FLAG);
+    n = _collect(ep, events, maxevents);
+    if ((n == 0) && (timeout != 0)) {
+        thread_flags_t wait_flags = POSIX_POLL_THREAD_FLAG;
+        ztimer_t timer;
+
+        if (timeout > 0) {
+            thread_flags_clear(THREAD_FLAG_TIMEOUT);
+            ztimer_set_timeout_flag(ZTIMER_MSEC, &timer, timeout);
+            wait_flags |= THREAD_FLAG_TIMEOUT;
+        }
+        while (n == 0) {
+            thread_flags_t flags;
+
+            mutex_unlock(&ep->lock);
+            flags = thread_flags_wait_any(wait_flags);
+            mutex_lock(&ep->lock);
+            n = _collect(ep, events, maxevents);
+            if (flags & THREAD_FLAG_TIMEOUT) {
+                break;
+            }
+        }
+        if (timeout > 0) {
+            ztimer_remove(ZTIMER_MSEC, &timer);
+            thread_flags_clear(THREAD_FLAG_TIMEOUT);
+        }
+    }
+    ep->waiting = NULL;
+    mutex_unlock(&ep->lock);
+    return n;
+}
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_POSIX_EPOLL */
+
+/** @} */
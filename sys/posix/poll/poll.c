@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ * @file
+ * @brief   Poll implementation on top of the readiness notification of VFS
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <poll.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "vfs.h"
+#include "ztimer.h"
+
+/* block until a file descriptor is ready */
+#define POSIX_POLL_FOREVER  UINT32_MAX
+
+static_assert((POLLIN == VFS_POLLIN) && (POLLOUT == VFS_POLLOUT) &&
+              (POLLERR == VFS_POLLERR) && (POLLHUP == VFS_POLLHUP) &&
+              (POLLNVAL == VFS_POLLNVAL), "POLL* and VFS_POLL* must match");
+
+typedef struct {
+    vfs_poll_waiter_t super;
+    thread_t *thread;
+    volatile unsigned ready;
+} _waiter_t;
+
+static void _notify(vfs_poll_waiter_t *waiter, unsigned events)
+{
+    _waiter_t *w = container_of(waiter, _waiter_t, super);
+
+    w->ready |= events;
+    thread_flags_set(w->thread, POSIX_POLL_THREAD_FLAG);
+}
+
+static bool _notified(const _waiter_t *waiters, nfds_t nfds)
+{
+    for (nfds_t i = 0; i < nfds; i++) {
+        if ((waiters[i].super.notify != NULL) && waiters[i].ready) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int posix_poll_ztimer(struct pollfd fds[], nfds_t nfds, ztimer_clock_t *clock,
+                      uint32_t timeout)
+{
+    _waiter_t waiters[VFS_MAX_OPEN_FILES];
+    int ready = 0;
+
+    if (nfds > VFS_MAX_OPEN_FILES) {
+        errno = EINVAL;
+        return -1;
+    }
+    thread_flags_clear(POSIX_POLL_THREAD_FLAG);
+    for (nfds_t i = 0; i < nfds; i++) {
+        _waiter_t *w = &waiters[i];
+        /* only wait for the file descriptor as long as we are going to
+         * block */
+        bool wait = (ready == 0) && (timeout != 0);
+        int res;
+
+        w->super.notify = NULL;
+        fds[i].revents = 0;
+        if (fds[i].fd < 0) {
+            continue;
+        }
+        if (wait) {
+            w->super.notify = _notify;
+            w->thread = thread_get_active();
+            w->ready = 0;
+        }
+        res = vfs_poll(fds[i].fd, (unsigned short)fds[i].events,
+                       wait ? &w->super : NULL);
+        if (res < 0) {
+            w->super.notify = NULL;
+            res = POLLNVAL;
+        }
+        if (res) {
+            fds[i].revents = res;
+            ready++;
+        }
+    }
+    if ((ready == 0) && (timeout != 0)) {
+        thread_flags_t wait_flags = POSIX_POLL_THREAD_FLAG;
+        bool expired = false;
+        ztimer_t timer;
+
+        if (timeout != POSIX_POLL_FOREVER) {
+            thread_flags_clear(THREAD_FLAG_TIMEOUT);
+            ztimer_set_timeout_flag(clock, &timer, timeout);
+            wait_flags |= THREAD_FLAG_TIMEOUT;
+        }
+        /* a wakeup may be spurious, e.g. a notification without events */
+        while (!expired && !_notified(waiters, nfds)) {
+            expired = thread_flags_wait_any(wait_flags) & THREAD_FLAG_TIMEOUT;
+        }
+        if (timeout != POSIX_POLL_FOREVER) {
+            ztimer_remove(clock, &timer);
+            /* the timer may have fired after a notification woke us up */
+            thread_flags_clear(THREAD_FLAG_TIMEOUT);
+        }
+    }
+    /* only the file descriptors that notified us changed */
+    for (nfds_t i = 0; i < nfds; i++) {
+        _waiter_t *w = &waiters[i];
+
+        if (w->super.notify == NULL) {
+            continue;
+        }
+        vfs_poll_del(fds[i].fd, &w->super);
+        if (w->ready) {
+            if (fds[i].revents == 0) {
+                ready++;
+            }
+            fds[i].revents |= w->ready;
+        }
+    }
+    return ready;
+}
+
+int poll(struct pollfd fds[], nfds_t nfds, int timeout)
+{
+    return posix_poll_ztimer(fds, nfds, ZTIMER_MSEC,
+                             (timeout < 0) ? POSIX_POLL_FOREVER
+                                           : (uint32_t)timeout);
+}
+
+/** @} */
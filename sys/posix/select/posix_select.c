@@ -13,131 +13,104 @@
  */
 
 #include <errno.h>
+#include <poll.h>
 #include <stdbool.h>
 #include <sys/select.h>
 
-#include "thread_flags.h"
+#include "timex.h"
 #include "vfs.h"
-#include "xtimer.h"
+#include "ztimer.h"
 
-#if IS_USED(MODULE_POSIX_SOCKETS)
-extern bool posix_socket_is(int fd);
-extern unsigned posix_socket_avail(int fd);
-extern void posix_socket_select(int fd);
-#else   /* MODULE_POSIX_SOCKETS */
-static inline bool posix_socket_is(int fd)
-{
-    (void)fd;
-    return false;
-}
-
-static inline unsigned posix_socket_avail(int fd)
-{
-    (void)fd;
-    return 0;
-}
+extern int posix_poll_ztimer(struct pollfd fds[], nfds_t nfds,
+                             ztimer_clock_t *clock, uint32_t timeout);
 
-static inline void posix_socket_select(int fd)
+static inline bool _isset(int fd, fd_set *fdsetp)
 {
-    (void)fd;
-    return 0;
-}
-#endif  /* IS_USED(MODULE_POSIX_SOCKETS) */
-
-static int _set_timeout(xtimer_t *timeout_timer, struct timeval *timeout,
-                        uint32_t offset, bool *wait)
-{
-    if (timeout != NULL) {
-        uint64_t t = ((uint64_t)(timeout->tv_sec * US_PER_SEC) +
-                      timeout->tv_usec);
-        /* check for potential underflow before subtracting offset */
-        if ((t == 0) || (offset > t)) {
-            *wait = false;
-            return 0;
-        }
-        t -= offset;
-        if (t > UINT32_MAX) {
-            errno = EINVAL;
-            /* don't have timer set yet so go to end */
-            return -1;
-        }
-        else {
-            xtimer_set_timeout_flag(timeout_timer, (uint32_t)t);
-        }
-    }
-    return 0;
+    return (fdsetp != NULL) && FD_ISSET(fd, fdsetp);
 }
 
 int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds,
            struct timeval *timeout)
 {
-    uint32_t start_time = xtimer_now_usec();
-    fd_set ret_readfds;
-    xtimer_t timeout_timer;
+    struct pollfd fds[FD_SETSIZE];
+    fd_set ret_readfds, ret_writefds, ret_errorfds;
+    ztimer_clock_t *clock = ZTIMER_USEC;
+    uint32_t t = UINT32_MAX;    /* block indefinitely */
+    nfds_t numof = 0;
     int fds_set = 0;
-    bool wait = true;
 
-    FD_ZERO(&ret_readfds);
-    /* TODO ignored writefds and errorfds for now since there is no point for
-     * them with sockets */
-    if ((nfds >= FD_SETSIZE) || ((unsigned)nfds >= VFS_MAX_OPEN_FILES)) {
+    if ((nfds < 0) || (nfds > FD_SETSIZE) ||
+        ((unsigned)nfds > VFS_MAX_OPEN_FILES)) {
         errno = EINVAL;
         return -1;
     }
-    for (int i = 0; i < nfds; i++) {
-        if ((readfds != NULL) && FD_ISSET(i, readfds)) {
-            if (!posix_socket_is(i)) {
-                errno = EBADF;
-                return -1;
-            }
-            if (posix_socket_avail(i) > 0) {
-                FD_SET(i, &ret_readfds);
-                fds_set++;
-                wait = false;
-            }
-            else {
-                posix_socket_select(i);
-            }
+    if (timeout != NULL) {
+        uint64_t usec = ((uint64_t)timeout->tv_sec * US_PER_SEC) +
+                        timeout->tv_usec;
+
+        if (usec < UINT32_MAX) {
+            t = usec;
         }
-        if ((writefds != NULL) && FD_ISSET(i, writefds) &&
-            !posix_socket_is(i)) {
-            errno = EBADF;
-            return -1;
+        else if ((usec / US_PER_MS) < UINT32_MAX) {
+            clock = ZTIMER_MSEC;
+            t = (usec + US_PER_MS - 1) / US_PER_MS;
         }
-        if ((errorfds != NULL) && FD_ISSET(i, errorfds) &&
-            !posix_socket_is(i)) {
-            errno = EBADF;
+        else {
+            errno = EINVAL;
             return -1;
         }
     }
-    while (wait) {
-        if (_set_timeout(&timeout_timer, timeout,
-                         xtimer_now_usec() - start_time, &wait) < 0) {
-            return -1;
+    for (int i = 0; i < nfds; i++) {
+        short events = 0;
+
+        if (_isset(i, readfds)) {
+            events |= POLLIN;
         }
-        if (!wait) {
-            errno = EINTR;
-            return -1;
+        if (_isset(i, writefds)) {
+            events |= POLLOUT;
         }
-        thread_flags_t tflags = thread_flags_wait_any(POSIX_SELECT_THREAD_FLAG |
-                                                      THREAD_FLAG_TIMEOUT);
-        if (tflags & POSIX_SELECT_THREAD_FLAG) {
-            for (int i = 0; i < nfds; i++) {
-                if (FD_ISSET(i, readfds)) {
-                    if (posix_socket_avail(i) > 0) {
-                        FD_SET(i, &ret_readfds);
-                        fds_set++;
-                        wait = false;
-                    }
-                }
-            }
+        if ((events != 0) || _isset(i, errorfds)) {
+            fds[numof].fd = i;
+            fds[numof].events = events;
+            numof++;
         }
-        else if (tflags & THREAD_FLAG_TIMEOUT) {
-            errno = EINTR;
+    }
+    if (posix_poll_ztimer(fds, numof, clock, t) < 0) {
+        return -1;
+    }
+    FD_ZERO(&ret_readfds);
+    FD_ZERO(&ret_writefds);
+    FD_ZERO(&ret_errorfds);
+    for (nfds_t i = 0; i < numof; i++) {
+        int fd = fds[i].fd;
+        short revents = fds[i].revents;
+
+        if (revents & POLLNVAL) {
+            errno = EBADF;
             return -1;
         }
-        xtimer_remove(&timeout_timer);
+        if ((fds[i].events & POLLIN) &&
+            (revents & (POLLIN | POLLHUP | POLLERR))) {
+            FD_SET(fd, &ret_readfds);
+            fds_set++;
+        }
+        if ((fds[i].events & POLLOUT) && (revents & (POLLOUT | POLLERR))) {
+            FD_SET(fd, &ret_writefds);
+            fds_set++;
+        }
+        if (_isset(fd, errorfds) && (revents & POLLERR)) {
+            FD_SET(fd, &ret_errorfds);
+            fds_set++;
+        }
+    }
+    if (readfds != NULL) {
+        *readfds = ret_readfds;
+    }
+    if (writefds != NULL) {
+        *writefds = ret_writefds;
+    }
+    if (errorfds != NULL) {
+        *errorfds = ret_errorfds;
     }
-    *readfds = ret_readfds;
     return fds_set;
 }
@@ -41,12 +41,6 @@
 #if IS_USED(MODULE_SOCK_ASYNC)
 #include "net/sock/async.h"
 #endif
-#if IS_USED(MODULE_POSIX_SELECT)
-#include <sys/select.h>
-
-#include "thread.h"
-#include "thread_flags.h"
-#endif
 
 /* enough to create sockets both with socket() and accept() */
 #define _ACTUAL_SOCKET_POOL_SIZE   (SOCKET_POOL_SIZE + \
@@ -92,9 +86,8 @@ typedef struct {
 #endif
 #if IS_USED(MODULE_SOCK_ASYNC)
     atomic_uint available;
-#endif
-#if IS_USED(MODULE_POSIX_SELECT)
-    thread_t *selecting_thread;
+    vfs_poll_waiter_t *waiters;
+    bool hup;
 #endif
     sock_tcp_ep_t local;        /* to store bind before connect/listen */
 } socket_t;
@@ -117,6 +110,8 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
 static ssize_t socket_sendto(socket_t *s, const void *buffer, size_t length,
                              int flags, const struct sockaddr *address,
                              socklen_t address_len);
+static int _bind_connect(socket_t *s, const struct sockaddr *address,
+                         socklen_t address_len);
 
 static socket_t *_get_free_socket(void)
 {
@@ -124,9 +119,8 @@ static socket_t *_get_free_socket(void)
         if (_socket_pool[i].domain == AF_UNSPEC) {
 #if IS_USED(MODULE_SOCK_ASYNC)
             atomic_init(&_socket_pool[i].available, 0U);
-#endif
-#if IS_USED(MODULE_POSIX_SELECT)
-            _socket_pool[i].selecting_thread = NULL;
+            _socket_pool[i].waiters = NULL;
+            _socket_pool[i].hup = false;
 #endif
             return &_socket_pool[i];
         }
@@ -320,6 +314,9 @@ static int socket_close(vfs_file_t *filp)
         }
     }
     mutex_unlock(&_socket_pool_mutex);
+#if IS_USED(MODULE_SOCK_ASYNC)
+    vfs_poll_waiters_notify(&s->waiters, VFS_POLLNVAL);
+#endif
     s->sock = NULL;
     s->domain = AF_UNSPEC;
     return res;
@@ -352,6 +349,73 @@ static inline ssize_t socket_write(vfs_file_t *filp, const void *buf, size_t n)
     return socket_sendto(filp->private_data.ptr, buf, n, 0, NULL, 0);
 }
 
+#if IS_USED(MODULE_SOCK_ASYNC)
+static unsigned _socket_ready(socket_t *s)
+{
+    unsigned events = 0;
+
+    if (atomic_load(&s->available) > 0) {
+        events |= VFS_POLLIN;
+    }
+    if (s->hup) {
+        /* reading returns the end of the stream without blocking */
+        events |= VFS_POLLIN | VFS_POLLHUP;
+    }
+    switch (s->type) {
+#ifdef MODULE_SOCK_TCP
+        case SOCK_STREAM:
+            /* only connected sockets can be written to */
+            if ((s->sock != NULL) && (s->queue_array == NULL) && !s->hup) {
+                events |= VFS_POLLOUT;
+            }
+            break;
+#endif
+        default:
+            /* sending datagrams never blocks */
+            events |= VFS_POLLOUT;
+            break;
+    }
+    return events;
+}
+
+static unsigned socket_poll(vfs_file_t *filp, vfs_poll_waiter_t *waiter)
+{
+    socket_t *s = filp->private_data.ptr;
+
+    if ((s->sock == NULL) && (s->type != SOCK_STREAM)) {
+        /* bind implicitly, so the socket can receive */
+        if (_bind_connect(s, NULL, 0) < 0) {
+            return VFS_POLLERR;
+        }
+    }
+    if (waiter != NULL) {
+        vfs_poll_waiters_add(&s->waiters, waiter);
+    }
+    return _socket_ready(s);
+}
+
+static void socket_poll_del(vfs_file_t *filp, vfs_poll_waiter_t *waiter)
+{
+    socket_t *s = filp->private_data.ptr;
+
+    vfs_poll_waiters_del(&s->waiters, waiter);
+}
+
+/* a successful read or accept consumed (at least) one message */
+static void _socket_consumed(socket_t *s, bool drained)
+{
+    unsigned available = atomic_load(&s->available);
+
+    if (drained) {
+        atomic_store(&s->available, 0U);
+        return;
+    }
+    while ((available > 0) &&
+           !atomic_compare_exchange_weak(&s->available, &available,
+                                         available - 1)) {}
+}
+#endif
+
 static const vfs_file_ops_t socket_ops = {
     .close = socket_close,
     .fcntl = NULL,          /* TODO: provide when needed */
@@ -359,6 +423,10 @@ static const vfs_file_ops_t socket_ops = {
     .lseek = socket_lseek,
     .read = socket_read,
     .write = socket_write,
+#if IS_USED(MODULE_SOCK_ASYNC)
+    .poll = socket_poll,
+    .poll_del = socket_poll_del,
+#endif
 };
 
 #if IS_USED(MODULE_SOCK_ASYNC)
@@ -367,15 +435,22 @@ static void _async_cb(void *sock, sock_async_flags_t type,
 {
     socket_t *socket = arg;
 
+    unsigned events = 0;
+
     (void)sock;
-    if (type & SOCK_ASYNC_MSG_RECV) {
+    if (type & (SOCK_ASYNC_MSG_RECV | SOCK_ASYNC_CONN_RECV)) {
         atomic_fetch_add(&socket->available, 1);
-#if IS_USED(MODULE_POSIX_SELECT)
-        if (socket->selecting_thread) {
-            thread_flags_set(socket->selecting_thread,
-                             POSIX_SELECT_THREAD_FLAG);
-        }
-#endif
+        events |= VFS_POLLIN;
+    }
+    if (type & SOCK_ASYNC_CONN_FIN) {
+        socket->hup = true;
+        events |= VFS_POLLIN | VFS_POLLHUP;
+    }
+    if (type & SOCK_ASYNC_MSG_SENT) {
+        events |= VFS_POLLOUT;
+    }
+    if (events) {
+        vfs_poll_waiters_notify(&socket->waiters, events);
     }
 }
 
@@ -526,6 +601,9 @@ int accept(int socket, struct sockaddr *restrict address,
                 break;
             }
             else {
+#if IS_USED(MODULE_SOCK_ASYNC)
+                _socket_consumed(s, false);
+#endif
                 if ((address != NULL) && (address_len != NULL)) {
                     sock_tcp_ep_t ep;
                     struct sockaddr_storage sa;
@@ -973,10 +1051,14 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
             res = -EOPNOTSUPP;
             break;
     }
-    if ((res >= 0) && (address != NULL) && (address_len != NULL)) {
-#ifdef MODULE_SOCK_ASYNC
-        atomic_fetch_sub(&s->available, 1);
+#if IS_USED(MODULE_SOCK_ASYNC)
+    if (res >= 0) {
+        /* a short read drains a stream */
+        _socket_consumed(s, (s->type == SOCK_STREAM) &&
+                            ((size_t)res < length));
+    }
 #endif
+    if ((res >= 0) && (address != NULL) && (address_len != NULL)) {
         switch (s->type) {
 #ifdef MODULE_SOCK_TCP
             case SOCK_STREAM:
@@ -1165,47 +1247,6 @@ int setsockopt(int socket, int level, int option_name, const void *option_value,
 #endif
 }
 
-bool posix_socket_is(int fd)
-{
-    return IS_USED(MODULE_SOCK_ASYNC) && (_get_socket(fd) != NULL);
-}
-
-unsigned posix_socket_avail(int fd)
-{
-#if IS_USED(MODULE_SOCK_ASYNC)
-    socket_t *socket = _get_socket(fd);
-
-    return (socket != NULL) ? atomic_load(&socket->available) : 0U;
-#else
-    (void)fd;
-    return 0U;
-#endif
-}
-
-int posix_socket_select(int fd)
-{
-#if IS_USED(MODULE_POSIX_SELECT)
-    socket_t *socket = _get_socket(fd);
-
-    if (socket != NULL) {
-        if (socket->sock == NULL) {  /* socket is not connected */
-            int res;
-
-            /* bind implicitly */
-            if ((res = _bind_connect(socket, NULL, 0)) < 0) {
-                return res;
-            }
-        }
-        socket->selecting_thread = thread_get_active();
-        return 0;
-    }
-#else
-    (void)fd;
-#endif
-    errno = ENOTSUP;
-    return -1;
-}
-
 /**
  * @}
  */
@@ -65,6 +65,9 @@ int riotboot_flashwrite_init_raw(riotboot_flashwrite_t *state, int target_slot,
     state->target_slot = target_slot;
     state->flashpage =
         flashpage_page((void *)riotboot_slot_get_hdr(target_slot));
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+    sha256_init(&state->sha256);
+#endif
 
     if (CONFIG_RIOTBOOT_FLASHWRITE_RAW && offset) {
         /* Erase the first page only if the offset (!=0) specifies that there is
@@ -110,6 +113,12 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
     LOG_DEBUG(LOG_PREFIX "processing bytes %u-%u\n", state->offset,
               state->offset + len - 1);
 
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+    /* hash while the data is still in cache instead of reading the slot back
+     * for verification */
+    sha256_update(&state->sha256, bytes, len);
+#endif
+
     while (len) {
         /* Position within the page, calculated from state->offset by
          * subtracting the start offset of the current page */
@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_riotboot_flashwrite
+ * @{
+ *
+ * @file
+ * @brief       Digest of the image written by riotboot_flashwrite
+ *
+ * @}
+ */
+
+#include "hashes/sha256.h"
+#include "riotboot/flashwrite.h"
+
+void riotboot_flashwrite_sha256(const riotboot_flashwrite_t *state,
+                                uint8_t *digest)
+{
+    /* finalize a copy, the writer keeps hashing */
+    sha256_context_t ctx = state->sha256;
+
+    sha256_final(&ctx, digest);
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command for the event queue statistics
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "event.h"
+
+int _event_stats(int argc, char **argv)
+{
+    if (argc < 2) {
+        event_queue_stats_print();
+    }
+    else if (strcmp(argv[1], "reset") == 0) {
+        event_queue_stats_reset();
+    }
+    else {
+        printf("usage: %s [reset]\n", argv[0]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command for the GNRC packet path trace
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/trace.h"
+
+static void _usage(const char *cmd)
+{
+    printf("usage: %s [dump|clear|on|off]\n", cmd);
+}
+
+int _gnrc_trace(int argc, char **argv)
+{
+    if ((argc < 2) || (strcmp(argv[1], "dump") == 0)) {
+        gnrc_trace_dump();
+    }
+    else if (strcmp(argv[1], "clear") == 0) {
+        gnrc_trace_reset();
+    }
+    else if (strcmp(argv[1], "on") == 0) {
+        gnrc_trace_enable(true);
+    }
+    else if (strcmp(argv[1], "off") == 0) {
+        gnrc_trace_enable(false);
+    }
+    else {
+        _usage(argv[0]);
+        return 1;
+    }
+    return 0;
+}
@@ -19,6 +19,7 @@
  */
 
 #include "cpu_conf.h"
+#include "kernel_defines.h"
 
 #if defined(MODULE_NEWLIB_SYSCALLS_DEFAULT) || defined (HAVE_HEAP_STATS)
 extern void heap_stats(void);
@@ -26,6 +27,10 @@ extern void heap_stats(void);
 #include <stdio.h>
 #endif
 
+#if IS_USED(MODULE_MALLOC_TCACHE)
+#include "malloc_tcache.h"
+#endif
+
 int _heap_handler(int argc, char **argv)
 {
     (void) argc;
@@ -33,6 +38,12 @@ int _heap_handler(int argc, char **argv)
 
 #if defined(MODULE_NEWLIB_SYSCALLS_DEFAULT) || defined (HAVE_HEAP_STATS)
     heap_stats();
+#if IS_USED(MODULE_MALLOC_TCACHE)
+    malloc_tcache_print_stats();
+#endif
+    return 0;
+#elif IS_USED(MODULE_MALLOC_TCACHE)
+    malloc_tcache_print_stats();
     return 0;
 #else
     printf("heap statistics are not supported for %s cpu\n", RIOT_CPU);
@@ -147,6 +147,10 @@ extern int _gnrc_6ctx(int argc, char **argv);
 extern int _gnrc_6lo_frag_stats(int argc, char **argv);
 #endif
 
+#ifdef MODULE_GNRC_TRACE
+extern int _gnrc_trace(int argc, char **argv);
+#endif
+
 #ifdef MODULE_CCN_LITE_UTILS
 extern int _ccnl_open(int argc, char **argv);
 extern int _ccnl_content(int argc, char **argv);
@@ -207,6 +211,10 @@ extern int _cryptoauth(int argc, char **argv);
 extern int _bootloader_handler(int argc, char **argv);
 #endif
 
+#ifdef MODULE_EVENT_STATS
+extern int _event_stats(int argc, char **argv);
+#endif
+
 const shell_command_t _shell_command_list[] = {
     {"reboot", "Reboot the node", _reboot_handler},
     {"version", "Prints current RIOT_VERSION", _version_handler},
@@ -303,6 +311,9 @@ const shell_command_t _shell_command_list[] = {
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
     {"6lo_frag", "6LoWPAN fragment statistics", _gnrc_6lo_frag_stats },
 #endif
+#ifdef MODULE_GNRC_TRACE
+    {"gnrc_trace", "dump or control the GNRC packet path trace", _gnrc_trace },
+#endif
 #ifdef MODULE_SAUL_REG
     {"saul", "interact with sensors and actuators using SAUL", _saul },
 #endif
@@ -349,6 +360,9 @@ const shell_command_t _shell_command_list[] = {
 #ifdef MODULE_DFPLAYER
     {"dfplayer", "Control a DFPlayer Mini MP3 player", _sc_dfplayer},
 #endif
+#ifdef MODULE_EVENT_STATS
+    { "event_stats", "print or reset the event queue statistics", _event_stats },
+#endif
 #ifdef MODULE_CONGURE_TEST
     { "cong_clear", "Clears CongURE state object", congure_test_clear_state },
     { "cong_setup", "Calls the setup function for the CongURE state object",
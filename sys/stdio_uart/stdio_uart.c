@@ -28,13 +28,21 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
 
 #include "stdio_uart.h"
 
 #include "board.h"
+#include "irq.h"
 #include "periph/uart.h"
 #include "isrpipe.h"
 
+#ifdef MODULE_STDIO_UART_ASYNC
+#include "mutex.h"
+#include "thread.h"
+#include "tsrb.h"
+#endif
+
 #ifdef MODULE_STDIO_ETHOS
 #include "ethos.h"
 extern ethos_t ethos;
@@ -52,6 +60,133 @@ static uint8_t _rx_buf_mem[STDIO_UART_RX_BUFSIZE];
 isrpipe_t stdio_uart_isrpipe = ISRPIPE_INIT(_rx_buf_mem);
 #endif
 
+#ifdef MODULE_STDIO_UART_ASYNC
+/* bytes the TX thread takes from the buffer at once */
+#define TX_CHUNK    (16U)
+
+static uint8_t _tx_buf_mem[STDIO_UART_TX_BUFSIZE];
+static tsrb_t _tx_rb = TSRB_INIT(_tx_buf_mem);
+/* unlocked when there is data to send, and when there is space */
+static mutex_t _tx_data = MUTEX_INIT_LOCKED;
+static mutex_t _tx_space = MUTEX_INIT_LOCKED;
+static kernel_pid_t _tx_pid = KERNEL_PID_UNDEF;
+static unsigned _tx_dropped;
+static char _tx_stack[STDIO_UART_TX_STACKSIZE];
+#endif
+
+static void _write(const uint8_t *buffer, size_t len)
+{
+#ifdef MODULE_STDIO_ETHOS
+    ethos_send_frame(&ethos, buffer, len, ETHOS_FRAME_TYPE_TEXT);
+#else
+    uart_write(STDIO_UART_DEV, buffer, len);
+#endif
+}
+
+#ifdef MODULE_STDIO_UART_ASYNC
+static void *_tx_thread(void *arg)
+{
+    (void)arg;
+    uint8_t chunk[TX_CHUNK];
+
+    while (1) {
+        int len = tsrb_get(&_tx_rb, chunk, sizeof(chunk));
+
+        if (len == 0) {
+            mutex_lock(&_tx_data);
+            continue;
+        }
+        mutex_unlock(&_tx_space);
+        _write(chunk, len);
+    }
+
+    return NULL;
+}
+
+void stdio_uart_async_init(void)
+{
+    _tx_pid = thread_create(_tx_stack, sizeof(_tx_stack), STDIO_UART_TX_PRIO,
+                            THREAD_CREATE_STACKTEST, _tx_thread, NULL,
+                            "stdio_uart");
+}
+
+static void _tx_drop(unsigned num)
+{
+    unsigned state = irq_disable();
+
+    _tx_dropped += num;
+    irq_restore(state);
+}
+
+static bool _tx_can_block(void)
+{
+    return irq_is_enabled() && !irq_is_in() && (thread_getpid() != _tx_pid);
+}
+
+static void _tx_enqueue(const uint8_t *buffer, size_t len)
+{
+    size_t done;
+
+    if (STDIO_UART_TX_OVERFLOW == STDIO_UART_TX_OVERWRITE) {
+        /* keep the newest bytes */
+        if (len > STDIO_UART_TX_BUFSIZE) {
+            _tx_drop(len - STDIO_UART_TX_BUFSIZE);
+            buffer += len - STDIO_UART_TX_BUFSIZE;
+            len = STDIO_UART_TX_BUFSIZE;
+        }
+
+        unsigned state = irq_disable();
+        unsigned space = tsrb_free(&_tx_rb);
+
+        if (space < len) {
+            tsrb_drop(&_tx_rb, len - space);
+            _tx_dropped += len - space;
+        }
+        done = tsrb_add(&_tx_rb, buffer, len);
+        irq_restore(state);
+    }
+    else {
+        done = tsrb_add(&_tx_rb, buffer, len);
+        if ((STDIO_UART_TX_OVERFLOW == STDIO_UART_TX_BLOCK) &&
+            _tx_can_block()) {
+            while (done < len) {
+                mutex_unlock(&_tx_data);
+                mutex_lock(&_tx_space);
+                done += tsrb_add(&_tx_rb, buffer + done, len - done);
+            }
+        }
+        if (done < len) {
+            _tx_drop(len - done);
+        }
+    }
+    mutex_unlock(&_tx_data);
+}
+#endif
+
+void stdio_uart_flush(void)
+{
+#ifdef MODULE_STDIO_UART_ASYNC
+    uint8_t chunk[TX_CHUNK];
+    int len;
+
+    /* all output from now on is synchronous, a chunk the TX thread is sending
+     * right now may be cut short */
+    _tx_pid = KERNEL_PID_UNDEF;
+    while ((len = tsrb_get(&_tx_rb, chunk, sizeof(chunk))) > 0) {
+        _write(chunk, len);
+    }
+#endif
+}
+
+unsigned stdio_uart_dropped(void)
+{
+#ifdef MODULE_STDIO_UART_ASYNC
+    return _tx_dropped;
+#else
+    return 0;
+#endif
+}
+
 void stdio_init(void)
 {
     uart_rx_cb_t cb;
@@ -89,10 +224,12 @@ ssize_t stdio_read(void* buffer, size_t count)
 
 ssize_t stdio_write(const void* buffer, size_t len)
 {
-#ifdef MODULE_STDIO_ETHOS
-    ethos_send_frame(&ethos, (const uint8_t *)buffer, len, ETHOS_FRAME_TYPE_TEXT);
-#else
-    uart_write(STDIO_UART_DEV, (const uint8_t *)buffer, len);
+#ifdef MODULE_STDIO_UART_ASYNC
+    if (pid_is_valid(_tx_pid)) {
+        _tx_enqueue(buffer, len);
+        return len;
+    }
 #endif
+    _write(buffer, len);
     return len;
 }
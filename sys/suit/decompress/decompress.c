@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_suit_decompress
+ * @{
+ *
+ * @file
+ * @brief       SUIT payload decompression
+ *
+ * @}
+ */
+
+#include "nanocbor/nanocbor.h"
+#include "suit/handlers.h"
+
+#include "suit/decompress.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+int32_t suit_decompress_get_algorithm(const suit_manifest_t *manifest,
+                                      const suit_component_t *comp)
+{
+    nanocbor_value_t param;
+    int32_t algorithm;
+
+    if (suit_param_ref_to_cbor(manifest, &comp->param_compression_info,
+                               &param) == 0) {
+        return SUIT_COMPRESSION_NONE;
+    }
+    if (nanocbor_get_int32(&param, &algorithm) < 0) {
+        /* a map or anything else that can't be decompressed */
+        return INT32_MIN;
+    }
+    return algorithm;
+}
+
+void suit_decompress_init(suit_decompress_t *ctx, suit_payload_cb_t cb,
+                          void *arg)
+{
+    heatshrink_decoder_reset(&ctx->decoder);
+    ctx->cb = cb;
+    ctx->arg = arg;
+    ctx->in = 0;
+    ctx->out = 0;
+    ctx->len = 0;
+}
+
+static int _flush(suit_decompress_t *ctx, int more)
+{
+    int res = ctx->cb(ctx->arg, ctx->out, ctx->buf, ctx->len, more);
+
+    ctx->out += ctx->len;
+    ctx->len = 0;
+    return res;
+}
+
+static int _poll(suit_decompress_t *ctx)
+{
+    HSD_poll_res res;
+
+    do {
+        size_t len;
+
+        res = heatshrink_decoder_poll(&ctx->decoder, ctx->buf + ctx->len,
+                                      sizeof(ctx->buf) - ctx->len, &len);
+        if (res < 0) {
+            DEBUG("suit_decompress: poll failed: %d\n", (int)res);
+            return -1;
+        }
+        ctx->len += len;
+        if ((ctx->len == sizeof(ctx->buf)) && (_flush(ctx, 1) < 0)) {
+            return -1;
+        }
+    } while (res == HSDR_POLL_MORE);
+    return 0;
+}
+
+int suit_decompress_write(void *arg, size_t offset, uint8_t *buf, size_t len,
+                          int more)
+{
+    suit_decompress_t *ctx = arg;
+    HSD_finish_res res;
+
+    if (offset != ctx->in) {
+        DEBUG("suit_decompress: expected offset %u, got %u\n",
+              (unsigned)ctx->in, (unsigned)offset);
+        return -1;
+    }
+    while (len > 0) {
+        size_t sunk;
+
+        if (heatshrink_decoder_sink(&ctx->decoder, buf, len, &sunk) < 0) {
+            return -1;
+        }
+        buf += sunk;
+        len -= sunk;
+        ctx->in += sunk;
+        if (_poll(ctx) < 0) {
+            return -1;
+        }
+    }
+    if (more) {
+        return 0;
+    }
+    while ((res = heatshrink_decoder_finish(&ctx->decoder)) ==
+           HSDR_FINISH_MORE) {
+        if (_poll(ctx) < 0) {
+            return -1;
+        }
+    }
+    if (res < 0) {
+        return -1;
+    }
+    DEBUG("suit_decompress: %u bytes decompressed to %u\n",
+          (unsigned)ctx->in, (unsigned)(ctx->out + ctx->len));
+    return _flush(ctx, 0);
+}
@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_suit_delta
+ * @{
+ *
+ * @file
+ * @brief       SUIT delta payloads
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "kernel_defines.h"
+#include "nanocbor/nanocbor.h"
+#include "suit/handlers.h"
+
+#if IS_USED(MODULE_RIOTBOOT_SLOT)
+#include "riotboot/slot.h"
+#endif
+
+#include "suit/delta.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define MAGIC       "RDIF"
+
+enum {
+    _STATE_HEADER = 0,
+    _STATE_RECORD,
+    _STATE_DIFF,
+    _STATE_EXTRA,
+};
+
+static const uint8_t *_src;
+static size_t _src_len;
+
+int32_t suit_delta_get_unpack_info(const suit_manifest_t *manifest,
+                                   const suit_component_t *comp)
+{
+    nanocbor_value_t param;
+    int32_t info;
+
+    if (suit_param_ref_to_cbor(manifest, &comp->param_unpack_info,
+                               &param) == 0) {
+        return SUIT_UNPACK_NONE;
+    }
+    if (nanocbor_get_int32(&param, &info) < 0) {
+        return INT32_MIN;
+    }
+    return info;
+}
+
+void suit_delta_set_source(const uint8_t *src, size_t len)
+{
+    _src = src;
+    _src_len = len;
+}
+
+int suit_delta_init(suit_delta_t *ctx, suit_payload_cb_t cb, void *arg)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->cb = cb;
+    ctx->arg = arg;
+    ctx->src = _src;
+    ctx->src_len = _src_len;
+#if IS_USED(MODULE_RIOTBOOT_SLOT)
+    if (ctx->src == NULL) {
+        int slot = riotboot_slot_current();
+
+        ctx->src = (const uint8_t *)riotboot_slot_get_hdr(slot);
+        ctx->src_len = riotboot_slot_size(slot);
+    }
+#endif
+    return (ctx->src == NULL) ? -ENOENT : 0;
+}
+
+static int _flush(suit_delta_t *ctx, int more)
+{
+    int res = ctx->cb(ctx->arg, ctx->out, ctx->buf, ctx->len, more);
+
+    ctx->out += ctx->len;
+    ctx->len = 0;
+    return res;
+}
+
+static int _put(suit_delta_t *ctx, uint8_t byte)
+{
+    if (ctx->out + ctx->len >= ctx->img_len) {
+        DEBUG("suit_delta: patch beyond the image\n");
+        return -1;
+    }
+    ctx->buf[ctx->len++] = byte;
+    if (ctx->len == sizeof(ctx->buf)) {
+        return _flush(ctx, 1);
+    }
+    return 0;
+}
+
+/* collects a header, returns the bytes taken from buf */
+static size_t _collect(suit_delta_t *ctx, const uint8_t *buf, size_t len)
+{
+    size_t take = SUIT_DELTA_HDR_LEN - ctx->hdr_len;
+
+    if (take > len) {
+        take = len;
+    }
+    memcpy(&ctx->hdr[ctx->hdr_len], buf, take);
+    ctx->hdr_len += take;
+    return take;
+}
+
+static int _parse_header(suit_delta_t *ctx)
+{
+    size_t src_len = byteorder_lebuftohl(&ctx->hdr[4]);
+
+    if (memcmp(ctx->hdr, MAGIC, 4) != 0) {
+        DEBUG("suit_delta: not a patch\n");
+        return -1;
+    }
+    if (src_len > ctx->src_len) {
+        DEBUG("suit_delta: source of %u bytes needed\n", (unsigned)src_len);
+        return -1;
+    }
+    ctx->src_len = src_len;
+    ctx->img_len = byteorder_lebuftohl(&ctx->hdr[8]);
+    return 0;
+}
+
+static void _parse_record(suit_delta_t *ctx)
+{
+    ctx->diff = byteorder_lebuftohl(&ctx->hdr[0]);
+    ctx->extra = byteorder_lebuftohl(&ctx->hdr[4]);
+    ctx->seek = (int32_t)byteorder_lebuftohl(&ctx->hdr[8]);
+}
+
+/* moves on to the next state that needs input */
+static int _advance(suit_delta_t *ctx)
+{
+    if ((ctx->state == _STATE_DIFF) && (ctx->diff == 0)) {
+        ctx->state = _STATE_EXTRA;
+    }
+    if ((ctx->state == _STATE_EXTRA) && (ctx->extra == 0)) {
+        if (((ctx->seek < 0) && ((size_t)-ctx->seek > ctx->pos)) ||
+            ((ctx->seek > 0) && (ctx->pos + ctx->seek > ctx->src_len))) {
+            DEBUG("suit_delta: seek beyond the source\n");
+            return -1;
+        }
+        ctx->pos += ctx->seek;
+        ctx->hdr_len = 0;
+        ctx->state = _STATE_RECORD;
+    }
+    return 0;
+}
+
+int suit_delta_write(void *arg, size_t offset, uint8_t *buf, size_t len,
+                     int more)
+{
+    suit_delta_t *ctx = arg;
+
+    if (offset != ctx->in) {
+        DEBUG("suit_delta: expected offset %u, got %u\n",
+              (unsigned)ctx->in, (unsigned)offset);
+        return -1;
+    }
+    ctx->in += len;
+    while (len > 0) {
+        size_t used = 1;
+
+        switch (ctx->state) {
+            case _STATE_HEADER:
+            case _STATE_RECORD:
+                used = _collect(ctx, buf, len);
+                if (ctx->hdr_len < SUIT_DELTA_HDR_LEN) {
+                    break;
+                }
+                if (ctx->state == _STATE_HEADER) {
+                    if (_parse_header(ctx) < 0) {
+                        return -1;
+                    }
+                    ctx->hdr_len = 0;
+                    ctx->state = _STATE_RECORD;
+                    break;
+                }
+                _parse_record(ctx);
+                ctx->state = _STATE_DIFF;
+                break;
+            case _STATE_DIFF:
+                if (ctx->pos >= ctx->src_len) {
+                    DEBUG("suit_delta: diff beyond the source\n");
+                    return -1;
+                }
+                if (_put(ctx, ctx->src[ctx->pos++] + *buf) < 0) {
+                    return -1;
+                }
+                ctx->diff--;
+                break;
+            case _STATE_EXTRA:
+                if (_put(ctx, *buf) < 0) {
+                    return -1;
+                }
+                ctx->extra--;
+                break;
+        }
+        buf += used;
+        len -= used;
+        if (_advance(ctx) < 0) {
+            return -1;
+        }
+    }
+    if (more) {
+        return 0;
+    }
+    if ((ctx->state != _STATE_RECORD) || (ctx->hdr_len != 0) ||
+        (ctx->out + ctx->len != ctx->img_len)) {
+        DEBUG("suit_delta: patch incomplete\n");
+        return -1;
+    }
+    DEBUG("suit_delta: %u byte patch applied to %u bytes\n",
+          (unsigned)ctx->in, (unsigned)ctx->img_len);
+    return _flush(ctx, 0);
+}
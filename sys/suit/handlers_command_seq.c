@@ -39,6 +39,12 @@
 #include "suit/transport/coap.h"
 #endif
 #include "suit/transport/mock.h"
+#if IS_USED(MODULE_SUIT_DECOMPRESS)
+#include "suit/decompress.h"
+#endif
+#if IS_USED(MODULE_SUIT_DELTA)
+#include "suit/delta.h"
+#endif
 
 #include "log.h"
 
@@ -279,6 +285,12 @@ static int _dtv_set_param(suit_manifest_t *manifest, int key,
             case SUIT_PARAMETER_URI:
                 ref = &comp->param_uri;
                 break;
+            case SUIT_PARAMETER_COMPRESSION_INFO:
+                ref = &comp->param_compression_info;
+                break;
+            case SUIT_PARAMETER_UNPACK_INFO:
+                ref = &comp->param_unpack_info;
+                break;
             default:
                 LOG_DEBUG("Unsupported parameter %" PRIi32 "\n", param_key);
                 return SUIT_ERR_UNSUPPORTED;
@@ -355,17 +367,63 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
 
     res = -1;
 
+    /* the payload passes the delta and decompression stages in reverse
+     * order before it reaches the storage backend, fetches run one at a
+     * time in the SUIT thread */
+    suit_payload_cb_t helper = suit_storage_helper;
+    void *helper_arg = manifest;
+#if IS_USED(MODULE_SUIT_DELTA)
+    static suit_delta_t delta;
+    int32_t unpack = suit_delta_get_unpack_info(manifest, comp);
+
+    if (unpack == SUIT_UNPACK_DELTA) {
+        if (suit_delta_init(&delta, helper, helper_arg) < 0) {
+            LOG_ERROR("suit: no source image for the delta\n");
+            return SUIT_ERR_UNSUPPORTED;
+        }
+        helper = suit_delta_write;
+        helper_arg = &delta;
+    }
+    else if (unpack != SUIT_UNPACK_NONE) {
+        LOG_ERROR("suit: unsupported unpack info %" PRIi32 "\n", unpack);
+        return SUIT_ERR_UNSUPPORTED;
+    }
+#else
+    if (comp->param_unpack_info.offset != 0) {
+        LOG_ERROR("suit: delta payloads need suit_delta\n");
+        return SUIT_ERR_UNSUPPORTED;
+    }
+#endif
+#if IS_USED(MODULE_SUIT_DECOMPRESS)
+    static suit_decompress_t decompress;
+    int32_t algorithm = suit_decompress_get_algorithm(manifest, comp);
+
+    if (algorithm == SUIT_COMPRESSION_HEATSHRINK) {
+        suit_decompress_init(&decompress, helper, helper_arg);
+        helper = suit_decompress_write;
+        helper_arg = &decompress;
+    }
+    else if (algorithm != SUIT_COMPRESSION_NONE) {
+        LOG_ERROR("suit: unsupported compression %" PRIi32 "\n", algorithm);
+        return SUIT_ERR_UNSUPPORTED;
+    }
+#else
+    if (comp->param_compression_info.offset != 0) {
+        LOG_ERROR("suit: compressed payloads need suit_decompress\n");
+        return SUIT_ERR_UNSUPPORTED;
+    }
+#endif
+
     if (0) {}
 #ifdef MODULE_SUIT_TRANSPORT_COAP
     else if (strncmp(manifest->urlbuf, "coap://", 7) == 0) {
         res = suit_coap_get_blockwise_url(manifest->urlbuf, CONFIG_SUIT_COAP_BLOCKSIZE,
-                                          suit_storage_helper,
-                                          manifest);
+                                          helper, helper_arg);
     }
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_MOCK
     else if (strncmp(manifest->urlbuf, "test://", 7) == 0) {
-        res = suit_transport_mock_fetch(manifest);
+        res = suit_transport_mock_fetch(manifest, helper, helper_arg);
     }
 #endif
     else {
@@ -383,6 +441,18 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
         return res;
     }
 
+#if IS_USED(MODULE_SUIT_DECOMPRESS)
+    if (algorithm == SUIT_COMPRESSION_HEATSHRINK) {
+        LOG_INFO("suit: fetched %u bytes for a %u byte image\n",
+                 (unsigned)decompress.in, (unsigned)decompress.out);
+    }
+#endif
+#if IS_USED(MODULE_SUIT_DELTA)
+    if (unpack == SUIT_UNPACK_DELTA) {
+        LOG_INFO("suit: %u byte patch applied for a %u byte image\n",
+                 (unsigned)delta.in, (unsigned)delta.img_len);
+    }
+#endif
     LOG_DEBUG("Update OK\n");
     return SUIT_OK;
 }
@@ -413,7 +483,14 @@ static int _validate_payload(suit_component_t *component, const uint8_t *digest,
     uint8_t payload_digest[SHA256_DIGEST_LENGTH];
     suit_storage_t *storage = component->storage_backend;
 
-    if (suit_storage_has_readptr(storage)) {
+    if (!IS_ACTIVE(CONFIG_SUIT_STORAGE_READBACK) &&
+        suit_storage_has_sha256(storage)) {
+        /* Hashed while writing, nothing to read back */
+        if (suit_storage_sha256(storage, payload_digest) != SUIT_OK) {
+            return SUIT_ERR_STORAGE;
+        }
+    }
+    else if (suit_storage_has_readptr(storage)) {
         /* Direct read possible */
         const uint8_t *payload = NULL;
         size_t payload_len = 0;
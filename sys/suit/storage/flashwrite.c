@@ -151,6 +151,16 @@ static int _flashwrite_read(suit_storage_t *storage, uint8_t *buf,
     return 0;
 }
 
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+static int _flashwrite_sha256(suit_storage_t *storage, uint8_t *digest)
+{
+    suit_storage_flashwrite_t *fw = _get_fw(storage);
+
+    riotboot_flashwrite_sha256(&fw->writer, digest);
+    return SUIT_OK;
+}
+#endif
+
 static bool _flashwrite_has_location(const suit_storage_t *storage,
                                      const char *location)
 {
@@ -225,6 +235,9 @@ static const suit_storage_driver_t suit_storage_flashwrite_driver = {
     .write = _flashwrite_write,
     .finish = _flashwrite_finish,
     .read = _flashwrite_read,
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_SHA256)
+    .sha256 = _flashwrite_sha256,
+#endif
     .install = _flashwrite_install,
     .has_location = _flashwrite_has_location,
     .set_active_location = _flashwrite_set_active_location,
@@ -47,10 +47,6 @@
 #include "suit/storage.h"
 #endif
 
-#if defined(MODULE_PROGRESS_BAR)
-#include "progress_bar.h"
-#endif
-
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -77,31 +73,6 @@ static char _stack[SUIT_COAP_STACKSIZE];
 static char _url[SUIT_URL_MAX];
 static uint8_t _manifest_buf[SUIT_MANIFEST_BUFSIZE];
 
-#ifdef MODULE_SUIT
-static inline void _print_download_progress(suit_manifest_t *manifest,
-                                            size_t offset, size_t len,
-                                            size_t image_size)
-{
-    (void)manifest;
-    (void)offset;
-    (void)len;
-    DEBUG("_suit_flashwrite(): writing %u bytes at pos %u\n", len, offset);
-#if defined(MODULE_PROGRESS_BAR)
-    if (image_size != 0) {
-        char _suffix[7] = { 0 };
-        uint8_t _progress = 100 * (offset + len) / image_size;
-        sprintf(_suffix, " %3d%%", _progress);
-        progress_bar_print("Fetching firmware ", _suffix, _progress);
-        if (_progress == 100) {
-            puts("");
-        }
-    }
-#else
-    (void) image_size;
-#endif
-}
-#endif
-
 static kernel_pid_t _suit_coap_pid;
 
 ssize_t coap_subtree_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
@@ -194,8 +165,9 @@ static ssize_t _nanocoap_request(sock_udp_t *sock, coap_pkt_t *pkt, size_t len)
     return res;
 }
 
-static int _fetch_block(coap_pkt_t *pkt, uint8_t *buf, sock_udp_t *sock,
-                        const char *path, coap_blksize_t blksize, size_t num)
+static void _build_block_request(coap_pkt_t *pkt, uint8_t *buf,
+                                 const char *path, coap_blksize_t blksize,
+                                 size_t num)
 {
     uint8_t *pktpos = buf;
     uint16_t lastonum = 0;
@@ -211,6 +183,12 @@ static int _fetch_block(coap_pkt_t *pkt, uint8_t *buf, sock_udp_t *sock,
 
     pkt->payload = pktpos;
     pkt->payload_len = 0;
+}
+
+static int _fetch_block(coap_pkt_t *pkt, uint8_t *buf, sock_udp_t *sock,
+                        const char *path, coap_blksize_t blksize, size_t num)
+{
+    _build_block_request(pkt, buf, path, blksize, num);
 
     int res = _nanocoap_request(sock, pkt, 64 + (0x1 << (blksize + 4)));
     if (res < 0) {
@@ -226,20 +204,26 @@ static int _fetch_block(coap_pkt_t *pkt, uint8_t *buf, sock_udp_t *sock,
     return 0;
 }
 
-int suit_coap_get_blockwise(sock_udp_ep_t *remote, const char *path,
-                            coap_blksize_t blksize,
-                            coap_blockwise_cb_t callback, void *arg)
+static int _sock_create(sock_udp_t *sock, sock_udp_ep_t *remote)
 {
-    /* mmmmh dynamically sized array */
-    uint8_t buf[64 + (0x1 << (blksize + 4))];
     sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
-    coap_pkt_t pkt;
 
     /* HACK: use random local port */
     local.port = 0x8000 + (xtimer_now_usec() % 0XFFF);
 
+    return sock_udp_create(sock, &local, remote, 0);
+}
+
+static int _get_blockwise_seq(sock_udp_ep_t *remote, const char *path,
+                              coap_blksize_t blksize,
+                              coap_blockwise_cb_t callback, void *arg)
+{
+    /* mmmmh dynamically sized array */
+    uint8_t buf[64 + (0x1 << (blksize + 4))];
+    coap_pkt_t pkt;
+
     sock_udp_t sock;
-    int res = sock_udp_create(&sock, &local, remote, 0);
+    int res = _sock_create(&sock, remote);
     if (res < 0) {
         return res;
     }
@@ -278,6 +262,208 @@ out:
     return res;
 }
 
+/* state of a block request in the window */
+enum {
+    _BLOCK_FREE = 0,
+    _BLOCK_SENT,
+    _BLOCK_DONE,
+    _BLOCK_ERR,
+};
+
+typedef struct {
+    size_t num;             /* block number */
+    uint32_t deadline;      /* of the current transmission */
+    uint32_t timeout;       /* of the current transmission */
+    uint16_t len;           /* of the received payload */
+    uint8_t state;          /* _BLOCK_% */
+    uint8_t tries_left;     /* retransmissions left */
+    int8_t more;            /* more flag of the received block */
+} _block_t;
+
+static int _send_block_request(sock_udp_t *sock, uint8_t *buf,
+                               const char *path, coap_blksize_t blksize,
+                               _block_t *block)
+{
+    coap_pkt_t pkt;
+
+    _build_block_request(&pkt, buf, path, blksize, block->num);
+    DEBUG("requesting block %u\n", (unsigned)block->num);
+    ssize_t res = sock_udp_send(sock, buf, pkt.payload - buf, NULL);
+    if (res <= 0) {
+        DEBUG("nanocoap: error sending coap request, %d\n", (int)res);
+        return -1;
+    }
+    block->deadline = deadline_from_interval(block->timeout);
+    return 0;
+}
+
+/* stop waiting for blocks past the end of the resource */
+static void _drop_beyond(_block_t *blocks, unsigned window, size_t last)
+{
+    for (unsigned i = 0; i < window; i++) {
+        if ((blocks[i].state != _BLOCK_FREE) && (blocks[i].num > last)) {
+            blocks[i].state = _BLOCK_FREE;
+        }
+    }
+}
+
+int suit_coap_get_blockwise_window(sock_udp_ep_t *remote, const char *path,
+                                   coap_blksize_t blksize, unsigned window,
+                                   coap_blockwise_cb_t callback, void *arg)
+{
+    assert((window > 0) && (window <= CONFIG_SUIT_COAP_WINDOW));
+    if (window == 1) {
+        return _get_blockwise_seq(remote, path, blksize, callback, arg);
+    }
+
+    const size_t blklen = 0x1 << (blksize + 4);
+    uint8_t buf[64 + blklen];
+    uint8_t data[window][blklen];
+    _block_t blocks[CONFIG_SUIT_COAP_WINDOW];
+    /* next block to request and to hand to the callback */
+    size_t next_req = 0, next_cb = 0;
+    /* number of the last block, once known */
+    size_t last = SIZE_MAX;
+    sock_udp_t sock;
+    int res;
+
+    res = _sock_create(&sock, remote);
+    if (res < 0) {
+        return res;
+    }
+    memset(blocks, 0, sizeof(blocks));
+
+    res = -1;
+    while (1) {
+        uint32_t timeout = UINT32_MAX;
+        coap_pkt_t pkt;
+        ssize_t len;
+
+        /* fill the window */
+        while ((next_req < next_cb + window) && (next_req <= last)) {
+            _block_t *block = &blocks[next_req % window];
+
+            block->num = next_req++;
+            block->state = _BLOCK_SENT;
+            block->tries_left = CONFIG_COAP_MAX_RETRANSMIT;
+            block->timeout = CONFIG_COAP_ACK_TIMEOUT * US_PER_SEC;
+            if (_send_block_request(&sock, buf, path, blksize, block) < 0) {
+                goto out;
+            }
+        }
+        /* wait for the first retransmission to come due */
+        for (unsigned i = 0; i < window; i++) {
+            if ((blocks[i].state == _BLOCK_SENT) &&
+                (deadline_left(blocks[i].deadline) < timeout)) {
+                timeout = deadline_left(blocks[i].deadline);
+            }
+        }
+        if (blocks[next_cb % window].state == _BLOCK_ERR) {
+            goto out;
+        }
+        len = sock_udp_recv(&sock, buf, sizeof(buf), timeout, NULL);
+        if ((len == -ETIMEDOUT) || (len == -EAGAIN)) {
+            for (unsigned i = 0; i < window; i++) {
+                _block_t *block = &blocks[i];
+
+                if ((block->state != _BLOCK_SENT) ||
+                    (deadline_left(block->deadline) > 0)) {
+                    continue;
+                }
+                if (block->tries_left == 0) {
+                    DEBUG("nanocoap: maximum retries reached for block %u\n",
+                          (unsigned)block->num);
+                    goto out;
+                }
+                block->tries_left--;
+                block->timeout *= 2;
+                if (_send_block_request(&sock, buf, path, blksize,
+                                        block) < 0) {
+                    goto out;
+                }
+            }
+            continue;
+        }
+        if (len <= 0) {
+            DEBUG("nanocoap: error receiving coap response, %d\n", (int)len);
+            goto out;
+        }
+        if (coap_parse(&pkt, buf, len) < 0) {
+            DEBUG("nanocoap: error parsing packet\n");
+            continue;
+        }
+
+        /* the message ID is the lower part of the block number */
+        _block_t *block = NULL;
+        for (unsigned i = 0; i < window; i++) {
+            if ((blocks[i].state == _BLOCK_SENT) &&
+                ((uint16_t)blocks[i].num == coap_get_id(&pkt))) {
+                block = &blocks[i];
+                break;
+            }
+        }
+        if (block == NULL) {
+            /* duplicate or late response, including those for blocks past
+             * the end, which were dropped when the end became known */
+            continue;
+        }
+        if (coap_get_code(&pkt) != 205) {
+            DEBUG("code=%u for block %u\n", coap_get_code(&pkt),
+                  (unsigned)block->num);
+            /* only fatal when it is not a request beyond the end */
+            block->state = _BLOCK_ERR;
+            continue;
+        }
+
+        coap_block1_t block2;
+        coap_get_block2(&pkt, &block2);
+        if ((block2.offset != block->num * blklen) ||
+            (pkt.payload_len > blklen)) {
+            DEBUG("unexpected block for %u\n", (unsigned)block->num);
+            goto out;
+        }
+        memcpy(data[block - blocks], pkt.payload, pkt.payload_len);
+        block->len = pkt.payload_len;
+        block->more = block2.more;
+        block->state = _BLOCK_DONE;
+        /* a late response for a block past the end must not move the end
+         * back up */
+        if ((block2.more != 1) && (block->num < last)) {
+            last = block->num;
+            _drop_beyond(blocks, window, last);
+        }
+
+        /* hand on the blocks in order */
+        while (blocks[next_cb % window].state == _BLOCK_DONE) {
+            block = &blocks[next_cb % window];
+            if (callback(arg, block->num * blklen, data[block - blocks],
+                         block->len, block->more)) {
+                DEBUG("callback res != 0, aborting.\n");
+                goto out;
+            }
+            block->state = _BLOCK_FREE;
+            if (block->num == last) {
+                res = 0;
+                goto out;
+            }
+            next_cb++;
+        }
+    }
+
+out:
+    sock_udp_close(&sock);
+    return res;
+}
+
+int suit_coap_get_blockwise(sock_udp_ep_t *remote, const char *path,
+                            coap_blksize_t blksize,
+                            coap_blockwise_cb_t callback, void *arg)
+{
+    return suit_coap_get_blockwise_window(remote, path, blksize,
+                                          CONFIG_SUIT_COAP_WINDOW,
+                                          callback, arg);
+}
+
 int suit_coap_get_blockwise_url(const char *url,
                                 coap_blksize_t blksize,
                                 coap_blockwise_cb_t callback, void *arg)
@@ -389,49 +575,6 @@ static void _suit_handle_url(const char *url)
     }
 }
 
-int suit_storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
-                        int more)
-{
-    suit_manifest_t *manifest = (suit_manifest_t *)arg;
-
-    uint32_t image_size;
-    nanocbor_value_t param_size;
-    size_t total = offset + len;
-    suit_component_t *comp = &manifest->components[manifest->component_current];
-    suit_param_ref_t *ref_size = &comp->param_size;
-
-    /* Grab the total image size from the manifest */
-    if ((suit_param_ref_to_cbor(manifest, ref_size, &param_size) == 0) ||
-            (nanocbor_get_uint32(&param_size, &image_size) < 0)) {
-        /* Early exit if the total image size can't be determined */
-        return -1;
-    }
-
-    if (image_size < offset + len) {
-        /* Extra newline at the start to compensate for the progress bar */
-        LOG_ERROR(
-            "\n_suit_coap(): Image beyond size, offset + len=%u, "
-            "image_size=%u\n", (unsigned)(total), (unsigned)image_size);
-        return -1;
-    }
-
-    if (!more && image_size != total) {
-        LOG_INFO("Incorrect size received, got %u, expected %u\n",
-                 (unsigned)total, (unsigned)image_size);
-        return -1;
-    }
-
-    _print_download_progress(manifest, offset, len, image_size);
-
-    int res = suit_storage_write(comp->storage_backend, manifest, buf, offset, len);
-    if (!more) {
-        LOG_INFO("Finalizing payload store\n");
-        /* Finalize the write if no more data available */
-        res = suit_storage_finish(comp->storage_backend, manifest);
-    }
-    return res;
-}
-
 static void *_suit_coap_thread(void *arg)
 {
     (void)arg;
@@ -24,6 +24,7 @@
 #include <unistd.h> /* for STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO */
 
 #include "vfs.h"
+#include "irq.h"
 #include "mutex.h"
 #include "thread.h"
 #include "sched.h"
@@ -333,6 +334,74 @@ ssize_t vfs_write(int fd, const void *src, size_t count)
     return filp->f_op->write(filp, src, count);
 }
 
+/* always reported, whether asked for or not */
+#define VFS_POLL_ALWAYS (VFS_POLLERR | VFS_POLLHUP | VFS_POLLNVAL)
+
+int vfs_poll(int fd, unsigned events, vfs_poll_waiter_t *waiter)
+{
+    DEBUG("vfs_poll: %d, %x, %p\n", fd, events, (void *)waiter);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (waiter != NULL) {
+        waiter->events = events;
+    }
+    if (filp->f_op->poll == NULL) {
+        /* driver never blocks */
+        return (VFS_POLLIN | VFS_POLLOUT) & events;
+    }
+    return filp->f_op->poll(filp, waiter) & (events | VFS_POLL_ALWAYS);
+}
+
+void vfs_poll_del(int fd, vfs_poll_waiter_t *waiter)
+{
+    DEBUG("vfs_poll_del: %d, %p\n", fd, (void *)waiter);
+    if (_fd_is_valid(fd) < 0) {
+        return;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (filp->f_op->poll_del != NULL) {
+        filp->f_op->poll_del(filp, waiter);
+    }
+}
+
+void vfs_poll_waiters_add(vfs_poll_waiter_t **list, vfs_poll_waiter_t *waiter)
+{
+    unsigned state = irq_disable();
+    waiter->next = *list;
+    *list = waiter;
+    irq_restore(state);
+}
+
+void vfs_poll_waiters_del(vfs_poll_waiter_t **list, vfs_poll_waiter_t *waiter)
+{
+    unsigned state = irq_disable();
+    for (; *list != NULL; list = &(*list)->next) {
+        if (*list == waiter) {
+            *list = waiter->next;
+            break;
+        }
+    }
+    irq_restore(state);
+}
+
+void vfs_poll_waiters_notify(vfs_poll_waiter_t **list, unsigned events)
+{
+    unsigned state = irq_disable();
+    for (vfs_poll_waiter_t *w = *list; w != NULL; w = w->next) {
+        unsigned ready = events & (w->events | VFS_POLL_ALWAYS);
+        if (ready) {
+            w->notify(w, ready);
+        }
+    }
+    if (events & VFS_POLLNVAL) {
+        *list = NULL;
+    }
+    irq_restore(state);
+}
+
 int vfs_opendir(vfs_DIR *dirp, const char *dirname)
 {
     DEBUG("vfs_opendir: %p, \"%s\"\n", (void *)dirp, dirname);
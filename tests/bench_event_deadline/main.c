@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the dispatch latency of a mixed event workload
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "event.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (2000000U)
+#endif
+
+#define BULK                (8U)
+#define BULK_PERIOD_US      (20000U)
+#define BULK_WORK_US        (1000U)
+#define URGENT_PERIOD_US    (3100U)
+#define URGENT_WORK_US      (50U)
+#define URGENT_DEADLINE_US  (500U)
+
+#define BUCKET_US           (250U)
+/* the last bucket takes all longer latencies */
+#define BUCKETS             (32U)
+
+typedef struct {
+    const char *name;
+    uint32_t count;
+    uint32_t missed;
+    uint32_t max;
+    uint32_t buckets[BUCKETS];
+} hist_t;
+
+typedef struct {
+    event_t super;
+    hist_t *hist;
+    uint32_t work;
+    uint32_t posted;
+    volatile bool queued;
+} timed_event_t;
+
+static char _stack[THREAD_STACKSIZE_MAIN];
+static event_queue_t _queue;
+static volatile bool _stop;
+
+static hist_t _urgent_hist = { .name = "urgent" };
+static hist_t _bulk_hist = { .name = "bulk" };
+
+static void _handler(event_t *event);
+
+static timed_event_t _urgent = {
+    .super.handler = _handler,
+#if IS_USED(MODULE_EVENT_DEADLINE)
+    .super.deadline = URGENT_DEADLINE_US,
+#endif
+    .hist = &_urgent_hist,
+    .work = URGENT_WORK_US,
+};
+static timed_event_t _bulk[BULK];
+
+static void _handler(event_t *event)
+{
+    timed_event_t *ev = container_of(event, timed_event_t, super);
+    uint32_t latency = ztimer_now(ZTIMER_USEC) - ev->posted;
+    hist_t *hist = ev->hist;
+
+    ev->queued = false;
+    hist->count++;
+    hist->buckets[(latency / BUCKET_US < BUCKETS) ? latency / BUCKET_US
+                                                  : BUCKETS - 1]++;
+    if (latency > hist->max) {
+        hist->max = latency;
+    }
+    ztimer_spin(ZTIMER_USEC, ev->work);
+}
+
+static void _post(timed_event_t *ev)
+{
+    if (ev->queued) {
+        ev->hist->missed++;
+        return;
+    }
+    ev->queued = true;
+    ev->posted = ztimer_now(ZTIMER_USEC);
+    event_post(&_queue, &ev->super);
+}
+
+static void _urgent_cb(void *arg);
+static void _bulk_cb(void *arg);
+
+static ztimer_t _urgent_timer = { .callback = _urgent_cb };
+static ztimer_t _bulk_timer = { .callback = _bulk_cb };
+
+static void _urgent_cb(void *arg)
+{
+    (void)arg;
+    if (!_stop) {
+        ztimer_set(ZTIMER_USEC, &_urgent_timer, URGENT_PERIOD_US);
+        _post(&_urgent);
+    }
+}
+
+static void _bulk_cb(void *arg)
+{
+    (void)arg;
+    if (!_stop) {
+        ztimer_set(ZTIMER_USEC, &_bulk_timer, BULK_PERIOD_US);
+        for (unsigned i = 0; i < BULK; i++) {
+            _post(&_bulk[i]);
+        }
+    }
+}
+
+static void *_loop(void *arg)
+{
+    (void)arg;
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+    return NULL;
+}
+
+/* upper bound of the latency of the given share of events */
+static uint32_t _percentile(const hist_t *hist, unsigned percent)
+{
+    uint32_t target = ((uint64_t)hist->count * percent + 99) / 100;
+    uint32_t sum = 0;
+
+    for (unsigned i = 0; i < BUCKETS - 1; i++) {
+        sum += hist->buckets[i];
+        if (sum >= target) {
+            return (i + 1) * BUCKET_US;
+        }
+    }
+    return hist->max + 1;
+}
+
+static void _print(const hist_t *hist)
+{
+    printf("%s: %" PRIu32 " events, %" PRIu32 " missed, p50 < %" PRIu32
+           " us, p90 < %" PRIu32 " us, p99 < %" PRIu32 " us, max %" PRIu32
+           " us\n", hist->name, hist->count, hist->missed,
+           _percentile(hist, 50), _percentile(hist, 90),
+           _percentile(hist, 99), hist->max);
+    for (unsigned i = 0; i < BUCKETS; i++) {
+        if (hist->buckets[i] == 0) {
+            continue;
+        }
+        if (i < BUCKETS - 1) {
+            printf("  < %5u us: %" PRIu32 "\n", (i + 1) * BUCKET_US,
+                   hist->buckets[i]);
+        }
+        else {
+            printf("  longer:     %" PRIu32 "\n", hist->buckets[i]);
+        }
+    }
+}
+
+int main(void)
+{
+    printf("ordered by %s\n",
+           IS_USED(MODULE_EVENT_DEADLINE) ? "deadline" : "posting");
+
+    for (unsigned i = 0; i < BULK; i++) {
+        _bulk[i].super.handler = _handler;
+        _bulk[i].hist = &_bulk_hist;
+        _bulk[i].work = BULK_WORK_US;
+    }
+    event_queue_init_detached(&_queue);
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _loop, NULL, "loop");
+
+    ztimer_set(ZTIMER_USEC, &_bulk_timer, BULK_PERIOD_US);
+    ztimer_set(ZTIMER_USEC, &_urgent_timer, URGENT_PERIOD_US);
+    ztimer_sleep(ZTIMER_USEC, TEST_DURATION);
+    _stop = true;
+    ztimer_remove(ZTIMER_USEC, &_bulk_timer);
+    ztimer_remove(ZTIMER_USEC, &_urgent_timer);
+    /* let the queue drain */
+    ztimer_sleep(ZTIMER_USEC, BULK_PERIOD_US);
+
+    _print(&_urgent_hist);
+    _print(&_bulk_hist);
+
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for name in ("urgent", "bulk"):
+        child.expect(name + r": \d+ events, \d+ missed, p50 < \d+ us, "
+                     r"p90 < \d+ us, p99 < \d+ us, max \d+ us")
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
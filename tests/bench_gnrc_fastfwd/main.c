@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for forwarding IPv6 packets between two interfaces
+ *
+ * The upstream interface receives an Ethernet frame with an IPv6 packet for
+ * 2001:db8:1::1, which is routed via fe80::2 on the downstream interface.
+ * The time is taken from triggering the reception until the downstream
+ * device is asked to send the forwarded packet.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+#include "net/gnrc/netif/fastfwd.h"
+#define PATH                "fast"
+#else
+#define PATH                "full"
+#endif
+
+#ifndef PACKETS
+#define PACKETS             (10000U)
+#endif
+
+#define PAYLOAD_SIZE        (32U)
+#define SEND_TIMEOUT        (100U * US_PER_MS)
+
+typedef struct {
+    gnrc_netif_t netif;
+    netdev_test_t dev;
+    uint8_t addr[ETHERNET_ADDR_LEN];
+    char stack[THREAD_STACKSIZE_DEFAULT];
+} iface_t;
+
+static const uint8_t _peer_addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+/* 2001:db8::2 */
+static const ipv6_addr_t _src = { .u8 = { 0x20, 0x01, 0x0d, 0xb8,
+                                          [15] = 0x02 } };
+/* 2001:db8:1::1, routed via fe80::2 */
+static const ipv6_addr_t _dst = { .u8 = { 0x20, 0x01, 0x0d, 0xb8,
+                                          0x00, 0x01, [15] = 0x01 } };
+static const ipv6_addr_t _next_hop = { .u8 = { 0xfe, 0x80, [15] = 0x02 } };
+
+static iface_t _up = { .addr = { 0x02, 0x00, 0x00, 0x00, 0x01, 0x01 } };
+static iface_t _down = { .addr = { 0x02, 0x00, 0x00, 0x00, 0x02, 0x01 } };
+static mutex_t _sent = MUTEX_INIT_LOCKED;
+
+static uint8_t _frame[sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) +
+                      sizeof(udp_hdr_t) + PAYLOAD_SIZE];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    iface_t *iface = container_of(dev, iface_t, dev.netdev.netdev);
+
+    expect(max_len >= sizeof(iface->addr));
+    memcpy(value, iface->addr, sizeof(iface->addr));
+    return sizeof(iface->addr);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return sizeof(_frame);
+    }
+    if (len < (int)sizeof(_frame)) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _frame, sizeof(_frame));
+    return sizeof(_frame);
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static int _send_up(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    return iolist_size(iolist);
+}
+
+static int _send_down(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    mutex_unlock(&_sent);
+    return iolist_size(iolist);
+}
+
+static void _init_iface(iface_t *iface, char *name,
+                        netdev_test_send_cb_t send)
+{
+    netdev_test_setup(&iface->dev, NULL);
+    netdev_test_set_get_cb(&iface->dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&iface->dev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&iface->dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_recv_cb(&iface->dev, _recv);
+    netdev_test_set_isr_cb(&iface->dev, _isr);
+    netdev_test_set_send_cb(&iface->dev, send);
+    expect(gnrc_netif_ethernet_create(&iface->netif, iface->stack,
+                                      sizeof(iface->stack), GNRC_NETIF_PRIO,
+                                      name, &iface->dev.netdev.netdev) == 0);
+}
+
+static void _init_frame(void)
+{
+    ethernet_hdr_t *eth = (ethernet_hdr_t *)_frame;
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)(eth + 1);
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+    uint16_t udp_len = sizeof(udp_hdr_t) + PAYLOAD_SIZE;
+
+    memcpy(eth->dst, _up.addr, sizeof(eth->dst));
+    memcpy(eth->src, _peer_addr, sizeof(eth->src));
+    eth->type = byteorder_htons(ETHERTYPE_IPV6);
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(udp_len);
+    ipv6->nh = PROTNUM_UDP;
+    ipv6->hl = 64;
+    ipv6->src = _src;
+    ipv6->dst = _dst;
+    /* routers don't look at the checksum */
+    udp->src_port = byteorder_htons(4712);
+    udp->dst_port = byteorder_htons(4711);
+    udp->length = byteorder_htons(udp_len);
+}
+
+int main(void)
+{
+    unsigned done = 0;
+    uint32_t start, usec;
+
+    _init_frame();
+    _init_iface(&_up, "up", _send_up);
+    _init_iface(&_down, "down", _send_down);
+    expect(gnrc_ipv6_nib_nc_set(&_next_hop, _down.netif.pid, _peer_addr,
+                                sizeof(_peer_addr)) == 0);
+    expect(gnrc_ipv6_nib_ft_add(&_dst, 64, &_next_hop, _down.netif.pid,
+                                0) == 0);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < PACKETS; i++) {
+        /* don't count anything the stack sent on its own before */
+        mutex_trylock(&_sent);
+        netdev_trigger_event_isr(&_up.dev.netdev.netdev);
+        if (ztimer_mutex_lock_timeout(ZTIMER_USEC, &_sent,
+                                      SEND_TIMEOUT) == 0) {
+            done++;
+        }
+    }
+    usec = ztimer_now(ZTIMER_USEC) - start;
+
+    uint32_t ns = done ? (uint32_t)(((uint64_t)usec * NS_PER_US) / done) : 0;
+    uint32_t rate = usec ? (uint32_t)(((uint64_t)done * US_PER_SEC) / usec) : 0;
+
+    printf("forward (" PATH " path): %u pkts in %" PRIu32 " us, %" PRIu32
+           " pkts/s, %" PRIu32 " ns/pkt", done, usec, rate, ns);
+#ifdef CLOCK_CORECLOCK
+    printf(", %" PRIu32 " cycles/pkt",
+           (uint32_t)(((uint64_t)ns * CLOCK_CORECLOCK) / NS_PER_SEC));
+#endif
+    printf(", %u lost\n", PACKETS - done);
+#if IS_USED(MODULE_GNRC_NETIF_FASTFWD)
+    gnrc_netif_fastfwd_stats_t stats;
+
+    gnrc_netif_fastfwd_stats_get(&stats);
+    printf("fast path: %" PRIu32 " forwarded, %" PRIu32 " slow, %" PRIu32
+           " cache misses\n", stats.forwarded, stats.slow,
+           stats.cache_misses);
+#endif
+    puts("DONE");
+    return 0;
+}
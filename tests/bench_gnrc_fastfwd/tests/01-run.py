@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"forward \((fast|full) path\): (\d+) pkts in \d+ us, "
+                 r"\d+ pkts/s, \d+ ns/pkt(, \d+ cycles/pkt)?, (\d+) lost")
+    fast = child.match.group(1) == "fast"
+    assert int(child.match.group(2)) > 0
+    assert int(child.match.group(4)) == 0
+    if fast:
+        child.expect(r"fast path: (\d+) forwarded, \d+ slow, "
+                     r"\d+ cache misses")
+        assert int(child.match.group(1)) > 0
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
@@ -0,0 +1,383 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the receive and forwarding paths of GNRC
+ *
+ * The same UDP datagram is injected at different layers of the stack and
+ * received with sock_udp, one packet at a time. As all GNRC threads have a
+ * higher priority than the main thread, each packet has passed the whole
+ * stack when the main thread runs again. The stages are
+ *
+ * - `udp`: UDP header and payload handed to GNRC UDP
+ * - `ipv6`: an uncompressed IPv6 packet handed to GNRC IPv6
+ * - `sixlowpan`: an IPHC compressed packet handed to GNRC 6LoWPAN
+ * - `netif`: an IEEE 802.15.4 frame received from a netdev_test device
+ * - `forward`: an IPv6 packet forwarded via the NIB and sent with IPHC
+ *   compression through the netdev_test device
+ *
+ * The cost of a single layer is the difference between two adjacent
+ * stages.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/sock/udp.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef PACKETS
+#define PACKETS             (1000U)
+#endif
+
+#define PAYLOAD_SIZE        (32U)
+#define LOCAL_PORT          (4711U)
+#define REMOTE_PORT         (4712U)
+#define RECV_TIMEOUT        (100U * US_PER_MS)
+
+/* IEEE 802.15.4 data frame, PAN ID compressed, long addresses */
+#define MHR_LEN             (21U)
+/* IPHC with elided traffic class, flow label and hop limit (255), inline
+ * addresses, and UDP NHC with inline ports and checksum */
+#define IPHC_LEN            (2U + (2U * sizeof(ipv6_addr_t)) + 7U)
+
+#define LOCAL_EUI64         { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 }
+#define REMOTE_EUI64        { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 }
+
+typedef struct {
+    const char *name;
+    void (*inject)(void);
+    bool forward;
+} stage_t;
+
+static const uint8_t _local_eui64[] = LOCAL_EUI64;
+static const uint8_t _remote_eui64[] = REMOTE_EUI64;
+/* 2001:db8::1 */
+static const ipv6_addr_t _local_addr = { .u8 = { 0x20, 0x01, 0x0d, 0xb8,
+                                                 [15] = 0x01 } };
+/* 2001:db8::2 */
+static const ipv6_addr_t _remote_addr = { .u8 = { 0x20, 0x01, 0x0d, 0xb8,
+                                                  [15] = 0x02 } };
+/* 2001:db8:1::1, routed via fe80::2 */
+static const ipv6_addr_t _fwd_dst = { .u8 = { 0x20, 0x01, 0x0d, 0xb8,
+                                              0x00, 0x01, [15] = 0x01 } };
+static const ipv6_addr_t _next_hop = { .u8 = { 0xfe, 0x80, [15] = 0x02 } };
+
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _dev;
+static sock_udp_t _sock;
+static mutex_t _sent = MUTEX_INIT_LOCKED;
+
+/* the datagram as uncompressed IPv6 packet */
+static uint8_t _ipv6_pkt[sizeof(ipv6_hdr_t) + sizeof(udp_hdr_t) +
+                         PAYLOAD_SIZE];
+/* the same datagram as IPv6 packet to be forwarded */
+static uint8_t _fwd_pkt[sizeof(_ipv6_pkt)];
+/* the same datagram as IEEE 802.15.4 frame, IPHC starts at MHR_LEN */
+static uint8_t _frame[MHR_LEN + IPHC_LEN + PAYLOAD_SIZE];
+static uint8_t _rx_buf[PAYLOAD_SIZE];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = IEEE802154_FRAME_LEN_MAX - IEEE802154_FCS_LEN -
+                           MHR_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_local_eui64);
+    return sizeof(uint16_t);
+}
+
+static int _get_addr_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_local_eui64));
+    memcpy(value, _local_eui64, sizeof(_local_eui64));
+    return sizeof(_local_eui64);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    if (buf == NULL) {
+        return sizeof(_frame);
+    }
+    if (len < (int)sizeof(_frame)) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _frame, sizeof(_frame));
+    if (info != NULL) {
+        memset(info, 0, sizeof(netdev_ieee802154_rx_info_t));
+    }
+    return sizeof(_frame);
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    mutex_unlock(&_sent);
+    return iolist_size(iolist);
+}
+
+static void _init_netif(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_addr_long);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    netdev_test_set_send_cb(&_dev, _send);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "bench", &_dev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_local_addr, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) >= 0);
+    expect(gnrc_ipv6_nib_nc_set(&_next_hop, _netif.pid, _remote_eui64,
+                                sizeof(_remote_eui64)) == 0);
+    expect(gnrc_ipv6_nib_ft_add(&_fwd_dst, 64, &_next_hop, _netif.pid, 0) == 0);
+}
+
+static void _init_packets(void)
+{
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)_ipv6_pkt;
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+    uint8_t *payload = (uint8_t *)(udp + 1);
+    uint16_t udp_len = sizeof(udp_hdr_t) + PAYLOAD_SIZE;
+    uint16_t csum;
+    uint8_t *pos;
+
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(udp_len);
+    ipv6->nh = PROTNUM_UDP;
+    ipv6->hl = 255;
+    ipv6->src = _remote_addr;
+    ipv6->dst = _local_addr;
+    udp->src_port = byteorder_htons(REMOTE_PORT);
+    udp->dst_port = byteorder_htons(LOCAL_PORT);
+    udp->length = byteorder_htons(udp_len);
+    udp->checksum = byteorder_htons(0);
+    for (unsigned i = 0; i < PAYLOAD_SIZE; i++) {
+        payload[i] = i;
+    }
+    csum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_UDP, udp_len);
+    csum = ~inet_csum(csum, (uint8_t *)udp, udp_len);
+    udp->checksum = byteorder_htons((csum == 0) ? 0xffff : csum);
+
+    memcpy(_fwd_pkt, _ipv6_pkt, sizeof(_fwd_pkt));
+    ((ipv6_hdr_t *)_fwd_pkt)->dst = _fwd_dst;
+
+    pos = _frame;
+    /* frame control: data frame, PAN ID compression, long addresses */
+    *(pos++) = 0x41;
+    *(pos++) = 0xcc;
+    /* sequence number and destination PAN ID */
+    *(pos++) = 0;
+    *(pos++) = CONFIG_IEEE802154_DEFAULT_PANID & 0xff;
+    *(pos++) = CONFIG_IEEE802154_DEFAULT_PANID >> 8;
+    /* addresses are in reversed byte order */
+    for (unsigned i = 0; i < sizeof(_local_eui64); i++) {
+        *(pos++) = _local_eui64[sizeof(_local_eui64) - i - 1];
+    }
+    for (unsigned i = 0; i < sizeof(_remote_eui64); i++) {
+        *(pos++) = _remote_eui64[sizeof(_remote_eui64) - i - 1];
+    }
+    /* LOWPAN_IPHC: TF = 0b11, NH = 1, HLIM = 0b11, SAM = DAM = 0b00 */
+    *(pos++) = 0x7f;
+    *(pos++) = 0x00;
+    memcpy(pos, &ipv6->src, sizeof(ipv6->src));
+    pos += sizeof(ipv6->src);
+    memcpy(pos, &ipv6->dst, sizeof(ipv6->dst));
+    pos += sizeof(ipv6->dst);
+    /* LOWPAN_NHC for UDP with inline ports and checksum */
+    *(pos++) = 0xf0;
+    memcpy(pos, &udp->src_port, sizeof(udp->src_port));
+    pos += sizeof(udp->src_port);
+    memcpy(pos, &udp->dst_port, sizeof(udp->dst_port));
+    pos += sizeof(udp->dst_port);
+    memcpy(pos, &udp->checksum, sizeof(udp->checksum));
+    pos += sizeof(udp->checksum);
+    memcpy(pos, payload, PAYLOAD_SIZE);
+    expect((pos + PAYLOAD_SIZE) == &_frame[sizeof(_frame)]);
+}
+
+static gnrc_pktsnip_t *_netif_hdr(void)
+{
+    gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(_remote_eui64,
+                                                 sizeof(_remote_eui64),
+                                                 _local_eui64,
+                                                 sizeof(_local_eui64));
+
+    expect(netif != NULL);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    return netif;
+}
+
+static void _dispatch(gnrc_nettype_t type, gnrc_pktsnip_t *pkt)
+{
+    expect(pkt != NULL);
+    if (!gnrc_netapi_dispatch_receive(type, GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+static void _inject_udp(void)
+{
+    gnrc_pktsnip_t *ipv6 = gnrc_pktbuf_add(_netif_hdr(), _ipv6_pkt,
+                                           sizeof(ipv6_hdr_t),
+                                           GNRC_NETTYPE_IPV6);
+
+    expect(ipv6 != NULL);
+    _dispatch(GNRC_NETTYPE_UDP,
+              gnrc_pktbuf_add(ipv6, &_ipv6_pkt[sizeof(ipv6_hdr_t)],
+                              sizeof(_ipv6_pkt) - sizeof(ipv6_hdr_t),
+                              GNRC_NETTYPE_UDP));
+}
+
+static void _inject_ipv6(void)
+{
+    _dispatch(GNRC_NETTYPE_IPV6,
+              gnrc_pktbuf_add(_netif_hdr(), _ipv6_pkt, sizeof(_ipv6_pkt),
+                              GNRC_NETTYPE_IPV6));
+}
+
+static void _inject_sixlowpan(void)
+{
+    _dispatch(GNRC_NETTYPE_SIXLOWPAN,
+              gnrc_pktbuf_add(_netif_hdr(), &_frame[MHR_LEN],
+                              sizeof(_frame) - MHR_LEN,
+                              GNRC_NETTYPE_SIXLOWPAN));
+}
+
+static void _inject_netif(void)
+{
+    netdev_trigger_event_isr(&_dev.netdev.netdev);
+}
+
+static void _inject_forward(void)
+{
+    /* don't count anything the stack sent on its own before */
+    mutex_trylock(&_sent);
+    _dispatch(GNRC_NETTYPE_IPV6,
+              gnrc_pktbuf_add(_netif_hdr(), _fwd_pkt, sizeof(_fwd_pkt),
+                              GNRC_NETTYPE_IPV6));
+}
+
+static const stage_t _stages[] = {
+    { .name = "udp", .inject = _inject_udp },
+    { .name = "ipv6", .inject = _inject_ipv6 },
+    { .name = "sixlowpan", .inject = _inject_sixlowpan },
+    { .name = "netif", .inject = _inject_netif },
+    { .name = "forward", .inject = _inject_forward, .forward = true },
+};
+
+static bool _wait(const stage_t *stage)
+{
+    if (stage->forward) {
+        return ztimer_mutex_lock_timeout(ZTIMER_USEC, &_sent,
+                                         RECV_TIMEOUT) == 0;
+    }
+    return sock_udp_recv(&_sock, _rx_buf, sizeof(_rx_buf), RECV_TIMEOUT,
+                         NULL) == PAYLOAD_SIZE;
+}
+
+static uint32_t _run(const stage_t *stage)
+{
+    unsigned done = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    uint32_t usec;
+
+    for (unsigned i = 0; i < PACKETS; i++) {
+        stage->inject();
+        if (_wait(stage)) {
+            done++;
+        }
+    }
+    usec = ztimer_now(ZTIMER_USEC) - start;
+
+    /* nanoseconds per packet */
+    uint32_t ns = done ? (uint32_t)(((uint64_t)usec * NS_PER_US) / done) : 0;
+    uint32_t rate = usec ? (uint32_t)(((uint64_t)done * US_PER_SEC) / usec) : 0;
+
+    printf("%s: %u pkts in %" PRIu32 " us, %" PRIu32 " pkts/s, %" PRIu32
+           " ns/pkt", stage->name, done, usec, rate, ns);
+#ifdef CLOCK_CORECLOCK
+    printf(", %" PRIu32 " cycles/pkt",
+           (uint32_t)(((uint64_t)ns * CLOCK_CORECLOCK) / NS_PER_SEC));
+#endif
+    printf(", %u lost\n", PACKETS - done);
+    return ns;
+}
+
+int main(void)
+{
+    const sock_udp_ep_t local = { .family = AF_INET6, .port = LOCAL_PORT };
+    uint32_t ns[ARRAY_SIZE(_stages)];
+
+    _init_packets();
+    _init_netif();
+    expect(sock_udp_create(&_sock, &local, NULL, 0) == 0);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_stages); i++) {
+        ns[i] = _run(&_stages[i]);
+    }
+    /* the forward stage is not part of the receive path */
+    for (unsigned i = 1; i < ARRAY_SIZE(_stages) - 1; i++) {
+        printf("%s layer: %" PRId32 " ns/pkt\n", _stages[i].name,
+               (int32_t)(ns[i] - ns[i - 1]));
+    }
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for name in ("udp", "ipv6", "sixlowpan", "netif", "forward"):
+        child.expect(r"{}: (\d+) pkts in \d+ us, \d+ pkts/s, \d+ ns/pkt"
+                     r"(, \d+ cycles/pkt)?, (\d+) lost".format(name))
+        assert int(child.match.group(1)) > 0
+        assert int(child.match.group(3)) == 0
+    for name in ("ipv6", "sixlowpan", "netif"):
+        child.expect(r"{} layer: -?\d+ ns/pkt".format(name))
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP bulk transfer throughput benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/af.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "ztimer.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+
+/* gnrc_tcp_send() returns only once all of its data is acknowledged, so a
+ * call has to carry at least a full queue of segments to keep them in
+ * flight. The size is the same for all smaller queues, for comparison. */
+#if CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE > 4
+#define BUFFER_SEGMENTS     (CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE)
+#else
+#define BUFFER_SEGMENTS     (4U)
+#endif
+#define BUFFER_SIZE         (BUFFER_SEGMENTS * CONFIG_GNRC_TCP_MSS)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcbs[1];
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static char _buffer[BUFFER_SIZE];
+
+static void _print_result(const char *name, uint32_t bytes, uint32_t usec)
+{
+    uint64_t rate = usec ? ((uint64_t)bytes * US_PER_SEC) / usec : 0;
+
+    printf("%s: %" PRIu32 " bytes in %" PRIu32 " us, %" PRIu32 " bytes/s\n",
+           name, bytes, usec, (uint32_t)rate);
+}
+
+static int _server_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t local;
+    gnrc_tcp_tcb_t *tcb;
+    char ep_str[16];
+    uint32_t bytes = 0;
+    uint32_t start = 0;
+    ssize_t res;
+
+    if (argc < 2) {
+        printf("usage: %s <port>\n", argv[0]);
+        return 1;
+    }
+
+    snprintf(ep_str, sizeof(ep_str), "[::]:%s", argv[1]);
+    if (gnrc_tcp_ep_from_str(&local, ep_str) < 0) {
+        puts("server: invalid port");
+        return 1;
+    }
+
+    gnrc_tcp_tcb_init(&_tcbs[0]);
+    gnrc_tcp_tcb_queue_init(&_queue);
+    res = gnrc_tcp_listen(&_queue, _tcbs, ARRAY_SIZE(_tcbs), &local);
+    if (res < 0) {
+        printf("server: listen failed (%d)\n", (int)res);
+        return 1;
+    }
+
+    res = gnrc_tcp_accept(&_queue, &tcb, GNRC_TCP_NO_TIMEOUT);
+    if (res < 0) {
+        printf("server: accept failed (%d)\n", (int)res);
+        gnrc_tcp_stop_listen(&_queue);
+        return 1;
+    }
+
+    while ((res = gnrc_tcp_recv(tcb, _buffer, sizeof(_buffer),
+                                GNRC_TCP_NO_TIMEOUT)) > 0) {
+        /* measure from the first payload byte on, handshake excluded */
+        if (bytes == 0) {
+            start = ztimer_now(ZTIMER_USEC);
+        }
+        bytes += res;
+    }
+    uint32_t usec = ztimer_now(ZTIMER_USEC) - start;
+
+    gnrc_tcp_close(tcb);
+    gnrc_tcp_stop_listen(&_queue);
+    if (res < 0) {
+        printf("server: recv failed (%d)\n", (int)res);
+    }
+    _print_result("server", bytes, usec);
+    return 0;
+}
+
+static int _client_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+    gnrc_tcp_tcb_t *tcb = &_tcbs[0];
+    uint32_t bytes = 0;
+    uint32_t total;
+    ssize_t res;
+
+    if (argc < 3) {
+        printf("usage: %s <[addr]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        puts("client: invalid endpoint");
+        return 1;
+    }
+    total = strtoul(argv[2], NULL, 10);
+
+    for (unsigned i = 0; i < sizeof(_buffer); i++) {
+        _buffer[i] = 'a' + (i % 26);
+    }
+
+    gnrc_tcp_tcb_init(tcb);
+    res = gnrc_tcp_open(tcb, &remote, 0);
+    if (res < 0) {
+        printf("client: open failed (%d)\n", (int)res);
+        return 1;
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    while (bytes < total) {
+        size_t len = total - bytes;
+        if (len > sizeof(_buffer)) {
+            len = sizeof(_buffer);
+        }
+        res = gnrc_tcp_send(tcb, _buffer, len, GNRC_TCP_NO_TIMEOUT);
+        if (res < 0) {
+            printf("client: send failed (%d)\n", (int)res);
+            break;
+        }
+        bytes += res;
+    }
+    uint32_t usec = ztimer_now(ZTIMER_USEC) - start;
+
+    gnrc_tcp_close(tcb);
+    _print_result("client", bytes, usec);
+    return (bytes == total) ? 0 : 1;
+}
+
+static const shell_command_t _shell_commands[] = {
+    { "server", "receive data on a port", _server_cmd },
+    { "client", "send data to a remote endpoint", _client_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    /* a message queue is needed to receive packets from the stack */
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+
+    printf("gnrc_tcp throughput benchmark: %u segments of %u bytes in "
+           "flight, receive window %u bytes, %u bytes per send\n",
+           (unsigned)CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE,
+           (unsigned)CONFIG_GNRC_TCP_MSS, (unsigned)GNRC_TCP_RCV_BUF_SIZE,
+           (unsigned)BUFFER_SIZE);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the frames per second of lvgl
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "disp_dev.h"
+#include "kernel_defines.h"
+#include "lvgl/lvgl.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_DISP_DEV_NATIVE)
+#include "disp_dev_native.h"
+#endif
+
+#ifndef FRAMES
+#define FRAMES      (200U)
+#endif
+
+#define STEP        (3)
+
+static lv_obj_t *_boxes[2];
+static lv_obj_t *_label;
+
+static void _create(void)
+{
+    lv_obj_t *scr = lv_disp_get_scr_act(NULL);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_boxes); i++) {
+        _boxes[i] = lv_obj_create(scr, NULL);
+    }
+    lv_obj_set_size(_boxes[0], 100, 60);
+    lv_obj_set_size(_boxes[1], 60, 100);
+    _label = lv_label_create(scr, NULL);
+    lv_obj_set_pos(_label, 10, 10);
+}
+
+static void _frame(unsigned num)
+{
+    lv_coord_t hres = lv_disp_get_hor_res(NULL) - 100;
+    lv_coord_t vres = lv_disp_get_ver_res(NULL) - 100;
+
+    /* the boxes cross each other */
+    lv_obj_set_pos(_boxes[0], (num * STEP) % hres, vres / 2 + 20);
+    lv_obj_set_pos(_boxes[1], hres / 2 + 20, (num * STEP) % vres);
+    lv_label_set_text_fmt(_label, "frame %u", num);
+
+    /* refresh now, through the task that merges the areas */
+    lv_task_ready(lv_disp_get_default()->refr_task);
+    lv_task_handler();
+}
+
+int main(void)
+{
+    printf("%s buffer, %s\n",
+           IS_USED(MODULE_DISP_DEV_ASYNC) ? "double" : "single",
+           IS_ACTIVE(CONFIG_LVGL_NO_MERGE_AREAS) ? "areas from lvgl"
+                                                  : "areas merged");
+
+    _create();
+    /* the first frame draws the whole screen */
+    _frame(0);
+#if IS_USED(MODULE_DISP_DEV_ASYNC)
+    disp_dev_map_wait();
+#endif
+
+#if IS_USED(MODULE_DISP_DEV_NATIVE)
+    disp_dev_native_t *dev =
+        (disp_dev_native_t *)disp_dev_reg_find_screen(0)->dev;
+    uint32_t maps = dev->maps;
+    uint32_t pixels = dev->pixels;
+#endif
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 1; i <= FRAMES; i++) {
+        _frame(i);
+    }
+#if IS_USED(MODULE_DISP_DEV_ASYNC)
+    disp_dev_map_wait();
+#endif
+
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%u frames in %" PRIu32 " us, %" PRIu32 " fps\n", FRAMES, time,
+           (uint32_t)((uint64_t)FRAMES * US_PER_SEC / time));
+#if IS_USED(MODULE_DISP_DEV_NATIVE)
+    printf("per frame: %" PRIu32 " areas, %" PRIu32 " pixels\n",
+           (dev->maps - maps) / FRAMES, (dev->pixels - pixels) / FRAMES);
+#endif
+
+    puts("DONE");
+    return 0;
+}
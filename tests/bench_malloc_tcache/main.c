@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of allocations from several threads
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_MALLOC_TCACHE)
+#include "malloc_tcache.h"
+#endif
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#ifndef THREADS
+#define THREADS             (3U)
+#endif
+
+/* blocks each low priority thread keeps allocated */
+#define LIVE                (8U)
+/* allocations of the high priority thread per wake up */
+#define BURST               (4U)
+#define INTERVAL_US         (1000U)
+
+static const uint8_t _sizes[] = { 8, 24, 48, 100 };
+
+static char _stacks[THREADS + 1][THREAD_STACKSIZE_DEFAULT];
+static mutex_t _exit[THREADS + 1];
+static uint32_t _ops[THREADS];
+static volatile bool _done;
+
+static uint32_t _bursts;
+static uint32_t _worst;
+
+static void _finish(unsigned i)
+{
+#if IS_USED(MODULE_MALLOC_TCACHE)
+    malloc_tcache_flush();
+#endif
+    mutex_unlock(&_exit[i]);
+}
+
+static void *_worker(void *arg)
+{
+    unsigned i = (uintptr_t)arg;
+    void *live[LIVE] = { NULL };
+    uint32_t rand = i + 1;
+
+    while (!_done) {
+        /* linear congruential generator, good enough to pick sizes */
+        rand = rand * 1103515245 + 12345;
+
+        unsigned slot = (rand >> 16) % LIVE;
+
+        free(live[slot]);
+        live[slot] = malloc(_sizes[(rand >> 24) % ARRAY_SIZE(_sizes)]);
+        if (live[slot] == NULL) {
+            puts("error: out of memory");
+            break;
+        }
+        if ((++_ops[i] % 16) == 0) {
+            thread_yield();
+        }
+    }
+    for (unsigned slot = 0; slot < LIVE; slot++) {
+        free(live[slot]);
+    }
+    _finish(i);
+    return NULL;
+}
+
+static void *_high_prio(void *arg)
+{
+    (void)arg;
+    void *blocks[BURST];
+
+    while (!_done) {
+        ztimer_sleep(ZTIMER_USEC, INTERVAL_US);
+        for (unsigned i = 0; i < BURST; i++) {
+            uint32_t start = ztimer_now(ZTIMER_USEC);
+
+            blocks[i] = malloc(_sizes[i % ARRAY_SIZE(_sizes)]);
+
+            uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+            if (time > _worst) {
+                _worst = time;
+            }
+        }
+        for (unsigned i = 0; i < BURST; i++) {
+            free(blocks[i]);
+        }
+        _bursts++;
+    }
+    _finish(THREADS);
+    return NULL;
+}
+
+int main(void)
+{
+    printf("%u threads, %s\n", THREADS,
+           IS_USED(MODULE_MALLOC_TCACHE) ? "thread caches" : "heap only");
+
+    for (unsigned i = 0; i <= THREADS; i++) {
+        _exit[i] = (mutex_t)MUTEX_INIT_LOCKED;
+    }
+    thread_create(_stacks[THREADS], sizeof(_stacks[THREADS]),
+                  THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                  _high_prio, NULL, "high_prio");
+    for (unsigned i = 0; i < THREADS; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]),
+                      THREAD_PRIORITY_MAIN + 1, THREAD_CREATE_STACKTEST,
+                      _worker, (void *)(uintptr_t)i, "worker");
+    }
+
+    ztimer_sleep(ZTIMER_USEC, TEST_DURATION);
+    _done = true;
+    for (unsigned i = 0; i <= THREADS; i++) {
+        mutex_lock(&_exit[i]);
+    }
+
+    uint64_t ops = 0;
+
+    for (unsigned i = 0; i < THREADS; i++) {
+        ops += _ops[i];
+    }
+    if (ops == 0) {
+        puts("error: no allocations");
+        return 1;
+    }
+    printf("allocations: %" PRIu32 "/s, %" PRIu32 " ns each\n",
+           (uint32_t)(ops * US_PER_SEC / TEST_DURATION),
+           (uint32_t)((uint64_t)TEST_DURATION * NS_PER_US / ops));
+    printf("high priority: %" PRIu32 " bursts, worst allocation %" PRIu32
+           " us\n", _bursts, _worst);
+#if IS_USED(MODULE_MALLOC_TCACHE)
+    malloc_tcache_print_stats();
+#endif
+
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Wakeup latency of select(), poll() and epoll_wait()
+ *
+ * The main thread watches a number of UDP sockets for readability. A sender
+ * thread of lower priority sends one datagram at a time over the IPv6
+ * loopback address to one of them, round robin. The time from sending until
+ * the main thread knows which socket is ready is the wakeup latency. The
+ * part of it that is spent in the network stack does not depend on the
+ * number of watched sockets.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include "mutex.h"
+#include "timex.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_FDS
+#define NUMOF_FDS           (64U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS              (256U)
+#endif
+
+#define PORT_BASE           (4700U)
+#define TIMEOUT_MS          (1000U)
+
+enum {
+    METHOD_SELECT,
+    METHOD_POLL,
+    METHOD_EPOLL,
+};
+
+static const char *_method_names[] = { "select", "poll", "epoll" };
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static int _fds[NUMOF_FDS];
+static struct pollfd _pollfds[NUMOF_FDS];
+static int _tx;
+static int _epfd;
+
+static mutex_t _start = MUTEX_INIT_LOCKED;
+static volatile unsigned _numof;
+static volatile unsigned _target;
+static volatile uint32_t _sent_at;
+
+static void *_sender(void *arg)
+{
+    struct sockaddr_in6 dst = { .sin6_family = AF_INET6,
+                                .sin6_addr = IN6ADDR_LOOPBACK_INIT };
+    uint8_t payload = 0;
+
+    (void)arg;
+    while (1) {
+        mutex_lock(&_start);
+        /* main has a higher priority, so it is waiting again whenever we
+         * get here */
+        for (unsigned i = 0; i < ROUNDS; i++) {
+            _target = i % _numof;
+            dst.sin6_port = htons(PORT_BASE + _target);
+            _sent_at = ztimer_now(ZTIMER_USEC);
+            sendto(_tx, &payload, sizeof(payload), 0,
+                   (struct sockaddr *)&dst, sizeof(dst));
+        }
+    }
+    return NULL;
+}
+
+/* returns the index of the ready socket */
+static int _wait(int method, unsigned numof)
+{
+    switch (method) {
+    case METHOD_SELECT: {
+        struct timeval tv = { .tv_sec = TIMEOUT_MS / MS_PER_SEC };
+        fd_set readfds;
+        int max_fd = 0;
+
+        FD_ZERO(&readfds);
+        for (unsigned i = 0; i < numof; i++) {
+            FD_SET(_fds[i], &readfds);
+            max_fd = (_fds[i] > max_fd) ? _fds[i] : max_fd;
+        }
+        if (select(max_fd + 1, &readfds, NULL, NULL, &tv) <= 0) {
+            return -1;
+        }
+        for (unsigned i = 0; i < numof; i++) {
+            if (FD_ISSET(_fds[i], &readfds)) {
+                return i;
+            }
+        }
+        return -1;
+    }
+    case METHOD_POLL:
+        if (poll(_pollfds, numof, TIMEOUT_MS) <= 0) {
+            return -1;
+        }
+        for (unsigned i = 0; i < numof; i++) {
+            if (_pollfds[i].revents & POLLIN) {
+                return i;
+            }
+        }
+        return -1;
+    case METHOD_EPOLL: {
+        struct epoll_event ev;
+
+        if (epoll_wait(_epfd, &ev, 1, TIMEOUT_MS) <= 0) {
+            return -1;
+        }
+        return ev.data.u32;
+    }
+    default:
+        return -1;
+    }
+}
+
+static void _run(int method, unsigned numof)
+{
+    uint64_t sum = 0;
+    uint32_t max = 0;
+    uint8_t buf[4];
+
+    if (method == METHOD_EPOLL) {
+        for (unsigned i = 0; i < numof; i++) {
+            struct epoll_event ev = { .events = EPOLLIN, .data.u32 = i };
+            expect(epoll_ctl(_epfd, EPOLL_CTL_ADD, _fds[i], &ev) == 0);
+        }
+    }
+    _numof = numof;
+    mutex_unlock(&_start);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        int idx = _wait(method, numof);
+        uint32_t latency = ztimer_now(ZTIMER_USEC) - _sent_at;
+
+        expect(idx == (int)_target);
+        expect(recv(_fds[idx], buf, sizeof(buf), 0) == 1);
+        sum += latency;
+        max = (latency > max) ? latency : max;
+    }
+    if (method == METHOD_EPOLL) {
+        for (unsigned i = 0; i < numof; i++) {
+            expect(epoll_ctl(_epfd, EPOLL_CTL_DEL, _fds[i], NULL) == 0);
+        }
+    }
+    printf("%s: %2u fds, %" PRIu32 " us avg, %" PRIu32 " us max\n",
+           _method_names[method], numof, (uint32_t)(sum / ROUNDS), max);
+}
+
+int main(void)
+{
+    struct sockaddr_in6 local = { .sin6_family = AF_INET6,
+                                  .sin6_addr = IN6ADDR_ANY_INIT };
+    struct pollfd tx_pollfd;
+
+    for (unsigned i = 0; i < NUMOF_FDS; i++) {
+        _fds[i] = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+        expect(_fds[i] >= 0);
+        local.sin6_port = htons(PORT_BASE + i);
+        expect(bind(_fds[i], (struct sockaddr *)&local, sizeof(local)) == 0);
+        _pollfds[i].fd = _fds[i];
+        _pollfds[i].events = POLLIN;
+    }
+    _tx = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+    expect(_tx >= 0);
+    _epfd = epoll_create1(0);
+    expect(_epfd >= 0);
+
+    /* sending datagrams never blocks, nothing was received yet */
+    tx_pollfd.fd = _tx;
+    tx_pollfd.events = POLLIN | POLLOUT;
+    expect(poll(&tx_pollfd, 1, 0) == 1);
+    expect(tx_pollfd.revents == POLLOUT);
+
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1,
+                  THREAD_CREATE_STACKTEST, _sender, NULL, "sender");
+
+    for (unsigned numof = 4; numof <= NUMOF_FDS; numof *= 2) {
+        for (int method = METHOD_SELECT; method <= METHOD_EPOLL; method++) {
+            _run(method, numof);
+        }
+    }
+    puts("DONE");
+    return 0;
+}
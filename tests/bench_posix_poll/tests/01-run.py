@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    numof = 4
+    while True:
+        idx = child.expect([r"select: +(\d+) fds", "DONE"])
+        if idx == 1:
+            break
+        assert int(child.match.group(1)) == numof
+        for name in ("poll", "epoll"):
+            child.expect(r"{}: +{} fds, \d+ us avg, \d+ us max"
+                         .format(name, numof))
+        numof *= 2
+    assert numof > 4
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       UDP flood benchmark comparing single and batched sock_udp calls
+ *
+ * The main thread floods a receiver thread over the IPv6 loopback address
+ * in bursts that fit into the receive queue of the sock. Each burst is sent
+ * either with one sock_udp_send() per datagram or with one
+ * sock_udp_send_many(), and received either with one sock_udp_recv() per
+ * datagram or with one sock_udp_recv_many().
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "net/sock/udp.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef DATAGRAMS
+#define DATAGRAMS           (2000U)
+#endif
+
+#define PORT                (4711U)
+#define PAYLOAD_SIZE        (32U)
+/* a burst must fit into the receive queue of the sock */
+#define BURST               (GNRC_SOCK_MBOX_SIZE)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static sock_udp_t _rx_sock;
+static sock_udp_t _tx_sock;
+static uint8_t _rx_bufs[BURST][PAYLOAD_SIZE];
+static sock_udp_rx_msg_t _rx_msgs[BURST];
+static uint8_t _payload[PAYLOAD_SIZE];
+static sock_udp_tx_msg_t _tx_msgs[BURST];
+
+/* [::1]:PORT */
+static const sock_udp_ep_t _remote = { .family = AF_INET6,
+                                       .addr = { .ipv6 = { [15] = 1 } },
+                                       .port = PORT };
+
+static mutex_t _burst_done = MUTEX_INIT_LOCKED;
+static volatile unsigned _received;
+static volatile unsigned _target;
+static volatile bool _many;
+
+static void *_receiver(void *arg)
+{
+    (void)arg;
+
+    for (unsigned i = 0; i < BURST; i++) {
+        _rx_msgs[i].data = _rx_bufs[i];
+        _rx_msgs[i].max_len = sizeof(_rx_bufs[i]);
+    }
+    while (1) {
+        int res;
+
+        if (_many) {
+            res = sock_udp_recv_many(&_rx_sock, _rx_msgs, BURST,
+                                     SOCK_NO_TIMEOUT);
+        }
+        else {
+            res = sock_udp_recv(&_rx_sock, _rx_bufs[0], sizeof(_rx_bufs[0]),
+                                SOCK_NO_TIMEOUT, NULL);
+            res = (res < 0) ? res : 1;
+        }
+        if (res < 0) {
+            printf("receive error: %d\n", res);
+            continue;
+        }
+        _received += res;
+        if (_received >= _target) {
+            mutex_unlock(&_burst_done);
+        }
+    }
+    return NULL;
+}
+
+static void _run(const char *name, bool many)
+{
+    unsigned sent = 0;
+    uint32_t start;
+
+    _many = many;
+    _received = 0;
+    _target = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    while (sent < DATAGRAMS) {
+        unsigned burst = (DATAGRAMS - sent < BURST) ? DATAGRAMS - sent : BURST;
+
+        _target += burst;
+        if (many) {
+            int res = sock_udp_send_many(&_tx_sock, _tx_msgs, burst);
+            if (res < 0) {
+                printf("send error: %d\n", res);
+                return;
+            }
+            /* the rest of a short batch is lost, so don't wait for it */
+            _target -= burst - res;
+            sent += burst;
+        }
+        else {
+            for (unsigned i = 0; i < burst; i++) {
+                if (sock_udp_send(&_tx_sock, _payload, sizeof(_payload),
+                                  NULL) < 0) {
+                    _target--;
+                }
+                sent++;
+            }
+        }
+        /* the receiver has a lower priority, so it drains the burst now */
+        mutex_lock(&_burst_done);
+    }
+    uint32_t usec = ztimer_now(ZTIMER_USEC) - start;
+    uint64_t rate = usec ? ((uint64_t)_received * US_PER_SEC) / usec : 0;
+
+    printf("%s: %u datagrams in %" PRIu32 " us, %" PRIu32 " datagrams/s\n",
+           name, _received, usec, (uint32_t)rate);
+}
+
+int main(void)
+{
+    const sock_udp_ep_t local = { .family = AF_INET6, .port = PORT };
+
+    if ((sock_udp_create(&_rx_sock, &local, NULL, 0) < 0) ||
+        (sock_udp_create(&_tx_sock, NULL, &_remote, 0) < 0)) {
+        puts("unable to create socks");
+        return 1;
+    }
+    for (unsigned i = 0; i < BURST; i++) {
+        _tx_msgs[i].data = _payload;
+        _tx_msgs[i].len = sizeof(_payload);
+    }
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1,
+                  THREAD_CREATE_STACKTEST, _receiver, NULL, "receiver");
+
+    _run("single", false);
+    _run("many", true);
+    puts("DONE");
+    return 0;
+}
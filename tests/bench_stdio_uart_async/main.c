@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the time log output stalls a thread
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "stdio_uart.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define LINES           (100U)
+#define BURST           (10U)
+#define INTERVAL_US     (20000U)
+
+static char _stack[THREAD_STACKSIZE_MAIN];
+static mutex_t _done = MUTEX_INIT_LOCKED;
+
+static uint32_t _total;
+static uint32_t _worst;
+static uint32_t _burst;
+
+static uint32_t _log(unsigned num)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    /* 64 characters with the newline */
+    printf("log %04u: the quick brown fox jumps over the lazy dog 012345678\n",
+           num);
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static void *_logger(void *arg)
+{
+    (void)arg;
+
+    for (unsigned i = 0; i < LINES; i++) {
+        ztimer_sleep(ZTIMER_USEC, INTERVAL_US);
+
+        uint32_t time = _log(i);
+
+        _total += time;
+        if (time > _worst) {
+            _worst = time;
+        }
+    }
+
+    /* let the buffer drain */
+    ztimer_sleep(ZTIMER_USEC, INTERVAL_US);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < BURST; i++) {
+        _log(i);
+    }
+    _burst = ztimer_now(ZTIMER_USEC) - start;
+
+    mutex_unlock(&_done);
+    return NULL;
+}
+
+int main(void)
+{
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _logger, NULL, "logger");
+    mutex_lock(&_done);
+
+    printf("periodic: %u lines, %" PRIu32 " us average, %" PRIu32
+           " us worst\n", LINES, _total / LINES, _worst);
+    printf("burst: %u lines in %" PRIu32 " us\n", BURST, _burst);
+    printf("lost: %u bytes\n", stdio_uart_dropped());
+
+    puts("DONE");
+    return 0;
+}
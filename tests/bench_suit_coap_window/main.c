@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the windowed SUIT CoAP block-wise transfer
+ *
+ * A thread serves an image over the loopback interface and emulates a lossy
+ * link with a long round trip time. The image is fetched with one request at
+ * a time and with a window of @ref CONFIG_SUIT_COAP_WINDOW requests.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ipv6/addr.h"
+#include "net/nanocoap.h"
+#include "net/sock/udp.h"
+#include "random.h"
+#include "suit/transport/coap.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef IMAGE_SIZE
+#define IMAGE_SIZE          (8192U)
+#endif
+
+#ifndef RTT
+#define RTT                 (50U)
+#endif
+
+#ifndef LOSS
+#define LOSS                (2U)
+#endif
+
+#define BLKSIZE             COAP_BLOCKSIZE_64
+#define BLKLEN              (0x1 << (BLKSIZE + 4))
+#define PDU_SIZE            (64 + BLKLEN)
+#define QUEUE_SIZE          (2 * CONFIG_SUIT_COAP_WINDOW)
+
+typedef struct {
+    sock_udp_ep_t remote;
+    uint32_t due;
+    uint16_t len;
+    uint8_t pdu[PDU_SIZE];
+} _response_t;
+
+static uint8_t _image[IMAGE_SIZE];
+static _response_t _queue[QUEUE_SIZE];
+static char _link_stack[THREAD_STACKSIZE_DEFAULT + PDU_SIZE];
+static unsigned _lost;
+
+static ssize_t _image_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                              void *context)
+{
+    (void)context;
+    coap_block_slicer_t slicer;
+
+    coap_block2_init(pkt, &slicer);
+    if (slicer.start >= sizeof(_image)) {
+        return coap_reply_simple(pkt, COAP_CODE_BAD_OPTION, buf, len, 0,
+                                 NULL, 0);
+    }
+
+    uint8_t *payload = buf + coap_get_total_hdr_len(pkt);
+    uint8_t *bufpos = payload;
+
+    bufpos += coap_put_option_ct(bufpos, 0, COAP_FORMAT_OCTET);
+    bufpos += coap_opt_put_block2(bufpos, COAP_OPT_CONTENT_FORMAT, &slicer, 1);
+    *bufpos++ = 0xff;
+    bufpos += coap_blockwise_put_bytes(&slicer, bufpos, _image,
+                                       sizeof(_image));
+
+    return coap_block2_build_reply(pkt, COAP_CODE_205, buf, len,
+                                   bufpos - payload, &slicer);
+}
+
+const coap_resource_t coap_resources[] = {
+    { "/image", COAP_GET, _image_handler, NULL },
+};
+
+const unsigned coap_resources_numof = ARRAY_SIZE(coap_resources);
+
+static bool _drop(void)
+{
+    if (random_uint32_range(0, 100) < LOSS) {
+        _lost++;
+        return true;
+    }
+    return false;
+}
+
+static void *_link(void *arg)
+{
+    (void)arg;
+    sock_udp_ep_t local = { .family = AF_INET6, .port = COAP_PORT };
+    uint8_t buf[PDU_SIZE];
+    sock_udp_t sock;
+
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+    while (1) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+        uint32_t timeout = SOCK_NO_TIMEOUT;
+        sock_udp_ep_t remote;
+        coap_pkt_t pkt;
+        ssize_t res;
+
+        /* send the responses that have spent the round trip on the link */
+        for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+            _response_t *resp = &_queue[i];
+            int32_t left = resp->due - now;
+
+            if (resp->len == 0) {
+                continue;
+            }
+            if (left > 0) {
+                if ((uint32_t)left < timeout) {
+                    timeout = left;
+                }
+                continue;
+            }
+            if (!_drop()) {
+                sock_udp_send(&sock, resp->pdu, resp->len, &resp->remote);
+            }
+            resp->len = 0;
+        }
+
+        res = sock_udp_recv(&sock, buf, sizeof(buf), timeout, &remote);
+        if ((res <= 0) || _drop() || (coap_parse(&pkt, buf, res) < 0)) {
+            continue;
+        }
+        for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+            _response_t *resp = &_queue[i];
+
+            if (resp->len != 0) {
+                continue;
+            }
+            res = coap_handle_req(&pkt, resp->pdu, sizeof(resp->pdu));
+            if (res > 0) {
+                resp->remote = remote;
+                resp->due = ztimer_now(ZTIMER_USEC) + RTT * US_PER_MS;
+                resp->len = res;
+            }
+            break;
+        }
+    }
+    return NULL;
+}
+
+static int _check_block(void *arg, size_t offset, uint8_t *buf, size_t len,
+                        int more)
+{
+    size_t *received = arg;
+
+    if ((offset != *received) || (offset + len > sizeof(_image)) ||
+        (memcmp(&_image[offset], buf, len) != 0) ||
+        ((more == 0) != (offset + len == sizeof(_image)))) {
+        printf("unexpected block at %u\n", (unsigned)offset);
+        return -1;
+    }
+    *received += len;
+    return 0;
+}
+
+static void _fetch(unsigned window)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = COAP_PORT };
+    size_t received = 0;
+    unsigned lost = _lost;
+    uint32_t start, usec;
+    int res;
+
+    memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+    start = ztimer_now(ZTIMER_USEC);
+    res = suit_coap_get_blockwise_window(&remote, "/image", BLKSIZE, window,
+                                         _check_block, &received);
+    usec = ztimer_now(ZTIMER_USEC) - start;
+    expect(res == 0);
+    expect(received == sizeof(_image));
+
+    uint32_t rate = usec ? (uint32_t)(((uint64_t)received * US_PER_SEC) /
+                                      usec) : 0;
+
+    printf("fetch (window %u): %u bytes in %" PRIu32 " us, %" PRIu32
+           " bytes/s, %u lost\n", window, (unsigned)received, usec, rate,
+           _lost - lost);
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_image); i++) {
+        _image[i] = i ^ (i >> 8);
+    }
+    thread_create(_link_stack, sizeof(_link_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _link, NULL, "link");
+
+    _fetch(1);
+    _fetch(CONFIG_SUIT_COAP_WINDOW);
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    usec = {}
+    for _ in range(2):
+        child.expect(r"fetch \(window (\d+)\): (\d+) bytes in (\d+) us, "
+                     r"\d+ bytes/s, (\d+) lost")
+        window = int(child.match.group(1))
+        assert int(child.match.group(2)) > 0
+        usec[window] = int(child.match.group(3))
+    assert len(usec) == 2
+    assert usec[max(usec)] < usec[1]
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for decompressing SUIT payloads
+ *
+ * Compresses the start of the firmware itself with heatshrink and measures
+ * decompressing it in CoAP block sized parts with @ref sys_suit_decompress.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "heatshrink_encoder.h"
+#include "suit/decompress.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef IMAGE_SIZE
+#define IMAGE_SIZE          (32768U)
+#endif
+
+#ifndef RTT
+#define RTT                 (50U)
+#endif
+
+#define BLOCK_SIZE          (64U)
+/* a literal takes 9 bits */
+#define COMPRESSED_MAX      (IMAGE_SIZE + IMAGE_SIZE / 8 + 1)
+
+#ifdef BOARD_NATIVE
+/* the flash of native is emulated, take the text of the process instead */
+extern const uint8_t __executable_start[];
+#define IMAGE               (__executable_start)
+#else
+#define IMAGE               ((const uint8_t *)CPU_FLASH_BASE)
+#endif
+
+static heatshrink_encoder _encoder;
+static suit_decompress_t _decompress;
+static uint8_t _compressed[COMPRESSED_MAX];
+
+static size_t _compress(void)
+{
+    size_t in = 0, out = 0, len;
+
+    heatshrink_encoder_reset(&_encoder);
+    while (in < IMAGE_SIZE) {
+        expect(heatshrink_encoder_sink(&_encoder, (uint8_t *)&IMAGE[in],
+                                       IMAGE_SIZE - in, &len) >= 0);
+        in += len;
+        do {
+            expect(out < sizeof(_compressed));
+            heatshrink_encoder_poll(&_encoder, &_compressed[out],
+                                    sizeof(_compressed) - out, &len);
+            out += len;
+        } while (len > 0);
+    }
+    while (heatshrink_encoder_finish(&_encoder) == HSER_FINISH_MORE) {
+        expect(out < sizeof(_compressed));
+        heatshrink_encoder_poll(&_encoder, &_compressed[out],
+                                sizeof(_compressed) - out, &len);
+        out += len;
+    }
+    return out;
+}
+
+static int _check(void *arg, size_t offset, uint8_t *buf, size_t len,
+                  int more)
+{
+    size_t *done = arg;
+
+    if ((offset != *done) || (offset + len > IMAGE_SIZE) ||
+        (memcmp(&IMAGE[offset], buf, len) != 0) ||
+        (!more && (offset + len != IMAGE_SIZE))) {
+        printf("unexpected data at %u\n", (unsigned)offset);
+        return -1;
+    }
+    *done += len;
+    return 0;
+}
+
+static unsigned _blocks(size_t len)
+{
+    return (len + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+int main(void)
+{
+    size_t compressed = _compress();
+    size_t done = 0;
+    uint32_t start, usec;
+
+    start = ztimer_now(ZTIMER_USEC);
+    suit_decompress_init(&_decompress, _check, &done);
+    for (size_t offset = 0; offset < compressed; offset += BLOCK_SIZE) {
+        size_t len = (compressed - offset < BLOCK_SIZE) ? compressed - offset
+                                                        : BLOCK_SIZE;
+
+        expect(suit_decompress_write(&_decompress, offset,
+                                     &_compressed[offset], len,
+                                     offset + len < compressed) == 0);
+    }
+    usec = ztimer_now(ZTIMER_USEC) - start;
+    expect(done == IMAGE_SIZE);
+
+    printf("image: %u bytes, %u blocks\n", IMAGE_SIZE, _blocks(IMAGE_SIZE));
+    printf("compressed: %u bytes, %u blocks, %u%% saved\n",
+           (unsigned)compressed, _blocks(compressed),
+           (unsigned)(100 - (100 * compressed) / IMAGE_SIZE));
+    printf("decompress: %" PRIu32 " us, %" PRIu32 " ns/byte\n", usec,
+           (uint32_t)(((uint64_t)usec * NS_PER_US) / IMAGE_SIZE));
+    printf("saved at %u ms RTT: %" PRIi32 " ms\n", RTT,
+           (int32_t)((_blocks(IMAGE_SIZE) - _blocks(compressed)) * RTT) -
+           (int32_t)(usec / US_PER_MS));
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"image: (\d+) bytes, (\d+) blocks")
+    size = int(child.match.group(1))
+    blocks = int(child.match.group(2))
+    child.expect(r"compressed: (\d+) bytes, (\d+) blocks")
+    assert int(child.match.group(1)) < size
+    assert int(child.match.group(2)) < blocks
+    child.expect(r"decompress: \d+ us, \d+ ns/byte")
+    child.expect(r"saved at \d+ ms RTT: -?\d+ ms")
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -27,7 +27,14 @@
 
 #define MIN(a, b) (a < b) ? a : b
 
+#define LARGE_SIZE  (768U)                      /**< multiple of 3 */
+#define LARGE_B64   (LARGE_SIZE / 3 * 4)
+
 static char buf[128];
+static char hexbuf[2 * 96 + 1];
+static uint8_t large[LARGE_SIZE];
+static uint8_t large_out[LARGE_SIZE];
+static char large_b64[LARGE_B64];
 
 static const char input[96] = "This is an extremely, enormously, greatly, "
                               "immensely, tremendously, remarkably lengthy "
@@ -95,5 +102,100 @@ int main(void) {
     print_str("Decoding 1.000 x 96 bytes (128 bytes in base64): ");
     print_u32_dec(stop - start);
     print_str(" µs\n");
+
+    for (unsigned i = 0; i < LARGE_SIZE; i++) {
+        large[i] = i * 7 + (i >> 8);
+    }
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < 100; i++) {
+        size = sizeof(large_b64);
+        base64_encode(large, sizeof(large), large_b64, &size);
+    }
+    stop = xtimer_now_usec();
+
+    print_str("Encoding 100 x 768 bytes: ");
+    print_u32_dec(stop - start);
+    print_str(" µs\n");
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < 100; i++) {
+        size = sizeof(large_out);
+        base64_decode(large_b64, sizeof(large_b64), large_out, &size);
+    }
+    stop = xtimer_now_usec();
+
+    print_str("Decoding 100 x 768 bytes: ");
+    print_u32_dec(stop - start);
+    print_str(" µs\n");
+
+    /* streaming in chunks that are not a multiple of the group sizes */
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < 100; i++) {
+        base64_encoder_t enc;
+        size_t pos = 0;
+        base64_encoder_init(&enc, false);
+        for (unsigned j = 0; j < LARGE_SIZE; j += 100) {
+            size = sizeof(large_b64) - pos;
+            base64_encoder_update(&enc, &large[j], MIN(100U, LARGE_SIZE - j),
+                                  &large_b64[pos], &size);
+            pos += size;
+        }
+        size = sizeof(large_b64) - pos;
+        base64_encoder_finish(&enc, &large_b64[pos], &size);
+    }
+    stop = xtimer_now_usec();
+
+    print_str("Stream encoding 100 x 768 bytes: ");
+    print_u32_dec(stop - start);
+    print_str(" µs\n");
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < 100; i++) {
+        base64_decoder_t dec;
+        size_t pos = 0;
+        base64_decoder_init(&dec);
+        for (unsigned j = 0; j < LARGE_B64; j += 101) {
+            size = sizeof(large_out) - pos;
+            base64_decoder_update(&dec, &large_b64[j], MIN(101U, LARGE_B64 - j),
+                                  &large_out[pos], &size);
+            pos += size;
+        }
+        size = sizeof(large_out) - pos;
+        base64_decoder_finish(&dec, &large_out[pos], &size);
+    }
+    stop = xtimer_now_usec();
+
+    print_str("Stream decoding 100 x 768 bytes: ");
+    print_u32_dec(stop - start);
+    print_str(" µs\n");
+
+    print_str("Verifying large buffer round trip: ");
+    print_str(memcmp(large, large_out, sizeof(large)) ? "FAIL\n" : "OK\n");
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < 1000; i++) {
+        fmt_bytes_hex(hexbuf, (const uint8_t *)input, sizeof(input));
+    }
+    stop = xtimer_now_usec();
+    hexbuf[sizeof(hexbuf) - 1] = '\0';
+
+    print_str("Hex encoding 1.000 x 96 bytes: ");
+    print_u32_dec(stop - start);
+    print_str(" µs\n");
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < 1000; i++) {
+        fmt_hex_bytes((uint8_t *)buf, hexbuf);
+    }
+    stop = xtimer_now_usec();
+
+    print_str("Hex decoding 1.000 x 96 bytes: ");
+    print_u32_dec(stop - start);
+    print_str(" µs\n");
+
+    print_str("Verifying hex round trip: ");
+    print_str(memcmp(input, buf, sizeof(input)) ? "FAIL\n" : "OK\n");
+
     return 0;
 }
@@ -15,6 +15,14 @@ def testfunc(child):
     child.expect_exact("Verifying that base64 decoding works for benchmark input: OK\r\n")
     child.expect(r"Encoding 1\.000 x 96 bytes \(128 bytes in base64\): [0-9]+ µs\r\n")
     child.expect(r"Decoding 1\.000 x 96 bytes \(128 bytes in base64\): [0-9]+ µs\r\n")
+    child.expect(r"Encoding 100 x 768 bytes: [0-9]+ µs\r\n")
+    child.expect(r"Decoding 100 x 768 bytes: [0-9]+ µs\r\n")
+    child.expect(r"Stream encoding 100 x 768 bytes: [0-9]+ µs\r\n")
+    child.expect(r"Stream decoding 100 x 768 bytes: [0-9]+ µs\r\n")
+    child.expect_exact("Verifying large buffer round trip: OK\r\n")
+    child.expect(r"Hex encoding 1\.000 x 96 bytes: [0-9]+ µs\r\n")
+    child.expect(r"Hex decoding 1\.000 x 96 bytes: [0-9]+ µs\r\n")
+    child.expect_exact("Verifying hex round trip: OK\r\n")
 
 
 if __name__ == "__main__":
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the classic against the blocked Bloom filter
+ *
+ * Both filters use the same amount of memory and the same number of bits per
+ * element. The classic filter uses one hash function per bit, the blocked
+ * filter a single hash.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bitfield.h"
+#include "bloom.h"
+#include "bloom_blocked.h"
+#include "hashes.h"
+#include "kernel_defines.h"
+#include "random.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define BENCH_BLOCKS        (8U)
+#define BENCH_BITS          (BENCH_BLOCKS * CONFIG_BLOOM_BLOCK_SIZE * 8)
+#define BENCH_K             (6U)
+#define BENCH_KEY_SIZE      (16U)
+#define BENCH_ADD           (BENCH_BITS / 8)
+#define BENCH_CHECK         (4096U)
+#define BENCH_SEED          (0x83d385c0)
+
+static bloom_t bloom;
+BITFIELD(bf, BENCH_BITS);
+static hashfp_t hashes[BENCH_K] = {
+    (hashfp_t)fnv_hash, (hashfp_t)sax_hash, (hashfp_t)sdbm_hash,
+    (hashfp_t)djb2_hash, (hashfp_t)kr_hash, (hashfp_t)dek_hash,
+};
+
+static bloom_blocked_t bloom_blocked;
+BLOOM_BLOCKED_STORAGE(blocks, BENCH_BLOCKS);
+
+static uint8_t keys[CONFIG_BLOOM_BATCH_SIZE][BENCH_KEY_SIZE];
+
+/* generates the key sequence `seq`, members and non-members never collide */
+static void _keys_fill(uint32_t seq, bool member)
+{
+    random_init(BENCH_SEED + seq);
+    for (unsigned i = 0; i < CONFIG_BLOOM_BATCH_SIZE; i++) {
+        random_bytes(keys[i], BENCH_KEY_SIZE);
+        keys[i][0] = member ? 0xaa : 0x55;
+    }
+}
+
+static void _print_result(const char *name, uint32_t time, unsigned ops)
+{
+    printf("%s: %" PRIu32 " us, %" PRIu32 " ops/s\n", name, time,
+           (uint32_t)(((uint64_t)ops * US_PER_SEC) / (time ? time : 1)));
+}
+
+static void _print_fp(const char *name, unsigned fp)
+{
+    printf("%s false positives: %u / %u\n", name, fp, BENCH_CHECK);
+}
+
+int main(void)
+{
+    uint32_t start, time = 0;
+    unsigned fp;
+
+    printf("m: %u bits, k: %u, n: %u, block size: %u\n", BENCH_BITS, BENCH_K,
+           BENCH_ADD, CONFIG_BLOOM_BLOCK_SIZE);
+
+    /* key generation is excluded from the measurement */
+    bloom_init(&bloom, BENCH_BITS, bf, hashes, BENCH_K);
+    for (unsigned i = 0; i < BENCH_ADD; i += CONFIG_BLOOM_BATCH_SIZE) {
+        _keys_fill(i, true);
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < CONFIG_BLOOM_BATCH_SIZE; j++) {
+            bloom_add(&bloom, keys[j], BENCH_KEY_SIZE);
+        }
+        time += ztimer_now(ZTIMER_USEC) - start;
+    }
+    _print_result("classic add", time, BENCH_ADD);
+
+    time = 0;
+    fp = 0;
+    for (unsigned i = 0; i < BENCH_CHECK; i += CONFIG_BLOOM_BATCH_SIZE) {
+        _keys_fill(i, false);
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < CONFIG_BLOOM_BATCH_SIZE; j++) {
+            fp += bloom_check(&bloom, keys[j], BENCH_KEY_SIZE);
+        }
+        time += ztimer_now(ZTIMER_USEC) - start;
+    }
+    _print_result("classic check", time, BENCH_CHECK);
+    _print_fp("classic", fp);
+
+    time = 0;
+    bloom_blocked_init(&bloom_blocked, blocks, BENCH_BLOCKS, BENCH_K,
+                       (hashfp_t)fnv_hash);
+    for (unsigned i = 0; i < BENCH_ADD; i += CONFIG_BLOOM_BATCH_SIZE) {
+        _keys_fill(i, true);
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < CONFIG_BLOOM_BATCH_SIZE; j++) {
+            bloom_blocked_add(&bloom_blocked, keys[j], BENCH_KEY_SIZE);
+        }
+        time += ztimer_now(ZTIMER_USEC) - start;
+    }
+    _print_result("blocked add", time, BENCH_ADD);
+
+    time = 0;
+    fp = 0;
+    for (unsigned i = 0; i < BENCH_CHECK; i += CONFIG_BLOOM_BATCH_SIZE) {
+        _keys_fill(i, false);
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < CONFIG_BLOOM_BATCH_SIZE; j++) {
+            fp += bloom_blocked_check(&bloom_blocked, keys[j], BENCH_KEY_SIZE);
+        }
+        time += ztimer_now(ZTIMER_USEC) - start;
+    }
+    _print_result("blocked check", time, BENCH_CHECK);
+    _print_fp("blocked", fp);
+
+    const uint8_t *bufs[CONFIG_BLOOM_BATCH_SIZE];
+    size_t lens[CONFIG_BLOOM_BATCH_SIZE];
+    bool res[CONFIG_BLOOM_BATCH_SIZE];
+    for (unsigned j = 0; j < CONFIG_BLOOM_BATCH_SIZE; j++) {
+        bufs[j] = keys[j];
+        lens[j] = BENCH_KEY_SIZE;
+    }
+
+    time = 0;
+    fp = 0;
+    for (unsigned i = 0; i < BENCH_CHECK; i += CONFIG_BLOOM_BATCH_SIZE) {
+        _keys_fill(i, false);
+        start = ztimer_now(ZTIMER_USEC);
+        fp += bloom_blocked_check_many(&bloom_blocked, bufs, lens,
+                                       CONFIG_BLOOM_BATCH_SIZE, res);
+        time += ztimer_now(ZTIMER_USEC) - start;
+    }
+    _print_result("blocked batched check", time, BENCH_CHECK);
+    _print_fp("blocked batched", fp);
+
+    /* all members must be found */
+    unsigned missing = 0;
+    for (unsigned i = 0; i < BENCH_ADD; i += CONFIG_BLOOM_BATCH_SIZE) {
+        _keys_fill(i, true);
+        missing += CONFIG_BLOOM_BATCH_SIZE -
+                   bloom_blocked_check_many(&bloom_blocked, bufs, lens,
+                                            CONFIG_BLOOM_BATCH_SIZE, res);
+    }
+    printf("false negatives: %u\n", missing);
+
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"m: \d+ bits, k: \d+, n: \d+, block size: \d+")
+    for name in ("classic", "blocked"):
+        child.expect(name + r" add: \d+ us, \d+ ops/s")
+        child.expect(name + r" check: \d+ us, \d+ ops/s")
+        child.expect(name + r" false positives: \d+ / \d+")
+    child.expect(r"blocked batched check: \d+ us, \d+ ops/s")
+    child.expect(r"blocked batched false positives: \d+ / \d+")
+    child.expect_exact("false negatives: 0")
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
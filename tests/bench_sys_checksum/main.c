@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the generic CRC engine
+ *
+ * Prints the throughput of every implementation strategy for a selection of
+ * CRC algorithms, so the speed/memory trade-off can be judged per board.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "checksum/crc.h"
+#include "fmt.h"
+#include "kernel_defines.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef BENCH_BUF_SIZE
+#define BENCH_BUF_SIZE      (1024U)
+#endif
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (64U)
+#endif
+
+static uint8_t _buf[BENCH_BUF_SIZE];
+static uint32_t _table[CRC_TABLE_LEN(CRC_MODE_SLICE8)];
+
+static const struct {
+    const char *name;
+    const crc_params_t *params;
+    uint32_t check;
+} _algos[] = {
+    { "CRC-8",              &crc_params_crc8,               0xf4 },
+    { "CRC-16/CCITT-FALSE", &crc_params_crc16_ccitt_false,  0x29b1 },
+    { "CRC-16/KERMIT",      &crc_params_crc16_kermit,       0x2189 },
+    { "CRC-32",             &crc_params_crc32,              0xcbf43926 },
+    { "CRC-32C",            &crc_params_crc32c,             0xe3069283 },
+};
+
+static const struct {
+    const char *name;
+    crc_mode_t mode;
+} _modes[] = {
+    { "bitwise", CRC_MODE_BITWISE },
+    { "nibble",  CRC_MODE_NIBBLE },
+    { "table",   CRC_MODE_TABLE },
+    { "slice4",  CRC_MODE_SLICE4 },
+    { "slice8",  CRC_MODE_SLICE8 },
+};
+
+int main(void)
+{
+    int failed = 0;
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i;
+    }
+
+    for (unsigned a = 0; a < ARRAY_SIZE(_algos); a++) {
+        for (unsigned m = 0; m < ARRAY_SIZE(_modes); m++) {
+            crc_engine_t engine;
+            volatile uint32_t sink;
+
+            crc_table_generate(_algos[a].params, _modes[m].mode, _table);
+            crc_engine_init(&engine, _algos[a].params, _modes[m].mode, _table);
+
+            print_str(_algos[a].name);
+            print_str(" ");
+            print_str(_modes[m].name);
+            print_str(": ");
+
+            /* self test, so the benchmark loop does not need to check */
+            if (crc_calc(&engine, "123456789", 9) != _algos[a].check) {
+                print_str("FAIL\n");
+                failed = 1;
+                continue;
+            }
+
+            uint32_t start = ztimer_now(ZTIMER_USEC);
+            for (unsigned r = 0; r < BENCH_RUNS; r++) {
+                sink = crc_calc(&engine, _buf, sizeof(_buf));
+            }
+            uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+            (void)sink;
+
+            if (time == 0) {
+                time = 1;
+            }
+            print_u32_dec(time);
+            print_str(" us, ");
+            print_u32_dec((uint32_t)(((uint64_t)BENCH_RUNS * sizeof(_buf)
+                                      * US_PER_SEC) / (1024 * time)));
+            print_str(" KiB/s\n");
+        }
+    }
+
+    print_str(failed ? "FAILED\n" : "DONE\n");
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+ALGOS = ("CRC-8", "CRC-16/CCITT-FALSE", "CRC-16/KERMIT", "CRC-32", "CRC-32C")
+MODES = ("bitwise", "nibble", "table", "slice4", "slice8")
+
+
+def testfunc(child):
+    for algo in ALGOS:
+        for mode in MODES:
+            child.expect(r"{} {}: [0-9]+ us, [0-9]+ KiB/s\r\n".format(algo, mode))
+    child.expect_exact("DONE\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
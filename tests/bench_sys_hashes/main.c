@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for SHA-256
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hashes/sha256.h"
+#include "kernel_defines.h"
+#include "periph_conf.h"
+#include "ztimer.h"
+
+#ifndef BENCH_BUF_SIZE
+#define BENCH_BUF_SIZE      (1024U)
+#endif
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (64U)
+#endif
+
+#define BENCH_STREAMS       (4U)
+
+static uint8_t _buf[BENCH_STREAMS][BENCH_BUF_SIZE];
+
+static void _print_result(const char *name, uint32_t time, uint64_t bytes)
+{
+    if (time == 0) {
+        time = 1;
+    }
+
+    /* bytes per microsecond equals MB/s */
+    uint32_t mbps100 = (uint32_t)((bytes * 100) / time);
+    printf("%s: %" PRIu32 " us, %" PRIu32 ".%02" PRIu32 " MB/s", name, time,
+           mbps100 / 100, mbps100 % 100);
+#ifdef CLOCK_CORECLOCK
+    uint64_t cpb10 = ((uint64_t)time * (CLOCK_CORECLOCK / 1000) * 10)
+                     / (bytes * 1000);
+    printf(", %" PRIu32 ".%" PRIu32 " cycles/byte",
+           (uint32_t)(cpb10 / 10), (uint32_t)(cpb10 % 10));
+#endif
+    puts("");
+}
+
+int main(void)
+{
+    sha256_context_t ctx[BENCH_STREAMS];
+    sha256_context_t *ctx_ptr[BENCH_STREAMS];
+    const void *data[BENCH_STREAMS];
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    uint8_t expected[SHA256_DIGEST_LENGTH];
+    uint32_t start;
+
+    for (unsigned i = 0; i < BENCH_STREAMS; i++) {
+        memset(_buf[i], 'a' + i, BENCH_BUF_SIZE);
+        ctx_ptr[i] = &ctx[i];
+        data[i] = _buf[i];
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned r = 0; r < BENCH_RUNS; r++) {
+        sha256(_buf[0], BENCH_BUF_SIZE, digest);
+    }
+    _print_result("SHA-256", ztimer_now(ZTIMER_USEC) - start,
+                  (uint64_t)BENCH_RUNS * BENCH_BUF_SIZE);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned r = 0; r < BENCH_RUNS; r++) {
+        for (unsigned i = 0; i < BENCH_STREAMS; i++) {
+            sha256_init(&ctx[i]);
+        }
+        sha256_update_multi(ctx_ptr, data, BENCH_BUF_SIZE, BENCH_STREAMS);
+        for (unsigned i = 0; i < BENCH_STREAMS; i++) {
+            sha256_final(&ctx[i], digest);
+        }
+    }
+    _print_result("SHA-256 multi-buffer", ztimer_now(ZTIMER_USEC) - start,
+                  (uint64_t)BENCH_RUNS * BENCH_BUF_SIZE * BENCH_STREAMS);
+
+    /* the last stream of the multi-buffer run must match a plain hash */
+    sha256(_buf[BENCH_STREAMS - 1], BENCH_BUF_SIZE, expected);
+    puts(memcmp(expected, digest, sizeof(digest)) ? "FAILED" : "DONE");
+
+    return 0;
+}
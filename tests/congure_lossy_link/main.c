@@ -0,0 +1,451 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Lossy link simulation for the CongURE implementations
+ *
+ * Simulates confirmable CoAP exchanges and a TCP bulk transfer over a lossy
+ * link in virtual time and compares the fixed timeouts used before with
+ * @ref sys_congure_cocoa and @ref sys_congure_reno.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "congure/cocoa.h"
+#include "congure/reno.h"
+#include "random.h"
+
+#define SEED                    (0x5eed)
+
+/* CoAP parameters of RFC 7252 */
+#define COAP_ACK_TIMEOUT_MS     (2000U)
+#define COAP_RANDOM_FACTOR_1000 (1500U)
+#define COAP_MAX_RETRANSMIT     (4U)
+#define COAP_EXCHANGES          (200U)
+
+/* TCP parameters */
+#define TCP_SEGS                (300U)
+#define TCP_SEG_SIZE            (500U)
+#define TCP_RCV_WND_SEGS        (32U)
+#define TCP_RTO_MS              (1000U)
+#define TCP_EVENTS_NUMOF        (128U)
+
+typedef struct {
+    const char *name;
+    uint32_t rtt_min;       /* ms */
+    uint32_t rtt_max;       /* ms */
+    uint32_t loss;          /* permille */
+} coap_link_t;
+
+typedef struct {
+    unsigned done;
+    unsigned tx;
+    uint64_t latency;
+} coap_result_t;
+
+typedef struct {
+    uint32_t time;
+    unsigned tx;
+    unsigned timeouts;
+} tcp_result_t;
+
+static bool _lost(uint32_t loss)
+{
+    return random_uint32_range(0, 1000) < loss;
+}
+
+/*
+ * CoAP: sequential confirmable exchanges (NSTART = 1). Each transmission is
+ * answered after a random RTT unless the request or the response is lost.
+ */
+static uint32_t _coap_rtt(const coap_link_t *link)
+{
+    if (_lost(link->loss) || _lost(link->loss)) {
+        return UINT32_MAX;
+    }
+    return random_uint32_range(link->rtt_min, link->rtt_max + 1);
+}
+
+static void _coap_run(const coap_link_t *link, congure_cocoa_snd_t *cocoa,
+                      coap_result_t *res)
+{
+    uint32_t now = 1;
+
+    memset(res, 0, sizeof(*res));
+    for (unsigned i = 0; i < COAP_EXCHANGES; i++) {
+        uint32_t start = now;
+        uint32_t answer = UINT32_MAX;
+        uint32_t timeout;
+        unsigned resends = 0;
+
+        if (cocoa) {
+            timeout = congure_cocoa_snd_rto(cocoa, now);
+        }
+        else {
+            timeout = COAP_ACK_TIMEOUT_MS;
+        }
+        timeout = random_uint32_range(timeout,
+                                      timeout * COAP_RANDOM_FACTOR_1000 / 1000);
+
+        while (1) {
+            uint32_t rtt = _coap_rtt(link);
+
+            res->tx++;
+            if ((rtt != UINT32_MAX) && (now + rtt < answer)) {
+                answer = now + rtt;
+            }
+            /* response arrives before the next retransmission */
+            if (answer <= now + timeout) {
+                break;
+            }
+            if (resends == COAP_MAX_RETRANSMIT) {
+                break;
+            }
+            now += timeout;
+            resends++;
+            timeout = cocoa ? congure_cocoa_snd_backoff(cocoa, timeout)
+                            : timeout * 2;
+        }
+
+        if (answer <= now + timeout) {
+            res->done++;
+            res->latency += answer - start;
+            if (cocoa) {
+                congure_snd_msg_t msg = { .send_time = start,
+                                          .resends = resends };
+                congure_snd_ack_t ack = { .recv_time = answer };
+                cocoa->super.driver->report_msg_acked(&cocoa->super, &msg,
+                                                      &ack);
+            }
+            now = answer;
+        }
+        else {
+            now += timeout;
+        }
+    }
+}
+
+static void _coap_print(const char *name, const coap_result_t *res)
+{
+    printf("%s: %u / %u done, %u tx, %" PRIu32 " ms mean latency\n", name,
+           res->done, COAP_EXCHANGES, res->tx,
+           res->done ? (uint32_t)(res->latency / res->done) : 0);
+}
+
+static bool _coap_scenario(const coap_link_t *link)
+{
+    congure_cocoa_snd_t cocoa;
+    coap_result_t fixed_res, cocoa_res;
+
+    congure_cocoa_snd_setup(&cocoa);
+    cocoa.super.driver->init(&cocoa.super, NULL);
+
+    printf("coap %s: rtt %" PRIu32 "-%" PRIu32 " ms, loss %" PRIu32
+           " permille\n", link->name, link->rtt_min, link->rtt_max, link->loss);
+    random_init(SEED);
+    _coap_run(link, NULL, &fixed_res);
+    _coap_print("fixed", &fixed_res);
+    random_init(SEED);
+    _coap_run(link, &cocoa, &cocoa_res);
+    _coap_print("cocoa", &cocoa_res);
+
+    /* CoCoA must not lose exchanges and must be better in transmissions or
+     * latency */
+    return (cocoa_res.done >= fixed_res.done * 95 / 100) &&
+           ((cocoa_res.tx < fixed_res.tx) ||
+            (cocoa_res.latency / cocoa_res.done <
+             fixed_res.latency / fixed_res.done));
+}
+
+/*
+ * TCP: bulk transfer over a bottleneck with a drop-tail queue and random
+ * loss. As in GNRC TCP, the receiver buffers out-of-order segments and a
+ * timeout retransmits only the oldest unacknowledged segment.
+ */
+typedef enum {
+    EVT_SEG,        /* segment arrives at the receiver */
+    EVT_ACK,        /* ACK arrives at the sender */
+    EVT_RTO,        /* retransmission timer fires */
+} tcp_evt_type_t;
+
+typedef struct {
+    uint32_t time;
+    uint32_t arg;
+    tcp_evt_type_t type;
+} tcp_evt_t;
+
+typedef struct {
+    uint32_t delay;         /* one-way propagation delay in ms */
+    uint32_t ser;           /* serialization time per segment in ms */
+    uint32_t queue;         /* queue length in segments */
+    uint32_t loss;          /* permille */
+} tcp_link_t;
+
+static struct {
+    const tcp_link_t *link;
+    congure_reno_snd_t *reno;
+    tcp_evt_t evts[TCP_EVENTS_NUMOF];
+    unsigned evts_numof;
+    uint32_t now;
+    uint32_t link_free;
+    uint32_t snd_una;
+    uint32_t snd_nxt;
+    uint32_t rto;
+    uint32_t rto_gen;
+    bool rto_running;
+    uint32_t rcv_nxt;
+    bool rcvd[TCP_SEGS];
+    tcp_result_t res;
+} _tcp;
+
+static void _evt_push(uint32_t time, tcp_evt_type_t type, uint32_t arg)
+{
+    unsigned i = _tcp.evts_numof++;
+
+    assert(_tcp.evts_numof <= TCP_EVENTS_NUMOF);
+    /* sift up in the min-heap */
+    while (i > 0) {
+        unsigned parent = (i - 1) / 2;
+        if (_tcp.evts[parent].time <= time) {
+            break;
+        }
+        _tcp.evts[i] = _tcp.evts[parent];
+        i = parent;
+    }
+    _tcp.evts[i] = (tcp_evt_t){ .time = time, .type = type, .arg = arg };
+}
+
+static tcp_evt_t _evt_pop(void)
+{
+    tcp_evt_t top = _tcp.evts[0];
+    tcp_evt_t last = _tcp.evts[--_tcp.evts_numof];
+    unsigned i = 0;
+
+    /* sift down in the min-heap */
+    while (1) {
+        unsigned child = 2 * i + 1;
+        if (child >= _tcp.evts_numof) {
+            break;
+        }
+        if ((child + 1 < _tcp.evts_numof) &&
+            (_tcp.evts[child + 1].time < _tcp.evts[child].time)) {
+            child++;
+        }
+        if (last.time <= _tcp.evts[child].time) {
+            break;
+        }
+        _tcp.evts[i] = _tcp.evts[child];
+        i = child;
+    }
+    _tcp.evts[i] = last;
+    return top;
+}
+
+static void _tcp_restart_timer(void)
+{
+    _tcp.rto_gen++;
+    _tcp.rto_running = true;
+    _evt_push(_tcp.now + _tcp.rto, EVT_RTO, _tcp.rto_gen);
+}
+
+static void _tcp_xmit(uint32_t seq)
+{
+    const tcp_link_t *link = _tcp.link;
+    uint32_t start = (_tcp.link_free > _tcp.now) ? _tcp.link_free : _tcp.now;
+
+    _tcp.res.tx++;
+    /* drop tail if the queue in front of the bottleneck is full */
+    if ((start - _tcp.now) / link->ser >= link->queue) {
+        return;
+    }
+    _tcp.link_free = start + link->ser;
+    if (!_lost(link->loss)) {
+        _evt_push(_tcp.link_free + link->delay, EVT_SEG, seq);
+    }
+}
+
+static void _fast_retransmit(congure_reno_snd_t *c)
+{
+    (void)c;
+    _tcp_xmit(_tcp.snd_una);
+}
+
+static const congure_reno_snd_consts_t _reno_consts =
+    CONGURE_RENO_SND_CONSTS_INIT(_fast_retransmit, TCP_SEG_SIZE);
+
+static uint32_t _tcp_wnd(void)
+{
+    uint32_t wnd = TCP_RCV_WND_SEGS;
+
+    if (_tcp.reno) {
+        uint32_t cwnd = _tcp.reno->super.cwnd / TCP_SEG_SIZE;
+        wnd = (cwnd < wnd) ? cwnd : wnd;
+    }
+    return wnd;
+}
+
+static void _tcp_send_more(void)
+{
+    while ((_tcp.snd_nxt < TCP_SEGS) &&
+           (_tcp.snd_nxt - _tcp.snd_una < _tcp_wnd())) {
+        _tcp_xmit(_tcp.snd_nxt++);
+        if (_tcp.reno) {
+            _tcp.reno->super.driver->report_msg_sent(&_tcp.reno->super,
+                                                     TCP_SEG_SIZE);
+        }
+        if (!_tcp.rto_running) {
+            _tcp_restart_timer();
+        }
+    }
+}
+
+static void _tcp_on_seg(uint32_t seq)
+{
+    _tcp.rcvd[seq] = true;
+    while ((_tcp.rcv_nxt < TCP_SEGS) && _tcp.rcvd[_tcp.rcv_nxt]) {
+        _tcp.rcv_nxt++;
+    }
+    /* ACKs are not lost and not delayed at the bottleneck */
+    _evt_push(_tcp.now + _tcp.link->delay, EVT_ACK, _tcp.rcv_nxt);
+}
+
+static void _tcp_on_ack(uint32_t ack)
+{
+    congure_snd_ack_t ack_info = { .id = ack * TCP_SEG_SIZE, .clean = true };
+
+    if (ack > _tcp.snd_una) {
+        congure_snd_msg_t msg = { .size = (ack - _tcp.snd_una) * TCP_SEG_SIZE };
+
+        _tcp.snd_una = ack;
+        _tcp.rto = TCP_RTO_MS;
+        if (_tcp.snd_una < _tcp.snd_nxt) {
+            _tcp_restart_timer();
+        }
+        else {
+            _tcp.rto_running = false;
+        }
+        if (_tcp.reno) {
+            _tcp.reno->super.driver->report_msg_acked(&_tcp.reno->super, &msg,
+                                                      &ack_info);
+        }
+    }
+    else if ((ack == _tcp.snd_una) && (_tcp.snd_una < _tcp.snd_nxt) &&
+             _tcp.reno) {
+        congure_snd_msg_t msg = { .size = 0 };
+
+        _tcp.reno->super.driver->report_msg_acked(&_tcp.reno->super, &msg,
+                                                  &ack_info);
+    }
+    _tcp_send_more();
+}
+
+static void _tcp_on_rto(uint32_t gen)
+{
+    if (!_tcp.rto_running || (gen != _tcp.rto_gen)) {
+        /* timer was restarted or stopped meanwhile */
+        return;
+    }
+    _tcp.res.timeouts++;
+    if (_tcp.reno) {
+        clist_node_t msgs = { .next = NULL };
+        congure_snd_msg_t msg = { .size = _tcp.reno->in_flight };
+
+        clist_rpush(&msgs, &msg.super);
+        _tcp.reno->super.driver->report_msgs_timeout(&_tcp.reno->super,
+                                                     (congure_snd_msg_t *)msgs.next);
+    }
+    _tcp_xmit(_tcp.snd_una);
+    _tcp.rto *= 2;
+    _tcp_restart_timer();
+}
+
+static void _tcp_run(const tcp_link_t *link, congure_reno_snd_t *reno,
+                     tcp_result_t *res)
+{
+    memset(&_tcp, 0, sizeof(_tcp));
+    _tcp.link = link;
+    _tcp.reno = reno;
+    _tcp.rto = TCP_RTO_MS;
+    if (reno) {
+        congure_reno_snd_setup(reno, &_reno_consts);
+        reno->super.driver->init(&reno->super, NULL);
+    }
+
+    _tcp_send_more();
+    while ((_tcp.snd_una < TCP_SEGS) && (_tcp.evts_numof > 0)) {
+        tcp_evt_t evt = _evt_pop();
+
+        _tcp.now = evt.time;
+        switch (evt.type) {
+        case EVT_SEG:
+            _tcp_on_seg(evt.arg);
+            break;
+        case EVT_ACK:
+            _tcp_on_ack(evt.arg);
+            break;
+        case EVT_RTO:
+            _tcp_on_rto(evt.arg);
+            break;
+        }
+    }
+    _tcp.res.time = _tcp.now;
+    *res = _tcp.res;
+}
+
+static bool _tcp_scenario(const tcp_link_t *link)
+{
+    congure_reno_snd_t reno;
+    tcp_result_t fixed_res, reno_res;
+
+    printf("tcp: rtt %" PRIu32 " ms, %" PRIu32 " ms per segment, queue %"
+           PRIu32 ", loss %" PRIu32 " permille\n", 2 * link->delay, link->ser,
+           link->queue, link->loss);
+    random_init(SEED);
+    _tcp_run(link, NULL, &fixed_res);
+    printf("fixed window: %" PRIu32 " ms, %u tx, %u timeouts\n",
+           fixed_res.time, fixed_res.tx, fixed_res.timeouts);
+    random_init(SEED);
+    _tcp_run(link, &reno, &reno_res);
+    printf("reno: %" PRIu32 " ms, %u tx, %u timeouts\n",
+           reno_res.time, reno_res.tx, reno_res.timeouts);
+
+    return (reno_res.time < fixed_res.time) && (reno_res.tx < fixed_res.tx);
+}
+
+int main(void)
+{
+    /* a slow, lossy mesh path: the RTT exceeds the fixed initial timeout */
+    static const coap_link_t slow = {
+        .name = "slow", .rtt_min = 2000, .rtt_max = 3500, .loss = 50,
+    };
+    /* a fast, lossy path: the fixed timeout delays loss recovery */
+    static const coap_link_t fast = {
+        .name = "fast", .rtt_min = 80, .rtt_max = 200, .loss = 100,
+    };
+    static const tcp_link_t tcp_link = {
+        .delay = 50, .ser = 10, .queue = 8, .loss = 10,
+    };
+    bool success = true;
+
+    success &= _coap_scenario(&slow);
+    success &= _coap_scenario(&fast);
+    success &= _tcp_scenario(&tcp_link);
+
+    puts(success ? "SUCCESS" : "FAILURE");
+    return 0;
+}
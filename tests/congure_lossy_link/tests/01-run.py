@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for _ in range(2):
+        child.expect(r"coap .+: rtt \d+-\d+ ms, loss \d+ permille")
+        child.expect(r"fixed: \d+ / \d+ done, \d+ tx, \d+ ms mean latency")
+        child.expect(r"cocoa: \d+ / \d+ done, \d+ tx, \d+ ms mean latency")
+    child.expect(r"tcp: rtt \d+ ms, \d+ ms per segment, queue \d+, "
+                 r"loss \d+ permille")
+    child.expect(r"fixed window: \d+ ms, \d+ tx, \d+ timeouts")
+    child.expect(r"reno: \d+ ms, \d+ tx, \d+ timeouts")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
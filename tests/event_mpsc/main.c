@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test of lock-free event posting and queue statistics
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define EVENTS          (16U)
+#define FROM_THREAD     (EVENTS / 2)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static event_queue_t _queue;
+static event_t _events[EVENTS];
+static unsigned _order[EVENTS * 2];
+static unsigned _handled;
+
+static void _handler(event_t *event)
+{
+    if (_handled < ARRAY_SIZE(_order)) {
+        _order[_handled] = event - _events;
+    }
+    _handled++;
+}
+
+static void *_loop(void *arg)
+{
+    (void)arg;
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+    return NULL;
+}
+
+static void _isr_post(void *arg)
+{
+    (void)arg;
+    /* posting a queued event again does nothing */
+    for (unsigned i = FROM_THREAD; i < EVENTS; i++) {
+        event_post(&_queue, &_events[i]);
+        event_post(&_queue, &_events[i]);
+    }
+}
+
+int main(void)
+{
+    ztimer_t timer = { .callback = _isr_post };
+
+    event_queue_init_detached(&_queue);
+    event_queue_stats_register(&_queue, "test");
+    for (unsigned i = 0; i < EVENTS; i++) {
+        _events[i].handler = _handler;
+    }
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _loop, NULL, "loop");
+
+    /* the loop thread preempts main after each post */
+    for (unsigned i = 0; i < FROM_THREAD; i++) {
+        event_post(&_queue, &_events[i]);
+    }
+    ztimer_set(ZTIMER_USEC, &timer, 1000);
+    ztimer_sleep(ZTIMER_USEC, 10000);
+
+    event_queue_stats_print();
+
+    if (_handled != EVENTS) {
+        printf("[FAILED] %u events handled\n", _handled);
+        return 1;
+    }
+    for (unsigned i = 0; i < EVENTS; i++) {
+        if (_order[i] != i) {
+            printf("[FAILED] event %u handled as %u.\n", _order[i], i);
+            return 1;
+        }
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
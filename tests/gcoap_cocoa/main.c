@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       gcoap confirmable requests with CoCoA retransmission timeouts
+ *
+ * The main thread sends REQUESTS confirmable GET requests to a resource of
+ * the local gcoap server over the IPv6 loopback address, one at a time, and
+ * counts the correct responses.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "net/gcoap.h"
+
+#ifndef REQUESTS
+#define REQUESTS            (20U)
+#endif
+
+#define PAYLOAD             "42"
+
+static ssize_t _value_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              void *ctx);
+
+static const coap_resource_t _resources[] = {
+    { "/value", COAP_GET, _value_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    &_resources[0],
+    ARRAY_SIZE(_resources),
+    NULL,
+    NULL,
+    NULL
+};
+
+/* [::1]:CONFIG_GCOAP_PORT */
+static const sock_udp_ep_t _remote = { .family = AF_INET6,
+                                       .addr = { .ipv6 = { [15] = 1 } },
+                                       .netif = SOCK_ADDR_ANY_NETIF,
+                                       .port = CONFIG_GCOAP_PORT };
+
+static uint8_t _buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+static mutex_t _resp_done = MUTEX_INIT_LOCKED;
+static unsigned _answered;
+
+static ssize_t _value_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              void *ctx)
+{
+    (void)ctx;
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    coap_opt_add_format(pdu, COAP_FORMAT_TEXT);
+    size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+
+    if (pdu->payload_len < sizeof(PAYLOAD) - 1) {
+        return gcoap_response(pdu, buf, len, COAP_CODE_INTERNAL_SERVER_ERROR);
+    }
+    memcpy(pdu->payload, PAYLOAD, sizeof(PAYLOAD) - 1);
+    return resp_len + sizeof(PAYLOAD) - 1;
+}
+
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    (void)remote;
+
+    if (memo->state != GCOAP_MEMO_RESP) {
+        printf("request failed: memo state %d\n", memo->state);
+    }
+    else if ((coap_get_code_raw(pdu) == COAP_CODE_CONTENT) &&
+             (pdu->payload_len == sizeof(PAYLOAD) - 1) &&
+             (memcmp(pdu->payload, PAYLOAD, sizeof(PAYLOAD) - 1) == 0)) {
+        _answered++;
+    }
+    else {
+        printf("unexpected response: code %u\n", coap_get_code(pdu));
+    }
+    mutex_unlock(&_resp_done);
+}
+
+int main(void)
+{
+    gcoap_register_listener(&_listener);
+
+    for (unsigned i = 0; i < REQUESTS; i++) {
+        coap_pkt_t pdu;
+        ssize_t len;
+
+        gcoap_req_init(&pdu, _buf, sizeof(_buf), COAP_METHOD_GET, "/value");
+        coap_hdr_set_type(pdu.hdr, COAP_TYPE_CON);
+        len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+        if (gcoap_req_send(_buf, len, &_remote, _resp_handler, NULL) <= 0) {
+            printf("request %u not sent\n", i);
+            continue;
+        }
+        /* the handler is called for a response and for a timeout */
+        mutex_lock(&_resp_done);
+    }
+
+    printf("%u of %u requests answered\n", _answered, (unsigned)REQUESTS);
+    puts((_answered == REQUESTS) ? "SUCCESS" : "FAILURE");
+    return 0;
+}
@@ -23,6 +23,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "kernel_defines.h"
 #include "net/sock/udp.h"
 #include "test_utils/expect.h"
 #include "xtimer.h"
@@ -493,6 +494,78 @@ static void test_sock_udp_recv_buf__success(void)
     assert(_check_net());
 }
 
+static void test_sock_udp_recv_many__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_rx_msg_t msgs[3] = {
+        { .data = &_test_buffer[0], .max_len = sizeof(_test_buffer) / 4 },
+        { .data = &_test_buffer[32], .max_len = sizeof(_test_buffer) / 4 },
+        { .data = &_test_buffer[64], .max_len = sizeof(_test_buffer) / 4 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE + 1,
+                          _TEST_PORT_LOCAL, "EFGHIJ", sizeof("EFGHIJ"),
+                          _TEST_NETIF));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    /* only two datagrams are queued, so the third is not waited for */
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].len);
+    expect(memcmp("ABCD", msgs[0].data, sizeof("ABCD")) == 0);
+    expect(_TEST_PORT_REMOTE == msgs[0].remote.port);
+    expect(memcmp(&src_addr, &msgs[0].remote.addr, sizeof(src_addr)) == 0);
+    expect(sizeof("EFGHIJ") == msgs[1].len);
+    expect(memcmp("EFGHIJ", msgs[1].data, sizeof("EFGHIJ")) == 0);
+    expect(_TEST_PORT_REMOTE + 1 == msgs[1].remote.port);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv__pktqueue_full(void)
+{
+#if IS_USED(MODULE_GNRC_SOCK_PKTQUEUE)
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    const gnrc_sock_pktqueue_stats_t *stats;
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    stats = gnrc_sock_pktqueue_stats(&_sock.reg);
+    /* an empty queue takes a packet exceeding the limit anyway */
+    gnrc_sock_pktqueue_set_limit(&_sock.reg, 1);
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFGH", sizeof("EFGH"),
+                          _TEST_NETIF));
+    expect(1 == stats->received);
+    expect(1 == stats->dropped_full);
+    expect(0 == stats->dropped_nomem);
+    expect(sizeof("ABCD") == sock_udp_recv(&_sock, _test_buffer,
+                                           sizeof(_test_buffer), 0, NULL));
+    expect(memcmp("ABCD", _test_buffer, sizeof("ABCD")) == 0);
+    expect(-EAGAIN == sock_udp_recv(&_sock, _test_buffer,
+                                    sizeof(_test_buffer), 0, NULL));
+    /* packets not received are released on close */
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "IJKL", sizeof("IJKL"),
+                          _TEST_NETIF));
+    expect(2 == stats->received);
+    sock_udp_close(&_sock);
+    expect(_check_net());
+#endif
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -765,6 +838,37 @@ static void test_sock_udp_send__no_sock(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_many__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    static const sock_udp_ep_t other = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                         .family = AF_INET6,
+                                         .port = _TEST_PORT_REMOTE + 1 };
+    const sock_udp_tx_msg_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD") },
+        { .data = "EFGHIJ", .len = sizeof("EFGHIJ"), .remote = &other },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(2 == sock_udp_send_many(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE + 1, "EFGHIJ", sizeof("EFGHIJ"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 int main(void)
 {
     _net_init();
@@ -798,6 +902,8 @@ int main(void)
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv__aux());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_many__success());
+    CALL(test_sock_udp_recv__pktqueue_full());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -815,6 +921,7 @@ int main(void)
     CALL(test_sock_udp_send__unsocketed());
     CALL(test_sock_udp_send__no_sock_no_netif());
     CALL(test_sock_udp_send__no_sock());
+    CALL(test_sock_udp_send_many__success());
 
     puts("ALL TESTS SUCCESSFUL");
 
@@ -0,0 +1 @@
+../gnrc_sock_udp/constants.h
\ No newline at end of file
@@ -0,0 +1 @@
+../gnrc_sock_udp/main.c
\ No newline at end of file
@@ -0,0 +1 @@
+../gnrc_sock_udp/stack.c
\ No newline at end of file
@@ -0,0 +1 @@
+../gnrc_sock_udp/stack.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../gnrc_sock_udp/tests/01-run.py
\ No newline at end of file
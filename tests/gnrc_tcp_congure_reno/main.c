@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       gnrc_tcp bulk transfer with Reno congestion control
+ *
+ * The main thread connects to a server thread over the IPv6 loopback
+ * address and sends TRANSFER_SIZE bytes of a known pattern, which the server
+ * checks byte by byte.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "net/af.h"
+#include "net/gnrc/tcp.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TRANSFER_SIZE
+#define TRANSFER_SIZE       (32768U)
+#endif
+
+#define PORT                (4711U)
+#define RECV_TIMEOUT_MS     (10U * MS_PER_SEC)
+/* one send carries a full queue of segments, so they are in flight at once */
+#define CHUNK_SIZE          (CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE * \
+                             CONFIG_GNRC_TCP_MSS)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_tcp_tcb_t _server_tcbs[1];
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static gnrc_tcp_tcb_t _client_tcb;
+static uint8_t _tx_buf[CHUNK_SIZE];
+static uint8_t _rx_buf[CONFIG_GNRC_TCP_MSS];
+
+static mutex_t _listening = MUTEX_INIT_LOCKED;
+static mutex_t _server_done = MUTEX_INIT_LOCKED;
+static bool _server_ok;
+
+static void *_server(void *arg)
+{
+    (void)arg;
+    gnrc_tcp_ep_t local;
+    gnrc_tcp_tcb_t *tcb;
+    uint32_t received = 0;
+    bool intact = true;
+    ssize_t res;
+
+    gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, PORT, 0);
+    gnrc_tcp_tcb_init(&_server_tcbs[0]);
+    res = gnrc_tcp_listen(&_queue, _server_tcbs, ARRAY_SIZE(_server_tcbs),
+                          &local);
+    mutex_unlock(&_listening);
+    if (res < 0) {
+        printf("server: listen failed: %d\n", (int)res);
+        mutex_unlock(&_server_done);
+        return NULL;
+    }
+
+    res = gnrc_tcp_accept(&_queue, &tcb, GNRC_TCP_NO_TIMEOUT);
+    if (res < 0) {
+        printf("server: accept failed: %d\n", (int)res);
+        gnrc_tcp_stop_listen(&_queue);
+        mutex_unlock(&_server_done);
+        return NULL;
+    }
+
+    /* read until the client closes its side */
+    while ((res = gnrc_tcp_recv(tcb, _rx_buf, sizeof(_rx_buf),
+                                RECV_TIMEOUT_MS)) > 0) {
+        for (ssize_t i = 0; i < res; i++) {
+            if (_rx_buf[i] != (uint8_t)(received + i)) {
+                intact = false;
+            }
+        }
+        received += res;
+    }
+    if (res < 0) {
+        printf("server: recv failed: %d\n", (int)res);
+    }
+    printf("received %" PRIu32 " bytes\n", received);
+    gnrc_tcp_close(tcb);
+    gnrc_tcp_stop_listen(&_queue);
+
+    _server_ok = (res == 0) && intact && (received == TRANSFER_SIZE);
+    mutex_unlock(&_server_done);
+    return NULL;
+}
+
+static bool _client(void)
+{
+    gnrc_tcp_ep_t remote;
+    /* [::1] */
+    const uint8_t loopback[16] = { [15] = 1 };
+    uint32_t sent = 0;
+    uint32_t start;
+    int res;
+
+    gnrc_tcp_ep_init(&remote, AF_INET6, loopback, sizeof(loopback), PORT, 0);
+    gnrc_tcp_tcb_init(&_client_tcb);
+    res = gnrc_tcp_open(&_client_tcb, &remote, 0);
+    if (res < 0) {
+        printf("client: open failed: %d\n", res);
+        return false;
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    while (sent < TRANSFER_SIZE) {
+        size_t len = TRANSFER_SIZE - sent;
+        ssize_t n;
+
+        if (len > sizeof(_tx_buf)) {
+            len = sizeof(_tx_buf);
+        }
+        for (size_t i = 0; i < len; i++) {
+            _tx_buf[i] = (uint8_t)(sent + i);
+        }
+        n = gnrc_tcp_send(&_client_tcb, _tx_buf, len, GNRC_TCP_NO_TIMEOUT);
+        if (n <= 0) {
+            printf("client: send failed: %d\n", (int)n);
+            gnrc_tcp_abort(&_client_tcb);
+            return false;
+        }
+        sent += n;
+    }
+    printf("sent %" PRIu32 " bytes in %" PRIu32 " us\n", sent,
+           (uint32_t)(ztimer_now(ZTIMER_USEC) - start));
+    gnrc_tcp_close(&_client_tcb);
+    return true;
+}
+
+int main(void)
+{
+    bool ok;
+
+    printf("gnrc_tcp with Reno: %u segments in flight, MSS %u, window %u\n",
+           (unsigned)CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE,
+           (unsigned)CONFIG_GNRC_TCP_MSS,
+           (unsigned)CONFIG_GNRC_TCP_DEFAULT_WINDOW);
+
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _server, NULL, "server");
+    mutex_lock(&_listening);
+
+    ok = _client();
+    if (ok) {
+        mutex_lock(&_server_done);
+    }
+    puts((ok && _server_ok) ? "SUCCESS" : "FAILURE");
+    return 0;
+}
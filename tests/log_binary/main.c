@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test the records of the binary log module
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+
+#include "log.h"
+
+int main(void)
+{
+    uint8_t value = 42;
+    const char *string = "test";
+
+    LOG_ERROR("Logging value %d and string %s\n", value, string);
+    LOG_WARNING("Logging negative %" PRIi32 " and hex %04x\n",
+                (int32_t)-1000, 0xbeef);
+    LOG_INFO("Logging float %.2f and char %c\n", 1.5, 'R');
+    LOG_DEBUG("Logging no arguments\n");
+
+    return 0;
+}
@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+from testrunner import run
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/log_binary'))
+import log_binary  # noqa: E402
+
+MESSAGES = [
+    "ERROR: Logging value 42 and string test",
+    "WARNING: Logging negative -1000 and hex beef",
+    "INFO: Logging float 1.50 and char R",
+    "DEBUG: Logging no arguments",
+]
+
+
+def testfunc(child):
+    elf = log_binary.Elf(os.environ['ELFFILE'])
+    for message in MESSAGES:
+        child.expect(r"~L[A-Za-z0-9+/=]+")
+        text = log_binary.decode_line(elf, child.match.group(0).encode())
+        assert text.decode().endswith(message), text
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,295 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for the caching and asynchronous sock DNS client
+ *
+ * A stand-in DNS server thread answers the queries over the loopback
+ * address. How it answers depends on the first label of the name:
+ *
+ * - `nx`: name error with a SOA record
+ * - `drop`: no answer at all
+ * - `slow`: AAAA record after a delay
+ * - anything else: AAAA record
+ *
+ * @}
+ */
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "event.h"
+#include "mutex.h"
+#include "net/dns.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/dns.h"
+#include "net/sock/udp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define SERVER_PORT         (5353U)
+#define ANSWER_TTL          (2U)        /* in seconds */
+#define NEG_TTL             (60U)       /* in seconds */
+#define SLOW_DELAY_MS       (200U)
+
+#define CALL(fn)            puts("Calling " # fn); fn
+
+static const uint8_t _addr[16] = {
+    0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+};
+
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+static char _client_stack[THREAD_STACKSIZE_DEFAULT];
+static sock_udp_t _server_sock;
+static uint8_t _server_buf[CONFIG_DNS_MSG_LEN];
+static volatile unsigned _queries;
+
+static size_t _put_rr_hdr(uint8_t *buf, uint16_t type, uint32_t ttl,
+                          uint16_t rdlen)
+{
+    uint16_t u16;
+    uint32_t u32;
+
+    /* name is a pointer to the question */
+    buf[0] = 0xc0;
+    buf[1] = sizeof(dns_hdr_t);
+    u16 = htons(type);
+    memcpy(&buf[2], &u16, 2);
+    u16 = htons(DNS_CLASS_IN);
+    memcpy(&buf[4], &u16, 2);
+    u32 = htonl(ttl);
+    memcpy(&buf[6], &u32, 4);
+    u16 = htons(rdlen);
+    memcpy(&buf[10], &u16, 2);
+    return 12;
+}
+
+static void *_server(void *arg)
+{
+    (void)arg;
+    sock_udp_ep_t local = { .family = AF_INET6, .port = SERVER_PORT };
+
+    expect(sock_udp_create(&_server_sock, &local, NULL, 0) == 0);
+    while (1) {
+        sock_udp_ep_t remote;
+        ssize_t len = sock_udp_recv(&_server_sock, _server_buf,
+                                    sizeof(_server_buf), SOCK_NO_TIMEOUT,
+                                    &remote);
+        dns_hdr_t *hdr = (dns_hdr_t *)_server_buf;
+        uint8_t *pos = hdr->payload;
+        const char *label = (char *)&pos[1];
+        uint8_t label_len = pos[0];
+
+        if (len <= (ssize_t)sizeof(dns_hdr_t)) {
+            continue;
+        }
+        _queries++;
+        /* skip the question */
+        while (*pos) {
+            pos += *pos + 1;
+        }
+        pos += 1 + RR_TYPE_LENGTH + RR_CLASS_LENGTH;
+
+        if ((label_len == 4) && (memcmp(label, "drop", 4) == 0)) {
+            continue;
+        }
+        if ((label_len == 4) && (memcmp(label, "slow", 4) == 0)) {
+            ztimer_sleep(ZTIMER_MSEC, SLOW_DELAY_MS);
+        }
+        if ((label_len == 2) && (memcmp(label, "nx", 2) == 0)) {
+            static const uint8_t soa[] = {
+                0, 0,               /* MNAME and RNAME: root */
+                0, 0, 0, 1,         /* SERIAL */
+                0, 0, 0, 60,        /* REFRESH */
+                0, 0, 0, 60,        /* RETRY */
+                0, 0, 0, 60,        /* EXPIRE */
+                0, 0, 0, NEG_TTL,   /* MINIMUM */
+            };
+            hdr->flags = htons(0x8183);
+            hdr->ancount = 0;
+            hdr->nscount = htons(1);
+            pos += _put_rr_hdr(pos, DNS_TYPE_SOA, 3600, sizeof(soa));
+            memcpy(pos, soa, sizeof(soa));
+            pos += sizeof(soa);
+        }
+        else {
+            hdr->flags = htons(0x8180);
+            hdr->ancount = htons(1);
+            hdr->nscount = 0;
+            pos += _put_rr_hdr(pos, DNS_TYPE_AAAA, ANSWER_TTL, sizeof(_addr));
+            memcpy(pos, _addr, sizeof(_addr));
+            pos += sizeof(_addr);
+        }
+        hdr->arcount = 0;
+        sock_udp_send(&_server_sock, _server_buf, pos - _server_buf, &remote);
+    }
+    return NULL;
+}
+
+static void _expect_addr(const char *name)
+{
+    uint8_t addr[16] = { 0 };
+
+    expect(sock_dns_query(name, addr, AF_INET6) == sizeof(addr));
+    expect(memcmp(addr, _addr, sizeof(addr)) == 0);
+}
+
+static void test_sock_dns_cache__positive(void)
+{
+    unsigned queries = _queries;
+
+    _expect_addr("host.example");
+    expect(_queries == queries + 1);
+    /* answered from the cache, case does not matter */
+    _expect_addr("HOST.example");
+    expect(_queries == queries + 1);
+}
+
+static void test_sock_dns_cache__expired(void)
+{
+    unsigned queries = _queries;
+
+    _expect_addr("expire.example");
+    expect(_queries == queries + 1);
+    ztimer_sleep(ZTIMER_SEC, ANSWER_TTL + 1);
+    _expect_addr("expire.example");
+    expect(_queries == queries + 2);
+}
+
+static void test_sock_dns_cache__negative(void)
+{
+    unsigned queries = _queries;
+    uint8_t addr[16];
+
+    expect(sock_dns_query("nx.example", addr, AF_INET6) == -ENOENT);
+    expect(sock_dns_query("nx.example", addr, AF_INET6) == -ENOENT);
+    expect(_queries == queries + 1);
+}
+
+static void test_sock_dns_cache__timeout(void)
+{
+    unsigned queries = _queries;
+    uint8_t addr[16];
+
+    expect(sock_dns_query("drop.example", addr, AF_INET6) == -ETIMEDOUT);
+    expect(_queries == queries + SOCK_DNS_RETRIES);
+    /* errors are not cached */
+    expect(sock_dns_query("drop.example", addr, AF_INET6) == -ETIMEDOUT);
+    expect(_queries == queries + 2 * SOCK_DNS_RETRIES);
+}
+
+static mutex_t _client_done = MUTEX_INIT_LOCKED;
+
+static void *_client(void *arg)
+{
+    _expect_addr(arg);
+    mutex_unlock(&_client_done);
+    return NULL;
+}
+
+static void test_sock_dns_cache__dedup(void)
+{
+    unsigned queries = _queries;
+
+    /* the client has a higher priority, so its query is in flight when
+     * main asks for the same name */
+    thread_create(_client_stack, sizeof(_client_stack),
+                  THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                  _client, "slow.example", "client");
+    _expect_addr("slow.example");
+    mutex_lock(&_client_done);
+    expect(_queries == queries + 1);
+}
+
+static event_queue_t _queue;
+static sock_dns_async_t _async;
+static bool _async_done;
+
+static void _async_handler(event_t *ev)
+{
+    sock_dns_async_t *q = container_of(ev, sock_dns_async_t, super);
+
+    expect(q == &_async);
+    _async_done = true;
+}
+
+static void _run_async(const char *name)
+{
+    _async_done = false;
+    expect(sock_dns_query_async(&_async, &_queue, _async_handler, name,
+                                AF_INET6) == 0);
+    while (!_async_done) {
+        event_t *ev = event_wait(&_queue);
+        ev->handler(ev);
+    }
+    expect(_async.res == sizeof(_addr));
+    expect(memcmp(_async.addr, _addr, sizeof(_addr)) == 0);
+}
+
+static void test_sock_dns_cache__async(void)
+{
+    unsigned queries = _queries;
+
+    _run_async("async.example");
+    expect(_queries == queries + 1);
+    /* the answer of the asynchronous query was cached */
+    _expect_addr("async.example");
+    expect(_queries == queries + 1);
+}
+
+static void test_sock_dns_cache__async_cached(void)
+{
+    unsigned queries = _queries;
+
+    _expect_addr("cached.example");
+    _run_async("cached.example");
+    expect(_queries == queries + 1);
+}
+
+static void test_sock_dns_cache__flush(void)
+{
+    unsigned queries = _queries;
+
+    _expect_addr("flush.example");
+    sock_dns_cache_flush();
+    _expect_addr("flush.example");
+    expect(_queries == queries + 2);
+}
+
+int main(void)
+{
+    sock_dns_server.family = AF_INET6;
+    sock_dns_server.port = SERVER_PORT;
+    ipv6_addr_set_loopback((ipv6_addr_t *)&sock_dns_server.addr.ipv6);
+    event_queue_init(&_queue);
+
+    thread_create(_server_stack, sizeof(_server_stack),
+                  THREAD_PRIORITY_MAIN - 2, THREAD_CREATE_STACKTEST,
+                  _server, NULL, "dns_server");
+
+    CALL(test_sock_dns_cache__positive());
+    CALL(test_sock_dns_cache__expired());
+    CALL(test_sock_dns_cache__negative());
+    CALL(test_sock_dns_cache__timeout());
+    CALL(test_sock_dns_cache__dedup());
+    CALL(test_sock_dns_cache__async());
+    CALL(test_sock_dns_cache__async_cached());
+    CALL(test_sock_dns_cache__flush());
+
+    puts("ALL TESTS SUCCESSFUL");
+
+    return 0;
+}
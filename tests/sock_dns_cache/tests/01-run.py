@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Calling test_sock_dns_cache__positive()")
+    child.expect_exact("Calling test_sock_dns_cache__expired()")
+    child.expect_exact("Calling test_sock_dns_cache__negative()")
+    child.expect_exact("Calling test_sock_dns_cache__timeout()")
+    child.expect_exact("Calling test_sock_dns_cache__dedup()")
+    child.expect_exact("Calling test_sock_dns_cache__async()")
+    child.expect_exact("Calling test_sock_dns_cache__async_cached()")
+    child.expect_exact("Calling test_sock_dns_cache__flush()")
+    child.expect_exact("ALL TESTS SUCCESSFUL")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=30))
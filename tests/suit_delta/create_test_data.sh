@@ -0,0 +1,43 @@
+#!/bin/bash
+
+set -e
+
+# an old image and a new one with a few changes, moved code and new data
+python3 - "${MANIFEST_DIR}" "${IMAGE_SIZE}" <<PYTHON
+import random
+import sys
+
+out, size = sys.argv[1], int(sys.argv[2])
+rand = random.Random(0)
+old = bytearray(rand.randrange(256) for _ in range(size - 256))
+new = bytearray(old)
+for _ in range(16):
+    new[rand.randrange(len(new))] ^= 0x01
+new[512:512] = bytes(rand.randrange(256) for _ in range(64))
+del new[2048:2112]
+new += bytes(rand.randrange(256) for _ in range(size - len(new)))
+with open(out + "/old.bin", "wb") as f:
+    f.write(old)
+with open(out + "/new.bin", "wb") as f:
+    f.write(new)
+PYTHON
+
+"${RIOTBASE}/dist/tools/suit/delta.py" --stats \
+  -o "${MANIFEST_DIR}/new.bin.delta" \
+  "${MANIFEST_DIR}/old.bin" "${MANIFEST_DIR}/new.bin"
+
+"${RIOTBASE}/dist/tools/suit/gen_manifest.py" \
+  --urlroot "test://test" \
+  --seqnr 2 \
+  --uuid-vendor "riot-os.org" \
+  --uuid-class "${BOARD}" \
+  --delta \
+  -o "${MANIFEST_DIR}/manifest.json" \
+  "${MANIFEST_DIR}/new.bin:0:ram:0"
+
+${SUIT_TOOL} create -f suit -i "${MANIFEST_DIR}/manifest.json" \
+  -o "${MANIFEST_DIR}/manifest.bin.unsigned"
+${SUIT_TOOL} sign -k "${SUIT_SEC}" -m "${MANIFEST_DIR}/manifest.bin.unsigned" \
+  -o "${MANIFEST_DIR}/manifest.bin"
+
+rm -f "${MANIFEST_DIR}/manifest.json" "${MANIFEST_DIR}/manifest.bin.unsigned"
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup    tests
+ * @{
+ *
+ * @file
+ * @brief      Tests for SUIT delta payloads
+ *
+ * Installs a new image from a patch against an old image, with a signed
+ * manifest and the mock transport.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+
+#include "suit.h"
+#include "suit/delta.h"
+#include "suit/storage.h"
+#include "suit/transport/mock.h"
+#include "embUnit.h"
+
+#define TEST_MANIFEST_INCLUDE(file) <blob/bin/BOARD_NAME_UNQ/manifests/file>
+
+/* cppcheck-suppress preprocessorErrorDirective
+ * (reason: board-dependent include paths) */
+#include TEST_MANIFEST_INCLUDE(manifest.bin.h)
+#include TEST_MANIFEST_INCLUDE(old.bin.h)
+#include TEST_MANIFEST_INCLUDE(new.bin.h)
+#include TEST_MANIFEST_INCLUDE(new.bin.delta.h)
+
+#define SUIT_URL_MAX            128
+
+const suit_transport_mock_payload_t payloads[] = {
+    {
+        .buf = new_bin_delta,
+        .len = sizeof(new_bin_delta),
+    },
+};
+
+const size_t num_payloads = ARRAY_SIZE(payloads);
+
+static int _parse(void)
+{
+    char url[SUIT_URL_MAX];
+    suit_manifest_t manifest;
+
+    memset(&manifest, 0, sizeof(manifest));
+    manifest.urlbuf = url;
+    manifest.urlbuf_len = SUIT_URL_MAX;
+
+    suit_storage_set_seq_no_all(1);
+    return suit_parse(&manifest, manifest_bin, sizeof(manifest_bin));
+}
+
+static void test_suit_delta_apply(void)
+{
+    const uint8_t *image;
+    size_t len;
+    suit_storage_t *storage = suit_storage_find_by_id(".ram.0");
+
+    suit_delta_set_source(old_bin, sizeof(old_bin));
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, _parse());
+
+    TEST_ASSERT_NOT_NULL(storage);
+    suit_storage_set_active_location(storage, ".ram.0");
+    suit_storage_read_ptr(storage, &image, &len);
+    TEST_ASSERT_EQUAL_INT(sizeof(new_bin), len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(image, new_bin, len));
+
+    printf("image: %u bytes, patch: %u bytes\n",
+           (unsigned)sizeof(new_bin), (unsigned)sizeof(new_bin_delta));
+}
+
+static void test_suit_delta_short_source(void)
+{
+    /* the patch needs the whole old image */
+    suit_delta_set_source(old_bin, sizeof(old_bin) - 1);
+    TEST_ASSERT(_parse() != SUIT_OK);
+}
+
+static void test_suit_delta_wrong_source(void)
+{
+    /* applies, but doesn't match the digest */
+    suit_delta_set_source(new_bin, sizeof(new_bin));
+    TEST_ASSERT(_parse() != SUIT_OK);
+}
+
+Test *tests_suit_delta(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_suit_delta_apply),
+        new_TestFixture(test_suit_delta_short_source),
+        new_TestFixture(test_suit_delta_wrong_source),
+    };
+
+    EMB_UNIT_TESTCALLER(suit_delta_tests, NULL, NULL, fixtures);
+
+    return (Test *)&suit_delta_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_suit_delta());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark of the AES modes of operation
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "crypto/ciphers.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/ecb.h"
+#include "periph_conf.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#include "tests-crypto.h"
+
+#ifndef BENCH_PAYLOAD_LEN
+/* about the payload of a full 802.15.4 frame */
+#define BENCH_PAYLOAD_LEN       (112U)
+#endif
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS              (256U)
+#endif
+
+#define BENCH_CCM_MAC_LEN       (8U)
+
+static const uint8_t _key[16] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c,
+};
+
+static uint8_t _input[BENCH_PAYLOAD_LEN];
+static uint8_t _output[BENCH_PAYLOAD_LEN + BENCH_CCM_MAC_LEN];
+
+static void _print_result(const char *name, uint32_t time)
+{
+    uint64_t bytes = (uint64_t)BENCH_RUNS * BENCH_PAYLOAD_LEN;
+
+    if (time == 0) {
+        time = 1;
+    }
+
+    printf("%s: %" PRIu32 " us, %" PRIu32 " B/s", name, time,
+           (uint32_t)((bytes * US_PER_SEC) / time));
+#ifdef CLOCK_CORECLOCK
+    /* report cycles per byte with one decimal */
+    uint64_t cpb10 = ((uint64_t)time * (CLOCK_CORECLOCK / 1000) * 10)
+                     / (bytes * 1000);
+    printf(", %" PRIu32 ".%" PRIu32 " cycles/byte",
+           (uint32_t)(cpb10 / 10), (uint32_t)(cpb10 % 10));
+#endif
+    puts("");
+}
+
+void bench_crypto_modes(void)
+{
+    cipher_t cipher;
+    uint8_t nonce_counter[16] = { 0 };
+    uint8_t nonce[13] = { 0 };
+    uint32_t start;
+
+    memset(_input, 0x5a, sizeof(_input));
+    cipher_init(&cipher, CIPHER_AES, _key, sizeof(_key));
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        cipher_encrypt_ecb(&cipher, _input,
+                           BENCH_PAYLOAD_LEN & ~(CCM_BLOCK_SIZE - 1), _output);
+    }
+    _print_result("AES-128-ECB", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        cipher_encrypt_ctr(&cipher, nonce_counter, 8, _input,
+                           BENCH_PAYLOAD_LEN, _output);
+    }
+    _print_result("AES-128-CTR", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        cipher_encrypt_ccm(&cipher, NULL, 0, BENCH_CCM_MAC_LEN, 2,
+                           nonce, sizeof(nonce), _input, BENCH_PAYLOAD_LEN,
+                           _output);
+    }
+    _print_result("AES-128-CCM encrypt", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        cipher_decrypt_ccm(&cipher, NULL, 0, BENCH_CCM_MAC_LEN, 2,
+                           nonce, sizeof(nonce), _output,
+                           BENCH_PAYLOAD_LEN + BENCH_CCM_MAC_LEN, _input);
+    }
+    _print_result("AES-128-CCM decrypt", ztimer_now(ZTIMER_USEC) - start);
+}
@@ -24,5 +24,7 @@ int main(void)
     TESTS_RUN(tests_crypto_modes_cbc_tests());
     TESTS_RUN(tests_crypto_modes_ctr_tests());
     TESTS_END();
+
+    bench_crypto_modes();
     return 0;
 }
@@ -14,6 +14,7 @@
 
 #include "embUnit.h"
 #include "crypto/ciphers.h"
+#include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 #include "tests-crypto.h"
 
@@ -246,11 +247,30 @@ static void test_crypto_modes_ctr_decrypt(void)
                     TEST_CIPHER_LEN, TEST_PLAIN, TEST_PLAIN_LEN);
 }
 
+static void test_crypto_modes_ctr_empty(void)
+{
+    cipher_t cipher;
+    uint8_t ctr[16], expected[16];
+    int err;
+
+    err = cipher_init(&cipher, CIPHER_AES, TEST_1_KEY, TEST_1_KEY_LEN);
+    TEST_ASSERT_EQUAL_INT(1, err);
+
+    /* an empty input consumes one counter block */
+    memcpy(ctr, TEST_COUNTER, 16);
+    memcpy(expected, TEST_COUNTER, 16);
+    crypto_block_inc_ctr(expected, 16);
+    TEST_ASSERT_EQUAL_INT(0, cipher_encrypt_ctr(&cipher, ctr, 0, TEST_PLAIN,
+                                                0, NULL));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, ctr, 16));
+}
+
 Test *tests_crypto_modes_ctr_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_modes_ctr_encrypt),
-        new_TestFixture(test_crypto_modes_ctr_decrypt)
+        new_TestFixture(test_crypto_modes_ctr_decrypt),
+        new_TestFixture(test_crypto_modes_ctr_empty)
     };
 
     EMB_UNIT_TESTCALLER(crypto_modes_ctr_tests, NULL, NULL, fixtures);
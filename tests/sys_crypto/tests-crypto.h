@@ -64,6 +64,11 @@ Test* tests_crypto_modes_ecb_tests(void);
 Test* tests_crypto_modes_cbc_tests(void);
 Test* tests_crypto_modes_ctr_tests(void);
 
+/**
+ * @brief   Prints the throughput of the AES modes of operation
+ */
+void bench_crypto_modes(void);
+
 #ifdef __cplusplus
 }
 #endif
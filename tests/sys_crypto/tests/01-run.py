@@ -7,8 +7,17 @@
 # directory for more details.
 
 import sys
-from testrunner import run_check_unittests
+from testrunner import run, check_unittests
+
+BENCHMARKS = ("AES-128-ECB", "AES-128-CTR",
+              "AES-128-CCM encrypt", "AES-128-CCM decrypt")
+
+
+def testfunc(child):
+    check_unittests(child)
+    for name in BENCHMARKS:
+        child.expect(r"{}: \d+ us, \d+ B/s".format(name))
 
 
 if __name__ == "__main__":
-    sys.exit(run_check_unittests())
+    sys.exit(run(testfunc))
@@ -502,6 +502,115 @@ static void test_base64_13_size_estimation(void) {
     }
 }
 
+static void test_base64_14_streaming_encoder(void)
+{
+    static const char data_in[] = "Hello RIOT this is a base64 test!\n"
+                                  "This should work as intended.";
+    static const char expected_encoding[] =
+        "SGVsbG8gUklPVCB0aGlzIGlzIGEgYmFzZTY0IHR"
+        "lc3QhClRoaXMgc2hvdWxkIHdvcmsgYXMgaW50ZW5kZWQu";
+    char out[sizeof(expected_encoding)];
+
+    /* feed the input in all chunk sizes from 1 to 7 bytes */
+    for (size_t chunk = 1; chunk < 8; chunk++) {
+        base64_encoder_t enc;
+        size_t pos = 0;
+
+        base64_encoder_init(&enc, false);
+        for (size_t i = 0; i < strlen(data_in); i += chunk) {
+            size_t len = strlen(data_in) - i;
+            size_t out_size = sizeof(out) - pos;
+            if (len > chunk) {
+                len = chunk;
+            }
+            TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                                  base64_encoder_update(&enc, data_in + i, len,
+                                                        out + pos, &out_size));
+            pos += out_size;
+        }
+
+        size_t out_size = sizeof(out) - pos;
+        TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                              base64_encoder_finish(&enc, out + pos, &out_size));
+        pos += out_size;
+        TEST_ASSERT_EQUAL_INT(strlen(expected_encoding), pos);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(expected_encoding, out, pos));
+    }
+
+    /* insufficient output space is reported with the required size */
+    base64_encoder_t enc;
+    size_t out_size = 3;
+    base64_encoder_init(&enc, false);
+    TEST_ASSERT_EQUAL_INT(BASE64_ERROR_BUFFER_OUT_SIZE,
+                          base64_encoder_update(&enc, data_in, 6, out,
+                                                &out_size));
+    TEST_ASSERT_EQUAL_INT(8, out_size);
+
+    /* urlsafe output is not padded */
+    static const uint8_t data[] = { 0xfb, 0xff };
+    base64_encoder_init(&enc, true);
+    out_size = sizeof(out);
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                          base64_encoder_update(&enc, data, sizeof(data), out,
+                                                &out_size));
+    TEST_ASSERT_EQUAL_INT(0, out_size);
+    out_size = sizeof(out);
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                          base64_encoder_finish(&enc, out, &out_size));
+    TEST_ASSERT_EQUAL_INT(3, out_size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp("-_8", out, 3));
+}
+
+static void test_base64_15_streaming_decoder(void)
+{
+    static const char expected[] = "Hello RIOT this is a base64 test!\n"
+                                   "This should work as intended.";
+    /* contains line breaks and padding to exercise the slow path */
+    static const char encoded[] =
+        "SGVsbG8gUklPVCB0aGlzIGlzIGEgYmFzZTY0IHR\n"
+        "lc3QhClRoaXMgc2hvdWxkIHdvcmsgYXMgaW50ZW5kZWQu\n"
+        "Cg==";
+    char out[sizeof(expected) + 3];
+
+    for (size_t chunk = 1; chunk < 9; chunk++) {
+        base64_decoder_t dec;
+        size_t pos = 0;
+
+        base64_decoder_init(&dec);
+        for (size_t i = 0; i < strlen(encoded); i += chunk) {
+            size_t len = strlen(encoded) - i;
+            size_t out_size = sizeof(out) - pos;
+            if (len > chunk) {
+                len = chunk;
+            }
+            TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                                  base64_decoder_update(&dec, encoded + i, len,
+                                                        out + pos, &out_size));
+            pos += out_size;
+        }
+
+        size_t out_size = sizeof(out) - pos;
+        TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                              base64_decoder_finish(&dec, out + pos, &out_size));
+        pos += out_size;
+        TEST_ASSERT_EQUAL_INT(strlen(expected) + 1, pos);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(expected, out, strlen(expected)));
+        TEST_ASSERT_EQUAL_INT('\n', out[pos - 1]);
+    }
+
+    /* a single left over code can not be decoded */
+    base64_decoder_t dec;
+    size_t out_size = sizeof(out);
+    base64_decoder_init(&dec);
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                          base64_decoder_update(&dec, "SGVsb", 5, out,
+                                                &out_size));
+    TEST_ASSERT_EQUAL_INT(3, out_size);
+    out_size = sizeof(out);
+    TEST_ASSERT_EQUAL_INT(BASE64_ERROR_DATA_IN_SIZE,
+                          base64_decoder_finish(&dec, out, &out_size));
+}
+
 Test *tests_base64_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -519,6 +628,8 @@ Test *tests_base64_tests(void)
         new_TestFixture(test_base64_11_urlsafe_encode_int),
         new_TestFixture(test_base64_12_urlsafe_decode_int),
         new_TestFixture(test_base64_13_size_estimation),
+        new_TestFixture(test_base64_14_streaming_encoder),
+        new_TestFixture(test_base64_15_streaming_decoder),
     };
 
     EMB_UNIT_TESTCALLER(base64_tests, NULL, NULL, fixtures);
@@ -9,10 +9,13 @@
 #include <string.h>
 #include <stdio.h>
 
+#include "kernel_defines.h"
+
 #include "tests-bloom.h"
 
 #include "hashes.h"
 #include "bloom.h"
+#include "bloom_blocked.h"
 #include "bitfield.h"
 
 #include "tests-bloom-sets.h"
@@ -23,7 +26,13 @@
 #define TESTS_BLOOM_NOT_IN_FILTER (996)
 #define TESTS_BLOOM_FALSE_POS_RATE_THR (0.005)
 
+#define TESTS_BLOOM_BLOCKS (4)
+#define TESTS_BLOOM_BLOCKED_K (6)
+#define TESTS_BLOOM_BLOCKED_FALSE_POS_THR (10)
+
 static bloom_t bloom;
+static bloom_blocked_t bloom_blocked;
+BLOOM_BLOCKED_STORAGE(blocks, TESTS_BLOOM_BLOCKS);
 BITFIELD(bf, TESTS_BLOOM_BITS);
 hashfp_t hashes[TESTS_BLOOM_HASHF] = {
                      (hashfp_t) fnv_hash,
@@ -85,6 +94,121 @@ static void test_bloom_based_on_dictionary_fixture(void)
     TEST_ASSERT(false_positive_rate < TESTS_BLOOM_FALSE_POS_RATE_THR);
 }
 
+static void set_up_bloom_blocked(void)
+{
+    bloom_blocked_init(&bloom_blocked, blocks, TESTS_BLOOM_BLOCKS,
+                       TESTS_BLOOM_BLOCKED_K, (hashfp_t)fnv_hash);
+}
+
+static void test_bloom_blocked_dictionary(void)
+{
+    int in = 0;
+
+    for (int i = 0; i < lenB; i++) {
+        bloom_blocked_add(&bloom_blocked, (const uint8_t *)B[i], strlen(B[i]));
+    }
+
+    /* no false negatives */
+    for (int i = 0; i < lenB; i++) {
+        TEST_ASSERT(bloom_blocked_check(&bloom_blocked, (const uint8_t *)B[i],
+                                        strlen(B[i])));
+    }
+
+    for (int i = 0; i < lenA; i++) {
+        in += bloom_blocked_check(&bloom_blocked, (const uint8_t *)A[i],
+                                  strlen(A[i]));
+    }
+    TEST_ASSERT(in < TESTS_BLOOM_BLOCKED_FALSE_POS_THR);
+
+    bloom_blocked_clear(&bloom_blocked);
+    TEST_ASSERT(!bloom_blocked_check(&bloom_blocked, (const uint8_t *)B[0],
+                                     strlen(B[0])));
+}
+
+static void test_bloom_blocked_check_many(void)
+{
+    const uint8_t *bufs[20];
+    size_t lens[20];
+    bool res[20];
+
+    for (int i = 0; i < lenB; i++) {
+        bloom_blocked_add(&bloom_blocked, (const uint8_t *)B[i], strlen(B[i]));
+    }
+
+    /* interleave members and non-members, more than one batch */
+    for (unsigned i = 0; i < 20; i++) {
+        const char *s = (i & 1) ? A[i] : B[i / 2];
+        bufs[i] = (const uint8_t *)s;
+        lens[i] = strlen(s);
+    }
+
+    size_t found = bloom_blocked_check_many(&bloom_blocked, bufs, lens, 20, res);
+    size_t expected = 0;
+    for (unsigned i = 0; i < 20; i++) {
+        TEST_ASSERT(res[i] == bloom_blocked_check(&bloom_blocked, bufs[i],
+                                                  lens[i]));
+        if (!(i & 1)) {
+            TEST_ASSERT(res[i]);
+        }
+        expected += res[i];
+    }
+    TEST_ASSERT_EQUAL_INT(expected, found);
+}
+
+static void test_bloom_counting_remove(void)
+{
+    bloom_counting_t *cbf = &bloom_blocked;
+
+    bloom_counting_init(cbf, blocks, TESTS_BLOOM_BLOCKS,
+                        TESTS_BLOOM_BLOCKED_K, (hashfp_t)fnv_hash);
+
+    for (int i = 0; i < lenB; i++) {
+        bloom_counting_add(cbf, (const uint8_t *)B[i], strlen(B[i]));
+    }
+    /* add the first element twice */
+    bloom_counting_add(cbf, (const uint8_t *)B[0], strlen(B[0]));
+
+    for (int i = 0; i < lenB; i++) {
+        TEST_ASSERT(bloom_counting_check(cbf, (const uint8_t *)B[i],
+                                         strlen(B[i])));
+    }
+
+    /* remove all but the first element once */
+    for (int i = 1; i < lenB; i++) {
+        TEST_ASSERT(bloom_counting_remove(cbf, (const uint8_t *)B[i],
+                                          strlen(B[i])));
+    }
+    TEST_ASSERT(bloom_counting_remove(cbf, (const uint8_t *)B[0],
+                                      strlen(B[0])));
+    TEST_ASSERT(bloom_counting_check(cbf, (const uint8_t *)B[0], strlen(B[0])));
+
+    TEST_ASSERT(bloom_counting_remove(cbf, (const uint8_t *)B[0],
+                                      strlen(B[0])));
+    TEST_ASSERT(!bloom_counting_check(cbf, (const uint8_t *)B[0],
+                                      strlen(B[0])));
+    TEST_ASSERT(!bloom_counting_remove(cbf, (const uint8_t *)B[0],
+                                       strlen(B[0])));
+
+    /* the filter is empty again */
+    for (unsigned i = 0; i < ARRAY_SIZE(blocks); i++) {
+        TEST_ASSERT_EQUAL_INT(0, blocks[i]);
+    }
+}
+
+Test *tests_bloom_blocked_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_bloom_blocked_dictionary),
+        new_TestFixture(test_bloom_blocked_check_many),
+        new_TestFixture(test_bloom_counting_remove),
+    };
+
+    EMB_UNIT_TESTCALLER(bloom_blocked_tests, set_up_bloom_blocked, NULL,
+                        fixtures);
+
+    return (Test *)&bloom_blocked_tests;
+}
+
 Test *tests_bloom_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -100,4 +224,5 @@ Test *tests_bloom_tests(void)
 void tests_bloom(void)
 {
     TESTS_RUN(tests_bloom_tests());
+    TESTS_RUN(tests_bloom_blocked_tests());
 }
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "kernel_defines.h"
+
+#include "checksum/crc.h"
+
+#include "tests-checksum.h"
+
+static uint32_t _table[CRC_TABLE_LEN(CRC_MODE_SLICE8)];
+
+static const crc_mode_t _modes[] = {
+    CRC_MODE_BITWISE,
+    CRC_MODE_NIBBLE,
+    CRC_MODE_TABLE,
+    CRC_MODE_SLICE4,
+    CRC_MODE_SLICE8,
+};
+
+static void _check_all_modes(const crc_params_t *params, uint32_t expect)
+{
+    static const char buf[] = "123456789";
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_modes); i++) {
+        crc_engine_t engine;
+
+        crc_table_generate(params, _modes[i], _table);
+        crc_engine_init(&engine, params, _modes[i], _table);
+
+        TEST_ASSERT_EQUAL_INT(expect, crc_calc(&engine, buf, sizeof(buf) - 1));
+    }
+}
+
+static void test_checksum_crc_crc8(void)
+{
+    _check_all_modes(&crc_params_crc8, 0xf4);
+}
+
+static void test_checksum_crc_crc8_maxim(void)
+{
+    _check_all_modes(&crc_params_crc8_maxim, 0xa1);
+}
+
+static void test_checksum_crc_crc16_ccitt_false(void)
+{
+    _check_all_modes(&crc_params_crc16_ccitt_false, 0x29b1);
+}
+
+static void test_checksum_crc_crc16_kermit(void)
+{
+    _check_all_modes(&crc_params_crc16_kermit, 0x2189);
+}
+
+static void test_checksum_crc_crc16_modbus(void)
+{
+    _check_all_modes(&crc_params_crc16_modbus, 0x4b37);
+}
+
+static void test_checksum_crc_crc32(void)
+{
+    _check_all_modes(&crc_params_crc32, 0xcbf43926);
+}
+
+static void test_checksum_crc_crc32c(void)
+{
+    _check_all_modes(&crc_params_crc32c, 0xe3069283);
+}
+
+static void test_checksum_crc_empty(void)
+{
+    crc_engine_t engine;
+
+    crc_engine_init(&engine, &crc_params_crc32, CRC_MODE_BITWISE, NULL);
+
+    TEST_ASSERT_EQUAL_INT(0, crc_calc(&engine, "", 0));
+}
+
+static void test_checksum_crc_incremental(void)
+{
+    static uint8_t buf[67];
+    crc_engine_t engine;
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i * 7 + 3;
+    }
+
+    crc_engine_init(&engine, &crc_params_crc32c, CRC_MODE_BITWISE, NULL);
+    uint32_t expect = crc_calc(&engine, buf, sizeof(buf));
+
+    crc_table_generate(&crc_params_crc32c, CRC_MODE_SLICE8, _table);
+    crc_engine_init(&engine, &crc_params_crc32c, CRC_MODE_SLICE8, _table);
+
+    /* unaligned chunks that are no multiple of the slice size */
+    uint32_t crc = crc_start(&engine);
+    crc = crc_update(&engine, crc, buf, 1);
+    crc = crc_update(&engine, crc, buf + 1, 13);
+    crc = crc_update(&engine, crc, buf + 14, sizeof(buf) - 14);
+
+    TEST_ASSERT_EQUAL_INT(expect, crc_finish(&engine, crc));
+}
+
+Test *tests_checksum_crc_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        /* Check values according to
+         * https://reveng.sourceforge.io/crc-catalogue/ */
+        new_TestFixture(test_checksum_crc_crc8),
+        new_TestFixture(test_checksum_crc_crc8_maxim),
+        new_TestFixture(test_checksum_crc_crc16_ccitt_false),
+        new_TestFixture(test_checksum_crc_crc16_kermit),
+        new_TestFixture(test_checksum_crc_crc16_modbus),
+        new_TestFixture(test_checksum_crc_crc32),
+        new_TestFixture(test_checksum_crc_crc32c),
+        new_TestFixture(test_checksum_crc_empty),
+        new_TestFixture(test_checksum_crc_incremental),
+    };
+
+    EMB_UNIT_TESTCALLER(checksum_crc_tests, NULL, NULL, fixtures);
+
+    return (Test *)&checksum_crc_tests;
+}
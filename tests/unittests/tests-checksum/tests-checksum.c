@@ -15,4 +15,5 @@ void tests_checksum(void)
     TESTS_RUN(tests_checksum_fletcher16_tests());
     TESTS_RUN(tests_checksum_fletcher32_tests());
     TESTS_RUN(tests_checksum_ucrc16_tests());
+    TESTS_RUN(tests_checksum_crc_tests());
 }
@@ -64,6 +64,13 @@ Test *tests_checksum_fletcher32_tests(void);
  */
 Test *tests_checksum_ucrc16_tests(void);
 
+/**
+ * @brief   Generates tests for checksum/crc.h
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_checksum_crc_tests(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include "embUnit.h"
+
+#include "net/gnrc/portmap.h"
+
+#include "tests-gnrc_portmap.h"
+
+#define PORT_BASE   (49152U)
+
+static gnrc_portmap_t _map;
+
+static void set_up(void)
+{
+    _map = (gnrc_portmap_t)GNRC_PORTMAP_INIT;
+}
+
+static void test_gnrc_portmap__empty(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_portmap_lookup(&_map, PORT_BASE));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_portmap_lookup(&_map, 0));
+}
+
+static void test_gnrc_portmap__add_remove(void)
+{
+    gnrc_portmap_add(&_map, PORT_BASE);
+    gnrc_portmap_add(&_map, PORT_BASE);
+    gnrc_portmap_add(&_map, 5683);
+    TEST_ASSERT_EQUAL_INT(2, gnrc_portmap_lookup(&_map, PORT_BASE));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_portmap_lookup(&_map, 5683));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_portmap_lookup(&_map, PORT_BASE + 1));
+    gnrc_portmap_remove(&_map, PORT_BASE);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_portmap_lookup(&_map, PORT_BASE));
+    gnrc_portmap_remove(&_map, PORT_BASE);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_portmap_lookup(&_map, PORT_BASE));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_portmap_lookup(&_map, 5683));
+}
+
+static void test_gnrc_portmap__full(void)
+{
+    /* removing from the middle of full clusters must keep the other ports
+     * reachable */
+    for (unsigned i = 0; i < GNRC_PORTMAP_SIZE; i++) {
+        gnrc_portmap_add(&_map, PORT_BASE + i);
+    }
+    for (unsigned i = 0; i < GNRC_PORTMAP_SIZE; i += 2) {
+        gnrc_portmap_remove(&_map, PORT_BASE + i);
+    }
+    for (unsigned i = 0; i < GNRC_PORTMAP_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(i & 1, gnrc_portmap_lookup(&_map, PORT_BASE + i));
+    }
+}
+
+static void test_gnrc_portmap__overflow(void)
+{
+    for (unsigned i = 0; i <= GNRC_PORTMAP_SIZE; i++) {
+        gnrc_portmap_add(&_map, PORT_BASE + i);
+    }
+    /* ports in the table are still known to be used */
+    TEST_ASSERT_EQUAL_INT(1, gnrc_portmap_lookup(&_map, PORT_BASE));
+    /* any other port might be the one that did not fit */
+    TEST_ASSERT_EQUAL_INT(-1, gnrc_portmap_lookup(&_map, 1));
+    for (unsigned i = 0; i <= GNRC_PORTMAP_SIZE; i++) {
+        gnrc_portmap_remove(&_map, PORT_BASE + i);
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_portmap_lookup(&_map, 1));
+    for (unsigned i = 0; i <= GNRC_PORTMAP_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_portmap_lookup(&_map, PORT_BASE + i));
+    }
+}
+
+Test *tests_gnrc_portmap_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gnrc_portmap__empty),
+        new_TestFixture(test_gnrc_portmap__add_remove),
+        new_TestFixture(test_gnrc_portmap__full),
+        new_TestFixture(test_gnrc_portmap__overflow),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_portmap_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_portmap_tests;
+}
+
+void tests_gnrc_portmap(void)
+{
+    TESTS_RUN(tests_gnrc_portmap_tests());
+}
+/** @} */
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include "embUnit.h"
+
+#include "net/gnrc/trace.h"
+
+#include "tests-gnrc_trace.h"
+
+#define PKT(i)      ((const void *)(uintptr_t)(0x1000 + (i)))
+
+static gnrc_trace_entry_t _entries[GNRC_TRACE_BUF_SIZE + 1];
+static uint32_t _seq;
+
+static void set_up(void)
+{
+    gnrc_trace_reset();
+    gnrc_trace_enable(true);
+    /* move the cursor behind the entries of the previous tests */
+    _seq = 0;
+    gnrc_trace_read(&_seq, _entries, GNRC_TRACE_BUF_SIZE);
+}
+
+static void test_gnrc_trace__empty(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_trace_read(&_seq, _entries,
+                                             GNRC_TRACE_BUF_SIZE));
+}
+
+static void test_gnrc_trace__add_read(void)
+{
+    uint32_t seq = _seq;
+
+    gnrc_trace_add(GNRC_TRACE_LAYER_NETIF, GNRC_TRACE_EVENT_RX, PKT(0), 127);
+    gnrc_trace_add(GNRC_TRACE_LAYER_IPV6, GNRC_TRACE_EVENT_FWD, PKT(1), 70000);
+    TEST_ASSERT_EQUAL_INT(2, gnrc_trace_read(&_seq, _entries,
+                                             GNRC_TRACE_BUF_SIZE));
+    TEST_ASSERT_EQUAL_INT(seq + 2, _seq);
+    TEST_ASSERT_EQUAL_INT(seq, _entries[0].seq);
+    TEST_ASSERT(PKT(0) == _entries[0].pkt);
+    TEST_ASSERT_EQUAL_INT(127, _entries[0].len);
+    TEST_ASSERT_EQUAL_INT(GNRC_TRACE_LAYER_NETIF, _entries[0].layer);
+    TEST_ASSERT_EQUAL_INT(GNRC_TRACE_EVENT_RX, _entries[0].event);
+    TEST_ASSERT_EQUAL_INT(seq + 1, _entries[1].seq);
+    TEST_ASSERT(PKT(1) == _entries[1].pkt);
+    /* length saturates */
+    TEST_ASSERT_EQUAL_INT(UINT16_MAX, _entries[1].len);
+    TEST_ASSERT_EQUAL_INT(GNRC_TRACE_LAYER_IPV6, _entries[1].layer);
+    TEST_ASSERT_EQUAL_INT(GNRC_TRACE_EVENT_FWD, _entries[1].event);
+    /* nothing new */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_trace_read(&_seq, _entries,
+                                             GNRC_TRACE_BUF_SIZE));
+}
+
+static void test_gnrc_trace__max(void)
+{
+    for (unsigned i = 0; i < 3; i++) {
+        gnrc_trace_add(GNRC_TRACE_LAYER_UDP, GNRC_TRACE_EVENT_DEMUX, PKT(i), i);
+    }
+    TEST_ASSERT_EQUAL_INT(2, gnrc_trace_read(&_seq, _entries, 2));
+    TEST_ASSERT(PKT(1) == _entries[1].pkt);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_trace_read(&_seq, _entries, 2));
+    TEST_ASSERT(PKT(2) == _entries[0].pkt);
+}
+
+static void test_gnrc_trace__overwrite(void)
+{
+    for (unsigned i = 0; i < GNRC_TRACE_BUF_SIZE + 5; i++) {
+        gnrc_trace_add(GNRC_TRACE_LAYER_SOCK, GNRC_TRACE_EVENT_DELIVER, PKT(i),
+                       i);
+    }
+    /* the oldest entries were overwritten */
+    TEST_ASSERT_EQUAL_INT(GNRC_TRACE_BUF_SIZE,
+                          gnrc_trace_read(&_seq, _entries,
+                                          GNRC_TRACE_BUF_SIZE + 1));
+    TEST_ASSERT(PKT(5) == _entries[0].pkt);
+    TEST_ASSERT(PKT(GNRC_TRACE_BUF_SIZE + 4) ==
+                _entries[GNRC_TRACE_BUF_SIZE - 1].pkt);
+}
+
+static void test_gnrc_trace__disabled(void)
+{
+    gnrc_trace_enable(false);
+    gnrc_trace_add(GNRC_TRACE_LAYER_TCP, GNRC_TRACE_EVENT_DEMUX, PKT(0), 0);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_trace_read(&_seq, _entries,
+                                             GNRC_TRACE_BUF_SIZE));
+}
+
+static void test_gnrc_trace__reset(void)
+{
+    gnrc_trace_add(GNRC_TRACE_LAYER_SIXLOWPAN, GNRC_TRACE_EVENT_FRAG, PKT(0),
+                   0);
+    gnrc_trace_reset();
+    TEST_ASSERT_EQUAL_INT(0, gnrc_trace_read(&_seq, _entries,
+                                             GNRC_TRACE_BUF_SIZE));
+}
+
+static void test_gnrc_trace__str(void)
+{
+    TEST_ASSERT_EQUAL_STRING("ipv6",
+                             gnrc_trace_layer_str(GNRC_TRACE_LAYER_IPV6));
+    TEST_ASSERT_EQUAL_STRING("reass",
+                             gnrc_trace_event_str(GNRC_TRACE_EVENT_REASS));
+    TEST_ASSERT_EQUAL_STRING("?",
+                             gnrc_trace_event_str(GNRC_TRACE_EVENT_NUMOF));
+}
+
+Test *tests_gnrc_trace_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gnrc_trace__empty),
+        new_TestFixture(test_gnrc_trace__add_read),
+        new_TestFixture(test_gnrc_trace__max),
+        new_TestFixture(test_gnrc_trace__overwrite),
+        new_TestFixture(test_gnrc_trace__disabled),
+        new_TestFixture(test_gnrc_trace__reset),
+        new_TestFixture(test_gnrc_trace__str),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_trace_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_trace_tests;
+}
+
+void tests_gnrc_trace(void)
+{
+    TESTS_RUN(tests_gnrc_trace_tests());
+}
+/** @} */
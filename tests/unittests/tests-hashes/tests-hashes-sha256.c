@@ -28,6 +28,7 @@
 #include <stdlib.h>
 
 #include "embUnit/embUnit.h"
+#include "kernel_defines.h"
 
 #include "hashes/sha256.h"
 
@@ -266,6 +267,54 @@ static void test_hashes_sha256_hash_sequence_abc_long(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, h_fips_multiblock));
 }
 
+static void test_hashes_sha256_hash_multi(void)
+{
+    /* five streams exercise one full and one partially used set of lanes,
+     * each one long enough to cover several blocks */
+    static const char *patterns[] = {
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+        "0123456789abcde-",
+        "Franz jagt im komplett verwahrlosten Taxi quer durch Bayern",
+        "Frank jagt im komplett verwahrlosten Taxi quer durch Bayern",
+        "1234567890_",
+    };
+    static char teststrings[ARRAY_SIZE(patterns)][4 * 64];
+    sha256_context_t ctx[ARRAY_SIZE(patterns)];
+    sha256_context_t *ctx_ptr[ARRAY_SIZE(patterns)];
+    const void *data[ARRAY_SIZE(patterns)];
+    unsigned char expected[SHA256_DIGEST_LENGTH];
+    unsigned char hash[SHA256_DIGEST_LENGTH];
+    size_t len = sizeof(teststrings[0]) - 1 - 5;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(patterns); i++) {
+        size_t plen = strlen(patterns[i]);
+
+        for (size_t j = 0; j < len; j++) {
+            teststrings[i][j] = patterns[i][j % plen];
+        }
+        teststrings[i][len] = '\0';
+        sha256_init(&ctx[i]);
+        ctx_ptr[i] = &ctx[i];
+    }
+
+    /* feed a short prefix first, so the lockstep path starts mid-block and
+     * then compresses two full blocks */
+    for (unsigned i = 0; i < ARRAY_SIZE(patterns); i++) {
+        data[i] = teststrings[i];
+    }
+    sha256_update_multi(ctx_ptr, data, 7, ARRAY_SIZE(patterns));
+    for (unsigned i = 0; i < ARRAY_SIZE(patterns); i++) {
+        data[i] = teststrings[i] + 7;
+    }
+    sha256_update_multi(ctx_ptr, data, len - 7, ARRAY_SIZE(patterns));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(patterns); i++) {
+        sha256(teststrings[i], strlen(teststrings[i]), expected);
+        sha256_final(&ctx[i], hash);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(expected, hash, sizeof(hash)));
+    }
+}
+
 Test *tests_hashes_sha256_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -284,6 +333,8 @@ Test *tests_hashes_sha256_tests(void)
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
+
+        new_TestFixture(test_hashes_sha256_hash_multi),
     };
 
     EMB_UNIT_TESTCALLER(hashes_sha256_tests, NULL, NULL,